@@ -357,6 +357,58 @@ void vPortFree( void *pv ) PRIVILEGED_FUNCTION;
 void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * pvPortMalloc() counted against one of configHEAP_SITE_NUM call sites.
+ * pvPortMalloc() itself counts against site 0.
+ */
+void *pvPortMallocFrom( size_t xSize, unsigned char ucSite ) PRIVILEGED_FUNCTION;
+
+/* Free blocks are counted in portHEAP_HISTOGRAM_SIZE size buckets. */
+#define portHEAP_HISTOGRAM_SIZE		8
+#define portHEAP_HISTOGRAM_BASE		32
+
+typedef struct xHEAP_STATS
+{
+	size_t xFreeBytes;
+	size_t xMinimumEverFreeBytes;
+	size_t xLargestFreeBlock;
+	unsigned short usFreeBlocks;
+	unsigned short usHistogram[ portHEAP_HISTOGRAM_SIZE ];
+	unsigned short usAllocations;
+	unsigned short usFrees;
+	unsigned short usFailures;
+} xHeapStats;
+
+/*
+ * Walk the free list and fill in the heap statistics.
+ */
+void vPortGetHeapStats( xHeapStats *pxHeapStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * Allocations and failures of a pvPortMallocFrom() call site.
+ */
+void vPortGetHeapSiteStats( unsigned char ucSite, unsigned short *pusAllocations, unsigned short *pusFailures ) PRIVILEGED_FUNCTION;
+
+/*
+ * Call pxFunction for every block of the heap in address order, with the
+ * scheduler suspended.  xOffset is where the memory of the block starts from
+ * the start of the heap and xSize is what the block can hold (heap_4.c only).
+ */
+typedef void ( *pdHEAP_WALK_CODE )( size_t xOffset, size_t xSize, unsigned char ucAllocated );
+void vPortWalkHeap( pdHEAP_WALK_CODE pxFunction ) PRIVILEGED_FUNCTION;
+
+/*
+ * With configUSE_HEAP_TRACE_HOOK set to 1 the heap passes every allocation
+ * and free to vApplicationHeapTraceHook(), with the scheduler suspended.
+ * Offsets and sizes are as vPortWalkHeap() gives them; a failed allocation
+ * has the requested size.  Frees are not counted against a site.
+ */
+#define portHEAP_TRACE_ALLOC		'A'
+#define portHEAP_TRACE_FREE			'F'
+#define portHEAP_TRACE_FAIL			'X'
+
+void vApplicationHeapTraceHook( unsigned char ucOp, unsigned char ucSite, size_t xOffset, size_t xSize );
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
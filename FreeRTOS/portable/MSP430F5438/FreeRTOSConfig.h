@@ -115,12 +115,40 @@ occurs.
 #define configMAX_PRIORITIES                ((unsigned portBASE_TYPE)4)
 #define configMINIMAL_STACK_SIZE            ((unsigned portSHORT)90)
 
+/* 1024 bytes of the original heap are the message buffer pool (BufferPool.c) */
 #ifdef ANALOG
-#define configTOTAL_HEAP_SIZE               ((size_t)12044)
+#define configTOTAL_HEAP_SIZE               ((size_t)11020) //12044
 #else
-#define configTOTAL_HEAP_SIZE               ((size_t)14468) //12000 13500 14508
+#define configTOTAL_HEAP_SIZE               ((size_t)13444) //12000 13500 14508 14468
 #endif
 
+/* 1: bounded time two level segregated fit heap (heap_tlsf.c), 0: heap_4.c */
+#define configUSE_TLSF_HEAP                 0
+
+/* 1: heap_4.c passes its allocations and frees to vApplicationHeapTraceHook()
+ * for the message trace (Trace.c) */
+#if TRACE_CAPTURE && !configUSE_TLSF_HEAP
+#define configUSE_HEAP_TRACE_HOOK           1
+#else
+#define configUSE_HEAP_TRACE_HOOK           0
+#endif
+
+/* pvPortMallocFrom() call sites, the heap counts allocations and failures of
+ * each. Plain pvPortMalloc() (kernel and Bluetooth stack) is HEAP_SITE_OTHER */
+#define HEAP_SITE_OTHER                     0
+#define HEAP_SITE_MSG                       1
+#define HEAP_SITE_DRAW                      2
+#define HEAP_SITE_WIDGET                    3
+#define HEAP_SITE_LCD_READ                  4
+#define HEAP_SITE_SRAM                      5
+#define HEAP_SITE_LCD_BUF                   6
+#define HEAP_SITE_TIMER                     7
+#define HEAP_SITE_CALLER                    8
+#define HEAP_SITE_COUNTDOWN                 9
+#define HEAP_SITE_LOG                       10
+#define HEAP_SITE_DEBUG                     11
+#define configHEAP_SITE_NUM                 12
+
 #define configMAX_TASK_NAME_LEN             8
 #define configUSE_TRACE_FACILITY            0
 #define configUSE_16_BIT_TICKS              1
@@ -60,6 +60,8 @@
              EXTERN RtosTickEnabled
              EXTERN RtosTickCount
              PUBLIC vTickISRCheck
+             EXTERN DmaIsr
+             PUBLIC DMA_ISR
              
 portSAVE_CONTEXT MACRO
                  ;bic.w   #CPUOFF+SCG1+SCG0,0(SP)
@@ -151,9 +153,27 @@ vTickISR:       portSAVE_CONTEXT
                 calla    #vTaskSwitchContext 
                 portRESTORE_CONTEXT
 
+; /*
+; * The DMA ISR (hal_serial_ram.c). A task blocked on a serial ram or LCD
+; * transfer runs as soon as DmaIsr returns TRUE instead of on the next tick.
+; */
+                RSEG ISR_CODE
+                EVEN
+
+DMA_ISR:        portSAVE_CONTEXT
+                calla    #DmaIsr
+                tst.b    r12
+                jeq      DmaIsrDone
+                calla    #vTaskSwitchContext
+DmaIsrDone:     portRESTORE_CONTEXT
+
                 COMMON INTVEC 
                 ORG  TIMER0_A0_VECTOR
 _TA0_VEC:       DC16 vTickISRCheck
+
+                COMMON INTVEC 
+                ORG  DMA_VECTOR
+_DMA_VEC:       DC16 DMA_ISR
               
                 END
 
@@ -62,6 +62,8 @@
              .global xPortStartScheduler
              .global RtosTickEnabled
              .global RtosTickCount
+             .global DmaIsr
+             .global DMA_ISR
 
 portSAVE_CONTEXT .macro
                 ;bic        #CPUOFF+SCG1+SCG0,0(SP)
@@ -180,6 +182,24 @@ vTickISR:
 
 ; /*-----------------------------------------------------------*/
 
+; /*
+; * The DMA ISR (hal_serial_ram.c). A task blocked on a serial ram or LCD
+; * transfer runs as soon as DmaIsr returns TRUE instead of on the next tick.
+; */
+			.sect        ".text:_isr"
+
+
+DMA_ISR:
+                portSAVE_CONTEXT
+                calla    #DmaIsr
+                tst.b    r12
+                jeq      DmaIsrDone
+                calla    #vTaskSwitchContext
+DmaIsrDone:
+                portRESTORE_CONTEXT
+
+; /*-----------------------------------------------------------*/
+
 
 
 
@@ -187,6 +207,9 @@ vTickISR:
 ;              /* Place the tick ISR in the correct vector.             */
                .sect ".int54"                  ; TIMER0_A0_VECTOR
                .short   vTickISRCheck
+
+               .sect ".int50"                  ; DMA_VECTOR
+               .short   DMA_ISR
                .end
 
 
@@ -82,6 +82,9 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+/* heap_tlsf.c is used instead when configUSE_TLSF_HEAP is 1. */
+#if( configUSE_TLSF_HEAP == 0 )
+
 /* Block sizes must not get too small. */
 #define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( heapSTRUCT_SIZE * 2 ) )
 
@@ -94,6 +97,19 @@ task.h is included from an application file. */
 /* Allocate the memory for the heap. */
 static unsigned char ucHeap[ configTOTAL_HEAP_SIZE ];
 
+/* The first block starts at the first aligned address in ucHeap. */
+#define heapALIGNED_HEAP		( ( unsigned char * ) ( ( ( portPOINTER_SIZE_TYPE ) &ucHeap[ portBYTE_ALIGNMENT ] ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK ) ) )
+
+/* Operations are passed to the trace hook with the offset of the memory from
+the start of the heap and what the block can hold. */
+#if( configUSE_HEAP_TRACE_HOOK == 1 )
+	#define heapTRACE( ucOp, ucSite, pxBlock )	vApplicationHeapTraceHook( ( ucOp ), ( ucSite ), ( size_t ) ( ( unsigned char * ) ( pxBlock ) - heapALIGNED_HEAP ) + heapSTRUCT_SIZE, ( ( pxBlock )->xBlockSize & ~xBlockAllocatedBit ) - heapSTRUCT_SIZE )
+	#define heapTRACE_FAILURE( ucSite, xSize )	vApplicationHeapTraceHook( portHEAP_TRACE_FAIL, ( ucSite ), 0, ( xSize ) )
+#else
+	#define heapTRACE( ucOp, ucSite, pxBlock )
+	#define heapTRACE_FAILURE( ucSite, xSize )
+#endif
+
 /* Define the linked list structure.  This is used to link free blocks in order
 of their memory address. */
 typedef struct A_BLOCK_LINK
@@ -140,12 +156,30 @@ application.  When the bit is free the block is still part of the free heap
 space. */
 static size_t xBlockAllocatedBit = 0;
 
+/* Lifetime statistics returned by vPortGetHeapStats().  The allocation and
+free counts wrap, their difference is the number of allocated blocks. */
+static size_t xMinimumEverFreeBytesRemaining = ( ( size_t ) heapADJUSTED_HEAP_SIZE ) & ( ( size_t ) ~portBYTE_ALIGNMENT_MASK );
+static unsigned short usAllocations = 0;
+static unsigned short usFrees = 0;
+static unsigned short usFailures = 0;
+
+/* Allocations and failures of each pvPortMallocFrom() call site. */
+static unsigned short usSiteAllocations[ configHEAP_SITE_NUM ];
+static unsigned short usSiteFailures[ configHEAP_SITE_NUM ];
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
+{
+	return pvPortMallocFrom( xWantedSize, 0 );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocFrom( size_t xWantedSize, unsigned char ucSite )
 {
 xBlockLink *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
 void *pvReturn = NULL;
+size_t xRequestedSize = xWantedSize;
 
 	vTaskSuspendAll();
 	{
@@ -226,9 +260,32 @@ void *pvReturn = NULL;
 					by the application and has no "next" block. */
 					pxBlock->xBlockSize |= xBlockAllocatedBit;
 					pxBlock->pxNextFreeBlock = NULL;
+
+					if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+					{
+						xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+					}
 				}
 			}
 		}
+
+		if( ucSite >= configHEAP_SITE_NUM )
+		{
+			ucSite = 0;
+		}
+
+		if( pvReturn != NULL )
+		{
+			usAllocations++;
+			usSiteAllocations[ ucSite ]++;
+			heapTRACE( portHEAP_TRACE_ALLOC, ucSite, pxBlock );
+		}
+		else
+		{
+			if( usFailures < 0xFFFF ) usFailures++;
+			if( usSiteFailures[ ucSite ] < 0xFFFF ) usSiteFailures[ ucSite ]++;
+			heapTRACE_FAILURE( ucSite, xRequestedSize );
+		}
 	}
 	xTaskResumeAll();
 
@@ -266,16 +323,20 @@ xBlockLink *pxLink;
 //          configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
 //          configASSERT( pxLink->pxNextFreeBlock == NULL );
 
-          if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 &&
+          /* Don't look at the header of memory outside the heap. */
+          if( puc >= ucHeap && puc < &ucHeap[ configTOTAL_HEAP_SIZE ] &&
+                ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 &&
                 pxLink->pxNextFreeBlock == NULL )
           {
               /* The block is being returned to the heap - it is no longer
               allocated. */
               pxLink->xBlockSize &= ~xBlockAllocatedBit;
+              heapTRACE( portHEAP_TRACE_FREE, 0, pxLink );
 
               /* Add this block to the list of free blocks. */
               xFreeBytesRemaining += pxLink->xBlockSize;
               prvInsertBlockIntoFreeList( ( ( xBlockLink * ) pxLink ) );
+              usFrees++;
           }
           else
           {
@@ -294,6 +355,86 @@ size_t xPortGetFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortGetHeapStats( xHeapStats *pxHeapStats )
+{
+xBlockLink *pxBlock;
+unsigned char ucBucket;
+
+	for( ucBucket = 0; ucBucket < portHEAP_HISTOGRAM_SIZE; ucBucket++ )
+	{
+		pxHeapStats->usHistogram[ ucBucket ] = 0;
+	}
+
+	pxHeapStats->xLargestFreeBlock = 0;
+	pxHeapStats->usFreeBlocks = 0;
+
+	vTaskSuspendAll();
+	{
+		/* Walk the free list (empty until the first allocation). */
+		for( pxBlock = xStart.pxNextFreeBlock; pxBlock != NULL && pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+		{
+			pxHeapStats->usFreeBlocks++;
+
+			if( pxBlock->xBlockSize > pxHeapStats->xLargestFreeBlock )
+			{
+				pxHeapStats->xLargestFreeBlock = pxBlock->xBlockSize;
+			}
+
+			/* Bucket 0 is below portHEAP_HISTOGRAM_BASE bytes, each one after
+			that is twice as big as the one before. */
+			for( ucBucket = 0; ucBucket < portHEAP_HISTOGRAM_SIZE - 1; ucBucket++ )
+			{
+				if( pxBlock->xBlockSize < ( ( size_t ) portHEAP_HISTOGRAM_BASE << ucBucket ) ) break;
+			}
+
+			pxHeapStats->usHistogram[ ucBucket ]++;
+		}
+
+		pxHeapStats->xFreeBytes = xFreeBytesRemaining;
+		pxHeapStats->xMinimumEverFreeBytes = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->usAllocations = usAllocations;
+		pxHeapStats->usFrees = usFrees;
+		pxHeapStats->usFailures = usFailures;
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapSiteStats( unsigned char ucSite, unsigned short *pusAllocations, unsigned short *pusFailures )
+{
+	if( ucSite < configHEAP_SITE_NUM )
+	{
+		*pusAllocations = usSiteAllocations[ ucSite ];
+		*pusFailures = usSiteFailures[ ucSite ];
+	}
+	else
+	{
+		*pusAllocations = 0;
+		*pusFailures = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortWalkHeap( pdHEAP_WALK_CODE pxFunction )
+{
+unsigned char *puc;
+size_t xBlockSize;
+
+	vTaskSuspendAll();
+	{
+		/* The blocks follow each other from the start of the heap to pxEnd
+		(which is NULL until the first allocation). */
+		for( puc = heapALIGNED_HEAP; pxEnd != NULL && puc < ( unsigned char * ) pxEnd; puc += xBlockSize )
+		{
+			xBlockSize = ( ( xBlockLink * ) puc )->xBlockSize & ~xBlockAllocatedBit;
+			pxFunction( ( size_t ) ( puc - heapALIGNED_HEAP ) + heapSTRUCT_SIZE, xBlockSize - heapSTRUCT_SIZE,
+						( ( ( xBlockLink * ) puc )->xBlockSize & xBlockAllocatedBit ) != 0 );
+		}
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
 	/* This just exists to keep the linker quiet. */
@@ -306,7 +447,7 @@ xBlockLink *pxFirstFreeBlock;
 unsigned char *pucHeapEnd, *pucAlignedHeap;
 
 	/* Ensure the heap starts on a correctly aligned boundary. */
-	pucAlignedHeap = ( unsigned char * ) ( ( ( portPOINTER_SIZE_TYPE ) &ucHeap[ portBYTE_ALIGNMENT ] ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK ) );
+	pucAlignedHeap = heapALIGNED_HEAP;
 
 	/* xStart is used to hold a pointer to the first item in the list of free
 	blocks.  The void cast is used to prevent compiler warnings. */
@@ -330,6 +471,7 @@ unsigned char *pucHeapEnd, *pucAlignedHeap;
 
 	/* The heap now contains pxEnd. */
 	xFreeBytesRemaining -= heapSTRUCT_SIZE;
+	xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
 
 	/* Work out the position of the top bit in a size_t variable. */
 	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
@@ -388,3 +530,4 @@ unsigned char *puc;
 	}
 }
 
+#endif /* configUSE_TLSF_HEAP */
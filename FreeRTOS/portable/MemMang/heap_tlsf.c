@@ -0,0 +1,539 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/*
+ * A two level segregated fit (TLSF) implementation of pvPortMalloc() and
+ * vPortFree(). Free blocks are kept in lists by size class: the first level
+ * is the power of two of the size, the second level splits each power of
+ * two into tlsfSL_INDEX_COUNT ranges. A bitmap of non-empty lists gives a
+ * large enough block in a fixed number of steps, and a freed block is merged
+ * with its physical neighbours through the pxPrevPhysBlock link, so neither
+ * malloc nor free walk a list.
+ *
+ * Selected with configUSE_TLSF_HEAP, heap_4.c is used otherwise.
+ */
+#include <stdlib.h>
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configUSE_TLSF_HEAP == 1 )
+
+/* Each power of two size range is split into 8 lists. */
+#define tlsfSL_INDEX_COUNT_LOG2		3
+#define tlsfSL_INDEX_COUNT			( 1 << tlsfSL_INDEX_COUNT_LOG2 )
+
+/* Blocks below tlsfSMALL_BLOCK_SIZE share first level 0, split linearly. */
+#define tlsfFL_INDEX_SHIFT			( tlsfSL_INDEX_COUNT_LOG2 + 1 )
+#define tlsfSMALL_BLOCK_SIZE		( ( size_t ) 1 << tlsfFL_INDEX_SHIFT )
+
+/* Blocks are below 16 KB (all the RAM of the MSP430F5438A) unless the
+configuration has a larger heap. */
+#ifdef configTLSF_FL_INDEX_MAX
+	#define tlsfFL_INDEX_MAX		configTLSF_FL_INDEX_MAX
+#else
+	#define tlsfFL_INDEX_MAX		13
+#endif
+#define tlsfFL_INDEX_COUNT			( tlsfFL_INDEX_MAX - tlsfFL_INDEX_SHIFT + 2 )
+
+/* Block sizes are a multiple of portBYTE_ALIGNMENT so bit 0 is free to mark
+a free block. */
+#define tlsfBLOCK_FREE				( ( size_t ) 1 )
+
+/* A few bytes might be lost to byte aligning the heap start address. */
+#define tlsfADJUSTED_HEAP_SIZE		( ( ( size_t ) ( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT ) ) & ( ( size_t ) ~portBYTE_ALIGNMENT_MASK ) )
+
+/* Allocate the memory for the heap. */
+static unsigned char ucHeap[ configTOTAL_HEAP_SIZE ];
+
+/* Every block starts with the link to the block just below it in memory and
+its size.  Only free blocks use the free list links, they are the first bytes
+returned to the application otherwise. */
+typedef struct A_TLSF_BLOCK
+{
+	struct A_TLSF_BLOCK *pxPrevPhysBlock;	/*<< The block below this one in memory, NULL for the first. */
+	size_t xBlockSize;						/*<< Size including the header, tlsfBLOCK_FREE set while free. */
+	struct A_TLSF_BLOCK *pxNextFreeBlock;	/*<< The next free block in the same list. */
+	struct A_TLSF_BLOCK *pxPrevFreeBlock;	/*<< The previous free block in the same list. */
+} xTlsfBlock;
+
+/* The part of the block header an allocated block keeps. */
+#define tlsfHEADER_SIZE				( ( offsetof( xTlsfBlock, pxNextFreeBlock ) + ( portBYTE_ALIGNMENT - 1 ) ) & ~portBYTE_ALIGNMENT_MASK )
+
+/* A free block must hold the free list links. */
+#define tlsfMINIMUM_BLOCK_SIZE		( ( sizeof( xTlsfBlock ) + ( portBYTE_ALIGNMENT - 1 ) ) & ~portBYTE_ALIGNMENT_MASK )
+
+#define tlsfNEXT_BLOCK( pxBlock )	( ( xTlsfBlock * ) ( ( ( unsigned char * ) ( pxBlock ) ) + ( ( pxBlock )->xBlockSize & ~tlsfBLOCK_FREE ) ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void );
+
+/*
+ * First and second level list of a block size.
+ */
+static void prvMapping( size_t xSize, unsigned char *pucFl, unsigned char *pucSl );
+
+/*
+ * Smallest non-empty list whose blocks are all at least xSize bytes.
+ */
+static xTlsfBlock *prvFindFreeBlock( size_t xSize );
+
+static void prvInsertFreeBlock( xTlsfBlock *pxBlock );
+static void prvRemoveFreeBlock( xTlsfBlock *pxBlock );
+
+/*
+ * Index of the highest and lowest set bit of a non-zero word.
+ */
+static unsigned char prvFls( size_t xWord );
+static unsigned char prvFfs( size_t xWord );
+
+/*-----------------------------------------------------------*/
+
+/* The first block and the end marker, an allocated block of size 0 that
+stops the last block from being merged beyond the heap. */
+static xTlsfBlock *pxStart = NULL, *pxEnd = NULL;
+
+/* Bit n of xFlBitmap is set when ucSlBitmap[ n ] is not 0, bit m of
+ucSlBitmap[ n ] is set when pxFreeLists[ n ][ m ] is not empty. */
+static size_t xFlBitmap = 0;
+static unsigned char ucSlBitmap[ tlsfFL_INDEX_COUNT ];
+static xTlsfBlock *pxFreeLists[ tlsfFL_INDEX_COUNT ][ tlsfSL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+fragmentation. */
+static size_t xFreeBytesRemaining = tlsfADJUSTED_HEAP_SIZE;
+
+/* Lifetime statistics returned by vPortGetHeapStats().  The allocation and
+free counts wrap, their difference is the number of allocated blocks. */
+static size_t xMinimumEverFreeBytesRemaining = tlsfADJUSTED_HEAP_SIZE;
+static unsigned short usAllocations = 0;
+static unsigned short usFrees = 0;
+static unsigned short usFailures = 0;
+
+/* Allocations and failures of each pvPortMallocFrom() call site. */
+static unsigned short usSiteAllocations[ configHEAP_SITE_NUM ];
+static unsigned short usSiteFailures[ configHEAP_SITE_NUM ];
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+	return pvPortMallocFrom( xWantedSize, 0 );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocFrom( size_t xWantedSize, unsigned char ucSite )
+{
+xTlsfBlock *pxBlock, *pxRemainder;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the free lists. */
+		if( pxEnd == NULL )
+		{
+			prvHeapInit();
+		}
+
+		/* Nothing bigger than the heap can be found, checking first also
+		keeps the header and alignment from overflowing the size. */
+		if( ( xWantedSize > 0 ) && ( xWantedSize < xFreeBytesRemaining ) )
+		{
+			xWantedSize += tlsfHEADER_SIZE;
+
+			if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+			{
+				xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+			}
+
+			if( xWantedSize < tlsfMINIMUM_BLOCK_SIZE )
+			{
+				xWantedSize = tlsfMINIMUM_BLOCK_SIZE;
+			}
+
+			pxBlock = prvFindFreeBlock( xWantedSize );
+
+			if( pxBlock != NULL )
+			{
+				prvRemoveFreeBlock( pxBlock );
+
+				/* If the block is larger than required the rest goes back to
+				the free lists.  Its neighbours are not free: the block above
+				is pxBlock and the one below was next to a free block. */
+				if( ( pxBlock->xBlockSize - xWantedSize ) >= tlsfMINIMUM_BLOCK_SIZE )
+				{
+					pxRemainder = ( void * ) ( ( ( unsigned char * ) pxBlock ) + xWantedSize );
+					pxRemainder->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+					pxRemainder->pxPrevPhysBlock = pxBlock;
+					tlsfNEXT_BLOCK( pxRemainder )->pxPrevPhysBlock = pxRemainder;
+					pxBlock->xBlockSize = xWantedSize;
+
+					prvInsertFreeBlock( pxRemainder );
+				}
+
+				pvReturn = ( void * ) ( ( ( unsigned char * ) pxBlock ) + tlsfHEADER_SIZE );
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+			}
+		}
+
+		if( ucSite >= configHEAP_SITE_NUM )
+		{
+			ucSite = 0;
+		}
+
+		if( pvReturn != NULL )
+		{
+			usAllocations++;
+			usSiteAllocations[ ucSite ]++;
+		}
+		else
+		{
+			if( usFailures < 0xFFFF ) usFailures++;
+			if( usSiteFailures[ ucSite ] < 0xFFFF ) usSiteFailures[ ucSite ]++;
+		}
+	}
+	xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+unsigned char *puc = ( unsigned char * ) pv;
+xTlsfBlock *pxBlock, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		vTaskSuspendAll();
+		{
+			/* The memory being freed will have the block header immediately
+			before it. */
+			puc -= tlsfHEADER_SIZE;
+			pxBlock = ( void * ) puc;
+
+			/* Don't look at the header of memory outside the heap.  An
+			allocated block fits below the end marker and the block above
+			it links back to it. */
+			if( pxEnd != NULL && puc >= ucHeap && puc < ( unsigned char * ) pxEnd &&
+				( pxBlock->xBlockSize & tlsfBLOCK_FREE ) == 0 &&
+				pxBlock->xBlockSize >= tlsfMINIMUM_BLOCK_SIZE &&
+				pxBlock->xBlockSize <= ( size_t ) ( ( unsigned char * ) pxEnd - puc ) &&
+				tlsfNEXT_BLOCK( pxBlock )->pxPrevPhysBlock == pxBlock )
+			{
+				/* Merge with the block above and the block below when they
+				are free. */
+				pxNeighbour = tlsfNEXT_BLOCK( pxBlock );
+				if( ( pxNeighbour->xBlockSize & tlsfBLOCK_FREE ) != 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xBlockSize += pxNeighbour->xBlockSize;
+				}
+
+				pxNeighbour = pxBlock->pxPrevPhysBlock;
+				if( pxNeighbour != NULL && ( pxNeighbour->xBlockSize & tlsfBLOCK_FREE ) != 0 )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += pxBlock->xBlockSize;
+					pxBlock = pxNeighbour;
+				}
+
+				tlsfNEXT_BLOCK( pxBlock )->pxPrevPhysBlock = pxBlock;
+				prvInsertFreeBlock( pxBlock );
+				usFrees++;
+			}
+			else
+			{
+				extern void vApplicationFreeFailedHook( unsigned char * );
+				vApplicationFreeFailedHook( pv );
+			}
+		}
+		xTaskResumeAll();
+	}
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( xHeapStats *pxHeapStats )
+{
+xTlsfBlock *pxBlock;
+size_t xSize;
+unsigned char ucBucket;
+
+	for( ucBucket = 0; ucBucket < portHEAP_HISTOGRAM_SIZE; ucBucket++ )
+	{
+		pxHeapStats->usHistogram[ ucBucket ] = 0;
+	}
+
+	pxHeapStats->xLargestFreeBlock = 0;
+	pxHeapStats->usFreeBlocks = 0;
+
+	vTaskSuspendAll();
+	{
+		/* Walk the blocks in memory order (none until the first allocation). */
+		for( pxBlock = pxStart; pxBlock != pxEnd; pxBlock = tlsfNEXT_BLOCK( pxBlock ) )
+		{
+			if( ( pxBlock->xBlockSize & tlsfBLOCK_FREE ) == 0 ) continue;
+
+			xSize = pxBlock->xBlockSize & ~tlsfBLOCK_FREE;
+			pxHeapStats->usFreeBlocks++;
+
+			if( xSize > pxHeapStats->xLargestFreeBlock )
+			{
+				pxHeapStats->xLargestFreeBlock = xSize;
+			}
+
+			/* Bucket 0 is below portHEAP_HISTOGRAM_BASE bytes, each one after
+			that is twice as big as the one before. */
+			for( ucBucket = 0; ucBucket < portHEAP_HISTOGRAM_SIZE - 1; ucBucket++ )
+			{
+				if( xSize < ( ( size_t ) portHEAP_HISTOGRAM_BASE << ucBucket ) ) break;
+			}
+
+			pxHeapStats->usHistogram[ ucBucket ]++;
+		}
+
+		pxHeapStats->xFreeBytes = xFreeBytesRemaining;
+		pxHeapStats->xMinimumEverFreeBytes = xMinimumEverFreeBytesRemaining;
+		pxHeapStats->usAllocations = usAllocations;
+		pxHeapStats->usFrees = usFrees;
+		pxHeapStats->usFailures = usFailures;
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapSiteStats( unsigned char ucSite, unsigned short *pusAllocations, unsigned short *pusFailures )
+{
+	if( ucSite < configHEAP_SITE_NUM )
+	{
+		*pusAllocations = usSiteAllocations[ ucSite ];
+		*pusFailures = usSiteFailures[ ucSite ];
+	}
+	else
+	{
+		*pusAllocations = 0;
+		*pusFailures = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+unsigned char *pucAlignedHeap;
+
+	/* Ensure the heap starts on a correctly aligned boundary. */
+	pucAlignedHeap = ( unsigned char * ) ( ( ( portPOINTER_SIZE_TYPE ) &ucHeap[ portBYTE_ALIGNMENT ] ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK ) );
+
+	/* To start with there is a single free block taking up the entire heap
+	space, minus the space taken by the end marker. */
+	pxStart = ( void * ) pucAlignedHeap;
+	pxEnd = ( void * ) ( pucAlignedHeap + tlsfADJUSTED_HEAP_SIZE - tlsfHEADER_SIZE );
+
+	pxStart->pxPrevPhysBlock = NULL;
+	pxStart->xBlockSize = tlsfADJUSTED_HEAP_SIZE - tlsfHEADER_SIZE;
+
+	/* Only the header of the end marker is in the heap. */
+	pxEnd->pxPrevPhysBlock = pxStart;
+	pxEnd->xBlockSize = 0;
+
+	configASSERT( prvFls( pxStart->xBlockSize ) <= tlsfFL_INDEX_MAX );
+
+	xFreeBytesRemaining = 0;
+	prvInsertFreeBlock( pxStart );
+	xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMapping( size_t xSize, unsigned char *pucFl, unsigned char *pucSl )
+{
+unsigned char ucBit;
+
+	if( xSize < tlsfSMALL_BLOCK_SIZE )
+	{
+		*pucFl = 0;
+		*pucSl = ( unsigned char ) ( xSize / ( tlsfSMALL_BLOCK_SIZE / tlsfSL_INDEX_COUNT ) );
+	}
+	else
+	{
+		ucBit = prvFls( xSize );
+		*pucSl = ( unsigned char ) ( ( xSize >> ( ucBit - tlsfSL_INDEX_COUNT_LOG2 ) ) ^ tlsfSL_INDEX_COUNT );
+		*pucFl = ( unsigned char ) ( ucBit - tlsfFL_INDEX_SHIFT + 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static xTlsfBlock *prvFindFreeBlock( size_t xSize )
+{
+unsigned char ucFl, ucSl, ucSlMap;
+size_t xFlMap;
+
+	/* Round up to the next list boundary so any block of the list found is
+	big enough. */
+	if( xSize >= tlsfSMALL_BLOCK_SIZE )
+	{
+		xSize += ( ( size_t ) 1 << ( prvFls( xSize ) - tlsfSL_INDEX_COUNT_LOG2 ) ) - 1;
+	}
+
+	prvMapping( xSize, &ucFl, &ucSl );
+
+	if( ucFl >= tlsfFL_INDEX_COUNT )
+	{
+		return NULL;
+	}
+
+	ucSlMap = ucSlBitmap[ ucFl ] & ( unsigned char ) ( 0xFF << ucSl );
+
+	if( ucSlMap == 0 )
+	{
+		/* Nothing left in this power of two, take the next non-empty one. */
+		xFlMap = xFlBitmap & ~( ( ( size_t ) 2 << ucFl ) - 1 );
+
+		if( xFlMap == 0 )
+		{
+			return NULL;
+		}
+
+		ucFl = prvFfs( xFlMap );
+		ucSlMap = ucSlBitmap[ ucFl ];
+	}
+
+	return pxFreeLists[ ucFl ][ prvFfs( ucSlMap ) ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( xTlsfBlock *pxBlock )
+{
+unsigned char ucFl, ucSl;
+
+	prvMapping( pxBlock->xBlockSize, &ucFl, &ucSl );
+	xFreeBytesRemaining += pxBlock->xBlockSize;
+	pxBlock->xBlockSize |= tlsfBLOCK_FREE;
+
+	pxBlock->pxPrevFreeBlock = NULL;
+	pxBlock->pxNextFreeBlock = pxFreeLists[ ucFl ][ ucSl ];
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock;
+	}
+
+	pxFreeLists[ ucFl ][ ucSl ] = pxBlock;
+	ucSlBitmap[ ucFl ] |= ( unsigned char ) ( 1 << ucSl );
+	xFlBitmap |= ( size_t ) 1 << ucFl;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( xTlsfBlock *pxBlock )
+{
+unsigned char ucFl, ucSl;
+
+	pxBlock->xBlockSize &= ~tlsfBLOCK_FREE;
+	xFreeBytesRemaining -= pxBlock->xBlockSize;
+	prvMapping( pxBlock->xBlockSize, &ucFl, &ucSl );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPrevFreeBlock = pxBlock->pxPrevFreeBlock;
+	}
+
+	if( pxBlock->pxPrevFreeBlock != NULL )
+	{
+		pxBlock->pxPrevFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		pxFreeLists[ ucFl ][ ucSl ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ucSlBitmap[ ucFl ] &= ( unsigned char ) ~( 1 << ucSl );
+
+			if( ucSlBitmap[ ucFl ] == 0 )
+			{
+				xFlBitmap &= ~( ( size_t ) 1 << ucFl );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static unsigned char prvFls( size_t xWord )
+{
+unsigned char ucBit = 0;
+
+	while( ( xWord >>= 1 ) != 0 )
+	{
+		ucBit++;
+	}
+
+	return ucBit;
+}
+/*-----------------------------------------------------------*/
+
+static unsigned char prvFfs( size_t xWord )
+{
+unsigned char ucBit = 0;
+
+	while( ( xWord & 1 ) == 0 )
+	{
+		xWord >>= 1;
+		ucBit++;
+	}
+
+	return ucBit;
+}
+
+#endif /* configUSE_TLSF_HEAP */
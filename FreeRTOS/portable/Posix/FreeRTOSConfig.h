@@ -0,0 +1,58 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file FreeRTOSConfig.h
+ *
+ * Host build: the MSP430 configuration with the sizes that depend on the
+ * pointer width scaled up. Pointers and list items are four times larger
+ * than on the MSP430, so the heap is too; task stacks only hold the index of
+ * the host stack (port.c).
+ */
+/******************************************************************************/
+
+#ifndef HOST_FREERTOS_CONFIG_H
+#define HOST_FREERTOS_CONFIG_H
+
+#include "../MSP430F5438/FreeRTOSConfig.h"
+
+#undef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE               ((size_t)(13444 * 4))
+/* heap_tlsf blocks up to 64 KB */
+#define configTLSF_FL_INDEX_MAX             15
+
+/* HostIdleCycles and HostDisplayNs (Watch/Host/Hal/HostBoard.c) */
+void HostTaskSwitched(signed char const *pName, unsigned char In);
+#define traceTASK_SWITCHED_OUT()            HostTaskSwitched(pxCurrentTCB->pcTaskName, 0)
+#define traceTASK_SWITCHED_IN()             HostTaskSwitched(pxCurrentTCB->pcTaskName, 1)
+
+/* the wrapper task drops below the display task to wait for it */
+#undef INCLUDE_vTaskPrioritySet
+#define INCLUDE_vTaskPrioritySet            1
+
+/* the heap the host build links (heap_2, heap_4 or heap_tlsf) */
+#ifdef HOST_HEAP_TLSF
+#undef configUSE_TLSF_HEAP
+#define configUSE_TLSF_HEAP                 1
+#undef configUSE_HEAP_TRACE_HOOK
+#define configUSE_HEAP_TRACE_HOOK           0
+#endif
+
+/* size of each task's host stack in bytes */
+#define configHOST_STACK_SIZE               (256 * 1024)
+#define configHOST_TASK_NUM                 8
+
+#endif /* HOST_FREERTOS_CONFIG_H */
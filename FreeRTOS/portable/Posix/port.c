@@ -0,0 +1,181 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the host port.
+ *
+ * Every task runs on its own host stack with ucontext; all of them share
+ * one OS thread, so exactly one task runs at a time and a run is repeatable.
+ * The stack FreeRTOS allocates for a task only holds the index of its host
+ * stack, at pxTopOfStack.
+ *
+ * What the MSP430 keeps in the saved context besides the registers is kept
+ * per task here: the critical section nesting and the status register.
+ *----------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hal_rtos_timer.h"
+#include "HostCpu.h"
+
+#define portINITIAL_CRITICAL_NESTING  ((unsigned portSHORT)10)
+
+typedef struct
+{
+  ucontext_t Context;
+  pdTASK_CODE pxCode;
+  void *pvParameters;
+  unsigned portSHORT usCriticalNesting;
+  unsigned short usStatus;
+  char *pcStack;
+} xHostTask;
+
+/* We require the address of the pxCurrentTCB variable, but don't want to know
+any details of its type. */
+typedef void tskTCB;
+extern volatile tskTCB * volatile pxCurrentTCB;
+
+volatile unsigned portSHORT usCriticalNesting = portINITIAL_CRITICAL_NESTING;
+
+static xHostTask xTasks[configHOST_TASK_NUM];
+static unsigned portBASE_TYPE uxTaskNum;
+
+/* where xPortStartScheduler() was called from */
+static ucontext_t xMainContext;
+static portBASE_TYPE xStarted = pdFALSE;
+
+extern unsigned char RtosTickEnabled;
+extern unsigned int RtosTickCount;
+
+/* hal_rtos_timer.c; portext_s43.asm calls it on the MSP430 */
+extern void SetupRtosTimer( void );
+
+static void prvSwitch( xHostTask *pxFrom );
+/*-----------------------------------------------------------*/
+
+static xHostTask *prvCurrentTask( void )
+{
+	portSTACK_TYPE *pxTopOfStack = *( portSTACK_TYPE * volatile * ) pxCurrentTCB;
+
+	return &xTasks[ *pxTopOfStack ];
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskStart( void )
+{
+	xHostTask *pxTask = prvCurrentTask();
+
+	/* a new task starts with interrupts enabled and no critical section */
+	usCriticalNesting = portNO_CRITICAL_SECTION_NESTING;
+	__enable_interrupt();
+
+	pxTask->pxCode( pxTask->pvParameters );
+
+	fprintf( stderr, "port: a task returned\n" );
+	abort();
+}
+/*-----------------------------------------------------------*/
+
+portSTACK_TYPE *pxPortInitialiseStack( portSTACK_TYPE *pxTopOfStack, pdTASK_CODE pxCode, void *pvParameters )
+{
+	xHostTask *pxTask;
+
+	if( uxTaskNum == configHOST_TASK_NUM )
+	{
+		fprintf( stderr, "port: more than %d tasks\n", configHOST_TASK_NUM );
+		abort();
+	}
+
+	pxTask = &xTasks[ uxTaskNum ];
+	pxTask->pxCode = pxCode;
+	pxTask->pvParameters = pvParameters;
+	pxTask->pcStack = malloc( configHOST_STACK_SIZE );
+
+	getcontext( &pxTask->Context );
+	pxTask->Context.uc_stack.ss_sp = pxTask->pcStack;
+	pxTask->Context.uc_stack.ss_size = configHOST_STACK_SIZE;
+	pxTask->Context.uc_link = NULL;
+	makecontext( &pxTask->Context, prvTaskStart, 0 );
+
+	*pxTopOfStack = ( portSTACK_TYPE ) uxTaskNum++;
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xPortStartScheduler( void )
+{
+	SetupRtosTimer();
+
+	xStarted = pdTRUE;
+	swapcontext( &xMainContext, &prvCurrentTask()->Context );
+
+	return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	xHostTask *pxTask = prvCurrentTask();
+
+	DisableRtosTick();
+	xStarted = pdFALSE;
+	swapcontext( &pxTask->Context, &xMainContext );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	xHostTask *pxFrom = prvCurrentTask();
+
+	pxFrom->usCriticalNesting = usCriticalNesting;
+	pxFrom->usStatus = __get_interrupt_state();
+	__disable_interrupt();
+
+	vTaskSwitchContext();
+	prvSwitch( pxFrom );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromIsr( void )
+{
+	if( xStarted ) vPortYield();
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitch( xHostTask *pxFrom )
+{
+	xHostTask *pxTo = prvCurrentTask();
+
+	if( pxTo != pxFrom ) swapcontext( &pxFrom->Context, &pxTo->Context );
+
+	/* pxFrom runs again */
+	usCriticalNesting = pxFrom->usCriticalNesting;
+	__set_interrupt_state( pxFrom->usStatus );
+}
+/*-----------------------------------------------------------*/
+
+/* vTickISR of portext_s43.asm; hal_rtos_timer.c raises it */
+unsigned char xPortTickIsr( void )
+{
+	if( !RtosTickEnabled ) return pdFALSE;
+
+	HostRaise( xPortTickIsr, HostCycles + RtosTickCount * HOST_TICK_CYCLES );
+	vTaskIncrementTick();
+	return pdTRUE;
+}
@@ -0,0 +1,101 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file portmacro.h
+ *
+ * Host (POSIX) port used by the Watch/Host build. All tasks run on one OS
+ * thread with ucontext switching, so a run is deterministic. Interrupts are
+ * simulated by HostCpu.c: they only happen while simulated time passes
+ * (transfers, busy waits, sleep) and are held back while GIE is clear.
+ *
+ * Types keep the MSP430 sizes where the application can see them: ticks are
+ * 16 bit and the stack is counted in 16 bit words.
+ */
+/******************************************************************************/
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#define portCHAR          char
+#define portFLOAT         float
+#define portDOUBLE        double
+#define portLONG          long
+#define portSHORT         int
+#define portSTACK_TYPE    unsigned short
+
+#define portBASE_TYPE     portSHORT
+
+#if( configUSE_16_BIT_TICKS == 1 )
+  typedef unsigned short portTickType;
+  #define portMAX_DELAY ( portTickType ) 0xffff
+#else
+  typedef unsigned int portTickType;
+  #define portMAX_DELAY ( portTickType ) 0xffffffff
+#endif
+
+typedef char tString;
+
+#ifndef TRUE
+  #define TRUE (1 == 1)
+#endif
+
+#ifndef FALSE
+  #define FALSE (0 == 1)
+#endif
+
+#define portNO_CRITICAL_SECTION_NESTING ( ( unsigned portSHORT ) 0 )
+
+/* same rules as the MSP430 port: from an isr (interrupts already disabled
+ * and no critical section) nothing is done */
+#define portENTER_CRITICAL()                                                  \
+{                                                                             \
+  extern volatile unsigned portSHORT usCriticalNesting;                       \
+                                                                              \
+  if (usCriticalNesting != portNO_CRITICAL_SECTION_NESTING ||                 \
+      (__get_interrupt_state() & GIE))                                        \
+  {                                                                           \
+    __disable_interrupt();                                                    \
+    usCriticalNesting++;                                                      \
+  }                                                                           \
+}
+
+#define portEXIT_CRITICAL()                                                   \
+{                                                                             \
+  extern volatile unsigned portSHORT usCriticalNesting;                       \
+                                                                              \
+  if (usCriticalNesting > portNO_CRITICAL_SECTION_NESTING)                    \
+  {                                                                           \
+    usCriticalNesting--;                                                      \
+    if (usCriticalNesting == portNO_CRITICAL_SECTION_NESTING)                 \
+      __enable_interrupt();                                                   \
+  }                                                                           \
+}
+
+extern void vPortYield( void );
+
+#define portYIELD() vPortYield();
+
+/*! Switch to the highest priority ready task once the simulated isr that
+ * asked for it has returned (vTickISR and vDmaISR on the MSP430) */
+extern void vPortYieldFromIsr( void );
+
+#define portBYTE_ALIGNMENT       8
+#define portSTACK_GROWTH         (-1)
+#define portTICK_RATE_MS         (1)
+#define portNOP()                __no_operation()
+
+#endif /* PORTMACRO_H */
@@ -23,808 +23,444 @@
 #include "BitmapData.h"
 #include "LcdDriver.h"
 
-#if __IAR_SYSTEMS_ICC__
-unsigned char const __data20 pTemplate[][BYTES_PER_SCREEN] =
-#else
-unsigned char const pTemplate[][BYTES_PER_SCREEN] =
-#endif
+void StartTemplate(TemplateReader_t *pReader, tTemplate pTemp)
+{
+  pReader->pSrc = pTemp;
+  pReader->Count = 0;
+}
+
+void ReadTemplate(TemplateReader_t *pReader, unsigned char *pDst, unsigned int Length)
 {
-  { // notif mode empty
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x30,0x60,0x80,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,
-    0x30,0x62,0x80,0x01,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,
-    0x30,0x62,0x80,0x01,0x00,0x00,0x00,0xC0,0x00,0x00,0xF0,0x7F,
-    0x60,0x37,0x9E,0x79,0x3C,0xDB,0xF1,0xE0,0x79,0x00,0x10,0x40,
-    0x60,0x37,0xBF,0xFD,0x7E,0xFF,0xFB,0xE1,0xFD,0x00,0x90,0x48,
-    0x60,0x37,0xB3,0xCD,0x66,0x77,0x9B,0xC1,0xCC,0x00,0xD0,0x5D,
-    0xC0,0x1D,0xBF,0x0D,0x66,0x33,0xFB,0xC1,0xCC,0x00,0x90,0x4F,
-    0xC0,0x1D,0xBF,0x0D,0x66,0x33,0xFB,0xC1,0xCC,0x00,0x10,0x47,
-    0xC0,0x1D,0x83,0xCD,0x66,0x33,0x1B,0xC0,0xCC,0x00,0x90,0x4F,
-    0x80,0x08,0xBF,0xFD,0x7E,0x33,0xFB,0xC1,0xFD,0x00,0xD0,0x5D,
-    0x80,0x08,0x9E,0x79,0x3C,0x33,0xF3,0x80,0x79,0x00,0x90,0x48,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x7F,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
-    0x30,0xF3,0xCC,0x36,0x6C,0x9E,0xCF,0x3C,0x33,0x00,0x00,0x00,
-    0x30,0xFB,0xCD,0x3E,0x7C,0xBF,0xDF,0x7E,0x33,0x00,0x00,0x00,
-    0x30,0x9B,0xCD,0x0E,0x1C,0xB3,0xD9,0x60,0x33,0x00,0x00,0x00,
-    0x30,0x9B,0xCD,0x06,0x0C,0xBF,0xD9,0x7C,0x33,0x00,0x00,0x00,
-    0x30,0x9B,0xCD,0x06,0x0C,0xBF,0xD9,0x7E,0x33,0x00,0x00,0x00,
-    0x30,0x9B,0xCD,0x06,0x0C,0x83,0xD9,0x66,0x33,0x00,0x00,0x00,
-    0xF0,0xFB,0xFD,0x06,0x0C,0xBF,0xCF,0x7E,0x3F,0x00,0x00,0x00,
-    0xE0,0xF3,0xF8,0x06,0x0C,0x9E,0xCF,0x7C,0x3E,0x00,0x00,0x00,
-    0x00,0x03,0x00,0x00,0x00,0x80,0x01,0x00,0x30,0x00,0x00,0x00,
-    0xE0,0x03,0x00,0x00,0x00,0x80,0x01,0x00,0x3E,0x00,0x00,0x00,
-    0xC0,0x01,0x00,0x00,0x00,0x80,0x01,0x00,0x1C,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xE0,0x78,0x36,0x8F,0x67,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF0,0xFD,0xBE,0xDF,0xEF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x30,0xCC,0x8E,0xD9,0xEC,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF0,0x0C,0x86,0xDF,0x6F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xE0,0x0D,0x86,0xDF,0x6F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x80,0xCD,0x86,0xC1,0x60,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF0,0xFD,0x86,0xDF,0x6F,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xE0,0x78,0x06,0x8F,0x67,0x06,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x10,0x51,0xC4,0x20,0xA2,0x0B,0x01,0xF3,0x42,0x07,0x00,0x00,
-    0x10,0x51,0x24,0x21,0x22,0x09,0x81,0x14,0x46,0x09,0x00,0x00,
-    0x20,0x49,0x14,0x42,0x12,0x09,0x81,0x10,0x4A,0x11,0x00,0x00,
-    0xA0,0xCA,0x17,0x42,0x15,0x09,0x01,0x73,0x5A,0x11,0x00,0x00,
-    0xA0,0x4A,0x14,0x42,0x15,0x09,0x01,0x14,0x52,0x11,0x00,0x00,
-    0x40,0x44,0x24,0x81,0x08,0x09,0x81,0x14,0x62,0x09,0x00,0x00,
-    0x40,0x44,0xC4,0x80,0x88,0x7B,0x0F,0xF3,0x42,0x07,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x10,0xC4,0x88,0x1E,0xDE,0x3D,0xE6,0x83,0x11,0x7A,0x07,0x00,
-    0x20,0x22,0x89,0x22,0x82,0x44,0x89,0x40,0x32,0x0A,0x08,0x00,
-    0x40,0x11,0x8A,0x22,0x82,0x44,0x81,0x20,0x54,0x0A,0x04,0x00,
-    0x80,0x10,0x8A,0x1E,0x8E,0x3C,0x86,0x20,0xD4,0x3A,0x02,0x00,
-    0x80,0x10,0x8A,0x12,0x82,0x24,0x88,0x20,0x94,0x0A,0x02,0x00,
-    0x80,0x20,0x89,0x22,0x82,0x44,0x89,0x40,0x12,0x0B,0x00,0x00,
-    0x80,0xC0,0x70,0x22,0xC2,0x45,0x86,0x80,0x11,0x7A,0x02,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0xF0,0xC0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x1C,0x00,0x06,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x00,0x07,0x00,0x18,0x00,0x02,0x00,0x40,0x00,0x00,0x00,0x00,
-    0x80,0x01,0x00,0x20,0x00,0x02,0x00,0x40,0x00,0x00,0x00,0x00,
-    0xC0,0x00,0x00,0x40,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x40,0x00,0x00,0x40,0x00,0x02,0x00,0x40,0x00,0x00,0x00,0x00,
-    0x60,0x00,0x00,0x80,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x20,0x00,0x00,0x80,0x00,0x92,0x24,0x49,0x00,0x00,0x00,0x00,
-    0x30,0x00,0x00,0x00,0x01,0x92,0x24,0x49,0x00,0x00,0x00,0x00,
-    0x10,0x00,0x00,0x00,0x01,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x10,0x00,0x00,0x00,0x01,0x92,0x24,0x49,0x00,0xC3,0x30,0x00,
-    0x10,0x00,0x00,0x00,0x01,0x92,0x24,0x49,0x00,0xC3,0x30,0x00,
-    0x30,0x00,0x00,0x00,0x01,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x20,0x00,0x00,0x80,0x00,0x92,0xE4,0x49,0x00,0x00,0x00,0x00,
-    0x60,0x00,0x00,0x80,0x00,0x92,0xE4,0x49,0x00,0x00,0x00,0x00,
-    0x40,0x00,0x00,0x40,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0xC0,0x00,0x00,0x40,0x00,0x92,0x24,0x49,0x00,0x00,0x00,0x00,
-    0x80,0x00,0x00,0x20,0x00,0x92,0x24,0x49,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x18,0x00,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0xC0,0x01,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,
-    0x80,0xF0,0x3F,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,
-    0x80,0x18,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,
-    0x40,0x0E,0x00,0x00,0x00,0x00,0xB8,0x03,0x00,0x00,0x00,0x00,
-    0xC0,0x03,0x00,0x00,0x00,0x00,0x18,0x03,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  },
-  {// music, hid
+  while (Length--)
+  {
+    if (pReader->Count == 0)
+    {
+      unsigned char Ctrl = *pReader->pSrc++;
+      pReader->Repeat = Ctrl & TMPL_RUN;
+      pReader->Count = pReader->Repeat ? (Ctrl & ~TMPL_RUN) + TMPL_RUN_MIN : Ctrl + 1;
+    }
+
+    *pDst++ = *pReader->pSrc;
+    pReader->Count --;
+
+    /* a run moves on when it is used up, a literal after every byte */
+    if (!pReader->Repeat || pReader->Count == 0) pReader->pSrc ++;
+  }
+}
+
+/******************************************************************************/
+// Templates of a full or half screen and widget quads, run-length coded.
+// The images are in Host/Templates; Host/Tools/TemplateRle converts them.
+
+static unsigned char const TEMPLATE_MEM TmplNotifEmpty[] =
+{ // notif mode empty
+  0xA2,0x00,0x03,0x30,0x60,0x80,0x01,0x81,0x00,0x00,0x80,0x82,
+  0x00,0x03,0x30,0x62,0x80,0x01,0x81,0x00,0x00,0xC0,0x82,0x00,
+  0x03,0x30,0x62,0x80,0x01,0x81,0x00,0x64,0xC0,0x00,0x00,0xF0,
+  0x7F,0x60,0x37,0x9E,0x79,0x3C,0xDB,0xF1,0xE0,0x79,0x00,0x10,
+  0x40,0x60,0x37,0xBF,0xFD,0x7E,0xFF,0xFB,0xE1,0xFD,0x00,0x90,
+  0x48,0x60,0x37,0xB3,0xCD,0x66,0x77,0x9B,0xC1,0xCC,0x00,0xD0,
+  0x5D,0xC0,0x1D,0xBF,0x0D,0x66,0x33,0xFB,0xC1,0xCC,0x00,0x90,
+  0x4F,0xC0,0x1D,0xBF,0x0D,0x66,0x33,0xFB,0xC1,0xCC,0x00,0x10,
+  0x47,0xC0,0x1D,0x83,0xCD,0x66,0x33,0x1B,0xC0,0xCC,0x00,0x90,
+  0x4F,0x80,0x08,0xBF,0xFD,0x7E,0x33,0xFB,0xC1,0xFD,0x00,0xD0,
+  0x5D,0x80,0x08,0x9E,0x79,0x3C,0x33,0xF3,0x80,0x79,0x00,0x90,
+  0x48,0x88,0x00,0x01,0x10,0x40,0x88,0x00,0x01,0xF0,0x7F,0x84,
+  0x00,0x00,0xC0,0x89,0x00,0x00,0xC0,0x89,0x00,0x00,0xC0,0x83,
+  0x00,0x08,0x30,0xF3,0xCC,0x36,0x6C,0x9E,0xCF,0x3C,0x33,0x81,
+  0x00,0x08,0x30,0xFB,0xCD,0x3E,0x7C,0xBF,0xDF,0x7E,0x33,0x81,
+  0x00,0x08,0x30,0x9B,0xCD,0x0E,0x1C,0xB3,0xD9,0x60,0x33,0x81,
+  0x00,0x08,0x30,0x9B,0xCD,0x06,0x0C,0xBF,0xD9,0x7C,0x33,0x81,
+  0x00,0x08,0x30,0x9B,0xCD,0x06,0x0C,0xBF,0xD9,0x7E,0x33,0x81,
+  0x00,0x08,0x30,0x9B,0xCD,0x06,0x0C,0x83,0xD9,0x66,0x33,0x81,
+  0x00,0x08,0xF0,0xFB,0xFD,0x06,0x0C,0xBF,0xCF,0x7E,0x3F,0x81,
+  0x00,0x08,0xE0,0xF3,0xF8,0x06,0x0C,0x9E,0xCF,0x7C,0x3E,0x82,
+  0x00,0x00,0x03,0x81,0x00,0x03,0x80,0x01,0x00,0x30,0x81,0x00,
+  0x01,0xE0,0x03,0x81,0x00,0x03,0x80,0x01,0x00,0x3E,0x81,0x00,
+  0x01,0xC0,0x01,0x81,0x00,0x03,0x80,0x01,0x00,0x1C,0xB1,0x00,
+  0x05,0xE0,0x78,0x36,0x8F,0x67,0x03,0x84,0x00,0x05,0xF0,0xFD,
+  0xBE,0xDF,0xEF,0x07,0x84,0x00,0x05,0x30,0xCC,0x8E,0xD9,0xEC,
+  0x06,0x84,0x00,0x05,0xF0,0x0C,0x86,0xDF,0x6F,0x06,0x84,0x00,
+  0x05,0xE0,0x0D,0x86,0xDF,0x6F,0x06,0x84,0x00,0x05,0x80,0xCD,
+  0x86,0xC1,0x60,0x06,0x84,0x00,0x05,0xF0,0xFD,0x86,0xDF,0x6F,
+  0x06,0x84,0x00,0x05,0xE0,0x78,0x06,0x8F,0x67,0x06,0xCC,0x00,
+  0x51,0x10,0x51,0xC4,0x20,0xA2,0x0B,0x01,0xF3,0x42,0x07,0x00,
+  0x00,0x10,0x51,0x24,0x21,0x22,0x09,0x81,0x14,0x46,0x09,0x00,
+  0x00,0x20,0x49,0x14,0x42,0x12,0x09,0x81,0x10,0x4A,0x11,0x00,
+  0x00,0xA0,0xCA,0x17,0x42,0x15,0x09,0x01,0x73,0x5A,0x11,0x00,
+  0x00,0xA0,0x4A,0x14,0x42,0x15,0x09,0x01,0x14,0x52,0x11,0x00,
+  0x00,0x40,0x44,0x24,0x81,0x08,0x09,0x81,0x14,0x62,0x09,0x00,
+  0x00,0x40,0x44,0xC4,0x80,0x88,0x7B,0x0F,0xF3,0x42,0x07,0x8C,
+  0x00,0x52,0x10,0xC4,0x88,0x1E,0xDE,0x3D,0xE6,0x83,0x11,0x7A,
+  0x07,0x00,0x20,0x22,0x89,0x22,0x82,0x44,0x89,0x40,0x32,0x0A,
+  0x08,0x00,0x40,0x11,0x8A,0x22,0x82,0x44,0x81,0x20,0x54,0x0A,
+  0x04,0x00,0x80,0x10,0x8A,0x1E,0x8E,0x3C,0x86,0x20,0xD4,0x3A,
+  0x02,0x00,0x80,0x10,0x8A,0x12,0x82,0x24,0x88,0x20,0x94,0x0A,
+  0x02,0x00,0x80,0x20,0x89,0x22,0x82,0x44,0x89,0x40,0x12,0x0B,
+  0x00,0x00,0x80,0xC0,0x70,0x22,0xC2,0x45,0x86,0x80,0x11,0x7A,
+  0x02,0xB0,0x00,0x01,0x80,0x3F,0x88,0x00,0x02,0xF0,0xC0,0x01,
+  0x87,0x00,0x06,0x1C,0x00,0x06,0x00,0xFE,0xFF,0x7F,0x83,0x00,
+  0x06,0x07,0x00,0x18,0x00,0x02,0x00,0x40,0x82,0x00,0x07,0x80,
+  0x01,0x00,0x20,0x00,0x02,0x00,0x40,0x82,0x00,0x07,0xC0,0x00,
+  0x00,0x40,0x00,0xFE,0xFF,0x7F,0x82,0x00,0x07,0x40,0x00,0x00,
+  0x40,0x00,0x02,0x00,0x40,0x82,0x00,0x07,0x60,0x00,0x00,0x80,
+  0x00,0xFE,0xFF,0x7F,0x82,0x00,0x07,0x20,0x00,0x00,0x80,0x00,
+  0x92,0x24,0x49,0x82,0x00,0x00,0x30,0x81,0x00,0x03,0x01,0x92,
+  0x24,0x49,0x82,0x00,0x00,0x10,0x81,0x00,0x03,0x01,0xFE,0xFF,
+  0x7F,0x82,0x00,0x00,0x10,0x81,0x00,0x08,0x01,0x92,0x24,0x49,
+  0x00,0xC3,0x30,0x00,0x10,0x81,0x00,0x08,0x01,0x92,0x24,0x49,
+  0x00,0xC3,0x30,0x00,0x30,0x81,0x00,0x03,0x01,0xFE,0xFF,0x7F,
+  0x82,0x00,0x07,0x20,0x00,0x00,0x80,0x00,0x92,0xE4,0x49,0x82,
+  0x00,0x07,0x60,0x00,0x00,0x80,0x00,0x92,0xE4,0x49,0x82,0x00,
+  0x07,0x40,0x00,0x00,0x40,0x00,0xFE,0xFF,0x7F,0x82,0x00,0x07,
+  0xC0,0x00,0x00,0x40,0x00,0x92,0x24,0x49,0x82,0x00,0x07,0x80,
+  0x00,0x00,0x20,0x00,0x92,0x24,0x49,0x83,0x00,0x06,0x01,0x00,
+  0x18,0x00,0xFE,0xFF,0x7F,0x83,0x00,0x02,0x01,0x00,0x06,0x87,
+  0x00,0x05,0x01,0xC0,0x01,0x00,0x00,0x40,0x83,0x00,0x02,0x80,
+  0xF0,0x3F,0x81,0x00,0x00,0xE0,0x83,0x00,0x01,0x80,0x18,0x82,
+  0x00,0x01,0xF0,0x01,0x82,0x00,0x01,0x40,0x0E,0x82,0x00,0x01,
+  0xB8,0x03,0x82,0x00,0x01,0xC0,0x03,0x82,0x00,0x01,0x18,0x03,
+  0xA6,0x00
+};
+
 #if SUPPORT_HID
-// new music
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x7f,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,
-    0x00,0x00,0xc0,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x48,
-    0x00,0x00,0xc0,0x6f,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x5d,
-    0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x4f,
-    0x00,0x00,0x00,0xe3,0xe3,0x81,0xe3,0xd9,0xf8,0x00,0x10,0x47,
-    0x00,0x00,0x00,0xe3,0xf7,0xc3,0xf7,0xfb,0xfd,0x00,0x90,0x4f,
-    0x00,0x00,0x00,0x63,0x36,0xc3,0x30,0xbb,0xcd,0x00,0xd0,0x5d,
-    0x00,0x00,0x00,0x63,0xf6,0xc3,0x33,0x9b,0xcd,0x00,0x90,0x48,
-    0x00,0x00,0x00,0x63,0xf6,0x83,0x37,0x9b,0xcd,0x00,0x10,0x40,
-    0x00,0x00,0x00,0x63,0x36,0x00,0x36,0x9b,0xcd,0x00,0xf0,0x7f,
-    0x00,0x00,0x00,0x63,0xf6,0xc3,0xf7,0x9b,0xfd,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x63,0xe6,0x81,0xe3,0x99,0xf9,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x36,0x9e,0xed,0x78,0xf0,0xf1,0x6c,0x1e,0x00,0x00,
-    0x00,0x00,0x7e,0xbf,0xff,0xfd,0xf0,0xfb,0x7d,0x3f,0x00,0x00,
-    0x00,0x00,0x6e,0xb0,0xbb,0xcd,0x30,0x9b,0x1d,0x33,0x00,0x00,
-    0x00,0x00,0x66,0xbe,0x99,0xfd,0x30,0xfb,0x0d,0x3f,0x00,0x00,
-    0x00,0x00,0x66,0xbf,0x99,0xfd,0x30,0xfb,0x0d,0x3f,0x00,0x00,
-    0x00,0x00,0x66,0xb3,0x99,0x0d,0x30,0x1b,0x0c,0x03,0x00,0x00,
-    0x00,0x00,0x66,0xbf,0x99,0xfd,0x30,0xfb,0x0d,0x3f,0x00,0x00,
-    0x00,0x00,0x66,0xbe,0x99,0x79,0x30,0xf3,0x0c,0x1e,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
-    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
-    0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
-    0xf8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
-    0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
-    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,
-    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-    0x7f,0xd0,0x85,0xdf,0xc3,0x20,0x66,0x70,0xef,0xbd,0x2f,0xfc,
-    0xff,0xdd,0xf5,0xdf,0xbb,0x7b,0xdb,0x7d,0xee,0x3d,0xa7,0xff,
-    0xff,0xdd,0xf5,0xaf,0xbb,0x7b,0xfb,0x7d,0xed,0x3a,0xa7,0xff,
-    0xff,0x1d,0xc4,0xaf,0xc3,0x7b,0xe7,0x7d,0xe9,0xba,0x2a,0xfe,
-    0xff,0xdd,0xf5,0x07,0xdb,0x7b,0xdf,0x7d,0x6b,0xb0,0xaa,0xff,
-    0xff,0xdd,0xf5,0x77,0xbb,0x7b,0xdb,0x7d,0x67,0xb7,0xad,0xff,
-    0xff,0xdd,0x85,0xfb,0xba,0x3b,0xe6,0x7d,0xaf,0xaf,0x2d,0xfc,
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-    0xff,0xf9,0x1c,0xe6,0x5d,0x08,0xc3,0xef,0x0b,0x33,0xfe,0xff,
-    0xff,0x76,0xdb,0xdb,0x5d,0xef,0xfa,0xdf,0xed,0xed,0xfd,0xff,
-    0x7f,0xbf,0xd7,0xfb,0x5d,0xef,0xfa,0xbf,0xee,0xfd,0xfe,0xff,
-    0x7f,0xa3,0x17,0xe7,0x41,0x0c,0xe3,0x7f,0x8f,0x73,0xff,0xff,
-    0x7f,0xaf,0xd7,0xdf,0x5d,0x6f,0xfb,0x7f,0xef,0x6f,0xff,0xff,
-    0xff,0x76,0xdb,0xdb,0x5d,0xef,0xfa,0x7e,0xef,0xed,0xff,0xff,
-    0xff,0xf9,0x1c,0xe6,0x5d,0xe8,0xc2,0x7e,0x0f,0x73,0xff,0xff,
-    0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,0xff,0xff,
-    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x78,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xf8,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xf8,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
-    0xf8,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,
-    0x78,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+static unsigned char const TEMPLATE_MEM TmplMusic[] =
+{ // music, hid
+  0xFF,0x00,0x97,0x00,0x01,0xF0,0x7F,0x88,0x00,0x05,0x10,0x40,
+  0x00,0x00,0xC0,0x6F,0x84,0x00,0x05,0x90,0x48,0x00,0x00,0xC0,
+  0x6F,0x84,0x00,0x01,0xD0,0x5D,0x81,0x00,0x00,0x63,0x84,0x00,
+  0x01,0x90,0x4F,0x81,0x00,0x80,0xE3,0x06,0x81,0xE3,0xD9,0xF8,
+  0x00,0x10,0x47,0x81,0x00,0x08,0xE3,0xF7,0xC3,0xF7,0xFB,0xFD,
+  0x00,0x90,0x4F,0x81,0x00,0x08,0x63,0x36,0xC3,0x30,0xBB,0xCD,
+  0x00,0xD0,0x5D,0x81,0x00,0x08,0x63,0xF6,0xC3,0x33,0x9B,0xCD,
+  0x00,0x90,0x48,0x81,0x00,0x08,0x63,0xF6,0x83,0x37,0x9B,0xCD,
+  0x00,0x10,0x40,0x81,0x00,0x08,0x63,0x36,0x00,0x36,0x9B,0xCD,
+  0x00,0xF0,0x7F,0x81,0x00,0x05,0x63,0xF6,0xC3,0xF7,0x9B,0xFD,
+  0x84,0x00,0x05,0x63,0xE6,0x81,0xE3,0x99,0xF9,0x89,0x00,0x00,
+  0xC0,0x89,0x00,0x00,0xF8,0x89,0x00,0x00,0x70,0x9F,0x00,0x00,
+  0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,0x30,0x85,0x00,0x07,
+  0x36,0x9E,0xED,0x78,0xF0,0xF1,0x6C,0x1E,0x82,0x00,0x07,0x7E,
+  0xBF,0xFF,0xFD,0xF0,0xFB,0x7D,0x3F,0x82,0x00,0x07,0x6E,0xB0,
+  0xBB,0xCD,0x30,0x9B,0x1D,0x33,0x82,0x00,0x07,0x66,0xBE,0x99,
+  0xFD,0x30,0xFB,0x0D,0x3F,0x82,0x00,0x07,0x66,0xBF,0x99,0xFD,
+  0x30,0xFB,0x0D,0x3F,0x82,0x00,0x07,0x66,0xB3,0x99,0x0D,0x30,
+  0x1B,0x0C,0x03,0x82,0x00,0x07,0x66,0xBF,0x99,0xFD,0x30,0xFB,
+  0x0D,0x3F,0x82,0x00,0x07,0x66,0xBE,0x99,0x79,0x30,0xF3,0x0C,
+  0x1E,0xA4,0x00,0x00,0x18,0x89,0x00,0x00,0x38,0x88,0x00,0x01,
+  0x0C,0x78,0x88,0x00,0x01,0x0C,0xF8,0x88,0x00,0x02,0x3F,0xF8,
+  0x01,0x87,0x00,0x01,0x3F,0xF8,0x88,0x00,0x01,0x0C,0x78,0x88,
+  0x00,0x01,0x0C,0x38,0x89,0x00,0x00,0x18,0xAD,0x00,0x8A,0xFF,
+  0x53,0x7F,0xD0,0x85,0xDF,0xC3,0x20,0x66,0x70,0xEF,0xBD,0x2F,
+  0xFC,0xFF,0xDD,0xF5,0xDF,0xBB,0x7B,0xDB,0x7D,0xEE,0x3D,0xA7,
+  0xFF,0xFF,0xDD,0xF5,0xAF,0xBB,0x7B,0xFB,0x7D,0xED,0x3A,0xA7,
+  0xFF,0xFF,0x1D,0xC4,0xAF,0xC3,0x7B,0xE7,0x7D,0xE9,0xBA,0x2A,
+  0xFE,0xFF,0xDD,0xF5,0x07,0xDB,0x7B,0xDF,0x7D,0x6B,0xB0,0xAA,
+  0xFF,0xFF,0xDD,0xF5,0x77,0xBB,0x7B,0xDB,0x7D,0x67,0xB7,0xAD,
+  0xFF,0xFF,0xDD,0x85,0xFB,0xBA,0x3B,0xE6,0x7D,0xAF,0xAF,0x2D,
+  0xFC,0x8B,0xFF,0x38,0xF9,0x1C,0xE6,0x5D,0x08,0xC3,0xEF,0x0B,
+  0x33,0xFE,0xFF,0xFF,0x76,0xDB,0xDB,0x5D,0xEF,0xFA,0xDF,0xED,
+  0xED,0xFD,0xFF,0x7F,0xBF,0xD7,0xFB,0x5D,0xEF,0xFA,0xBF,0xEE,
+  0xFD,0xFE,0xFF,0x7F,0xA3,0x17,0xE7,0x41,0x0C,0xE3,0x7F,0x8F,
+  0x73,0xFF,0xFF,0x7F,0xAF,0xD7,0xDF,0x5D,0x6F,0xFB,0x7F,0xEF,
+  0x6F,0x81,0xFF,0x08,0x76,0xDB,0xDB,0x5D,0xEF,0xFA,0x7E,0xEF,
+  0xED,0x81,0xFF,0x08,0xF9,0x1C,0xE6,0x5D,0xE8,0xC2,0x7E,0x0F,
+  0x73,0x86,0xFF,0x00,0x7F,0x8F,0xFF,0xAE,0x00,0x01,0x18,0x06,
+  0x88,0x00,0x01,0x38,0x06,0x88,0x00,0x01,0x78,0x06,0x88,0x00,
+  0x01,0xF8,0x06,0x88,0x00,0x01,0xF8,0x07,0x87,0x00,0x02,0x1F,
+  0xF8,0x06,0x87,0x00,0x02,0x1F,0x78,0x06,0x88,0x00,0x01,0x38,
+  0x06,0x88,0x00,0x01,0x18,0x06,0xF4,0x00
+};
 #else
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x00,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
-    0x00,0x80,0x07,0x00,0x00,0x20,0x30,0x00,0x00,0x00,0x00,0x0E,
-    0x00,0xC0,0x0F,0x00,0x00,0x60,0x30,0x00,0x00,0x00,0x00,0x0C,
-    0x00,0xC0,0x0C,0x00,0x00,0xE0,0x30,0x00,0x00,0x00,0x00,0x18,
-    0x00,0xC0,0xC0,0xB3,0xF1,0xE1,0x31,0xCF,0x76,0x3C,0x00,0x18,
-    0x00,0xC0,0xE1,0xF7,0xFB,0xE1,0xB3,0xDF,0xFF,0x7E,0x00,0x30,
-    0x00,0x80,0x67,0x76,0x9B,0x61,0x37,0xD8,0xDD,0x66,0x00,0x30,
-    0x00,0x00,0x6E,0x36,0x9B,0x61,0x3E,0xDF,0xCC,0x7E,0x00,0x30,
-    0x00,0x00,0x6C,0x36,0x9B,0x61,0xBC,0xDF,0xCC,0x7E,0x00,0x30,
-    0x00,0xC0,0x6C,0x36,0x9B,0x61,0xB8,0xD9,0xCC,0x06,0x00,0x30,
-    0x00,0xC0,0xEF,0x37,0xFB,0x61,0xB0,0xDF,0xCC,0x7E,0x00,0x30,
-    0x00,0x80,0xC7,0x33,0xF3,0x61,0x20,0xDF,0xCC,0x3C,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3F,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,
-    0xF8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,
-    0xF8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
-    0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFD,0x7F,0xF3,0xDF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFD,0x3F,0xF3,0xCF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xF8,0x3F,0xFF,0xCF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0x78,0x12,0x32,0x86,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x7F,0x72,0x10,0x12,0x84,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x7F,0x72,0x3C,0x93,0xCF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x3F,0x67,0x3E,0x13,0xCE,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x3F,0x67,0x3E,0x33,0xCC,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x1F,0x40,0x3E,0xF3,0xCC,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x9F,0x4F,0x3E,0x12,0x8C,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0x9F,0x4F,0x7E,0x32,0x9E,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x78,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF8,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF8,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,
-    0xF8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,
-    0xF8,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0xF8,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x78,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x38,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x18,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+static unsigned char const TEMPLATE_MEM TmplMusic[] =
+{ // music
+  0x96,0x00,0x88,0xFF,0x01,0x3F,0x00,0x89,0xFF,0x89,0x00,0x01,
+  0xC0,0x03,0x89,0x00,0x07,0x07,0x00,0x80,0x07,0x00,0x00,0x20,
+  0x30,0x82,0x00,0x07,0x0E,0x00,0xC0,0x0F,0x00,0x00,0x60,0x30,
+  0x82,0x00,0x07,0x0C,0x00,0xC0,0x0C,0x00,0x00,0xE0,0x30,0x82,
+  0x00,0x60,0x18,0x00,0xC0,0xC0,0xB3,0xF1,0xE1,0x31,0xCF,0x76,
+  0x3C,0x00,0x18,0x00,0xC0,0xE1,0xF7,0xFB,0xE1,0xB3,0xDF,0xFF,
+  0x7E,0x00,0x30,0x00,0x80,0x67,0x76,0x9B,0x61,0x37,0xD8,0xDD,
+  0x66,0x00,0x30,0x00,0x00,0x6E,0x36,0x9B,0x61,0x3E,0xDF,0xCC,
+  0x7E,0x00,0x30,0x00,0x00,0x6C,0x36,0x9B,0x61,0xBC,0xDF,0xCC,
+  0x7E,0x00,0x30,0x00,0xC0,0x6C,0x36,0x9B,0x61,0xB8,0xD9,0xCC,
+  0x06,0x00,0x30,0x00,0xC0,0xEF,0x37,0xFB,0x61,0xB0,0xDF,0xCC,
+  0x7E,0x00,0x30,0x00,0x80,0xC7,0x33,0xF3,0x61,0x20,0xDF,0xCC,
+  0x3C,0x00,0x30,0x82,0x00,0x01,0x80,0x01,0x83,0x00,0x00,0x30,
+  0x82,0x00,0x01,0xF0,0x01,0x83,0x00,0x00,0x30,0x82,0x00,0x00,
+  0xE0,0x84,0x00,0x00,0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,
+  0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,
+  0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,
+  0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,
+  0x30,0x89,0x00,0x00,0x30,0x89,0x00,0x00,0x18,0x89,0x00,0x00,
+  0x18,0x89,0x00,0x00,0x0C,0x89,0x00,0x00,0x0E,0x89,0x00,0x00,
+  0x07,0x88,0x00,0x01,0xC0,0x03,0x89,0xFF,0x00,0x00,0x88,0xFF,
+  0x00,0x3F,0xA3,0x00,0x00,0x18,0x89,0x00,0x00,0x38,0x88,0x00,
+  0x01,0x03,0x78,0x88,0x00,0x01,0x03,0xF8,0x88,0x00,0x02,0x03,
+  0xF8,0x01,0x86,0x00,0x03,0xE0,0x1F,0xF8,0x03,0x86,0x00,0x03,
+  0xE0,0x1F,0xF8,0x01,0x87,0x00,0x01,0x03,0xF8,0x88,0x00,0x01,
+  0x03,0x78,0x88,0x00,0x01,0x03,0x38,0x89,0x00,0x00,0x18,0xB9,
+  0x00,0xA6,0xFF,0x03,0xFD,0x7F,0xF3,0xDF,0x86,0xFF,0x03,0xFD,
+  0x3F,0xF3,0xCF,0x86,0xFF,0x03,0xF8,0x3F,0xFF,0xCF,0x86,0xFF,
+  0x03,0x78,0x12,0x32,0x86,0x85,0xFF,0x04,0x7F,0x72,0x10,0x12,
+  0x84,0x85,0xFF,0x04,0x7F,0x72,0x3C,0x93,0xCF,0x85,0xFF,0x04,
+  0x3F,0x67,0x3E,0x13,0xCE,0x85,0xFF,0x04,0x3F,0x67,0x3E,0x33,
+  0xCC,0x85,0xFF,0x04,0x1F,0x40,0x3E,0xF3,0xCC,0x85,0xFF,0x04,
+  0x9F,0x4F,0x3E,0x12,0x8C,0x85,0xFF,0x04,0x9F,0x4F,0x7E,0x32,
+  0x9E,0xB2,0xFF,0x96,0x00,0x01,0x18,0x0C,0x88,0x00,0x01,0x38,
+  0x0C,0x88,0x00,0x01,0x78,0x0C,0x88,0x00,0x01,0xF8,0x0C,0x88,
+  0x00,0x01,0xF8,0x0D,0x86,0x00,0x03,0xE0,0x1F,0xF8,0x0F,0x86,
+  0x00,0x03,0xE0,0x1F,0xF8,0x0D,0x88,0x00,0x01,0xF8,0x0C,0x88,
+  0x00,0x01,0x78,0x0C,0x88,0x00,0x01,0x38,0x0C,0x88,0x00,0x01,
+  0x18,0x0C,0xDC,0x00
+};
 #endif
-  },
-  { //clock-logo
-		0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x7D,0x01,0x7D,0x01,0x7D,0x01,0x01,0x71,0x01,
-		0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x00,0xF8,0x00,
-		0x55,0x55,0x55,0xFF,0x55,0xFF,0x55,0xFF,0x55,0xFF,0xFF,0x55,
-		0x00,0x00,0x00,0xEE,0x00,0xEE,0x00,0xEE,0x00,0xFE,0xFF,0x01,
-		0x01,0x01,0x01,0xEF,0x01,0xEF,0x01,0xEF,0x01,0xFF,0xFF,0x01,
-		0x00,0x00,0x00,0xC7,0x01,0xC7,0x01,0xC7,0x01,0x07,0xF8,0x00,
-		0x01,0x01,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0x07,0x71,0x01,
-		0x00,0x00,0x00,0xC7,0x01,0xC7,0x00,0xC7,0x01,0x07,0x00,0x00,
-		0x01,0x01,0x81,0x83,0x83,0x43,0x81,0x83,0x83,0x03,0x01,0x01,
-		0x00,0x00,0x80,0x83,0x83,0x43,0x84,0x83,0x83,0x03,0x00,0x00,
-		0x55,0x55,0xD5,0xD7,0xD7,0x57,0xD5,0xD7,0xD7,0x57,0x55,0x55,
-		0x00,0x00,0xC0,0x01,0xC7,0x01,0xC6,0x01,0xC7,0x01,0x00,0x00,
-		0x01,0x1D,0xC1,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0x01,0x01,
-		0x00,0x3E,0xC0,0x01,0xC7,0x01,0xC7,0x01,0xC7,0x01,0x00,0x00,
-		0x01,0xFF,0xFF,0x01,0xEF,0x01,0xEF,0x01,0xEF,0x01,0x01,0x01,
-		0x00,0xFF,0xFF,0x00,0xEE,0x00,0xEE,0x00,0xEE,0x00,0x00,0x00,
-		0x01,0xFF,0xFF,0x01,0xEF,0x01,0xEF,0x01,0xEF,0x01,0x01,0x01,
-		0x00,0x3E,0x00,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,
-		0x55,0x5D,0x55,0x55,0x7D,0x55,0x7D,0x55,0x7D,0x55,0x55,0x55,
-		0x00,0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x38,0x00,0x38,0x00,0x38,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x39,0x01,0x39,0x01,0x39,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-		0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
-		0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  },
-  { // clock-fish
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x03,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xE0,0xFC,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x50,0x03,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xD8,0x00,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x36,0xC8,0x98,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x15,0x30,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x0D,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x80,0x85,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x80,0x02,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x40,0xA0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x4E,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x52,0x48,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x24,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x38,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x20,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x20,0x16,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x10,0xE8,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x10,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x20,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x20,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x20,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x20,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x40,0xFC,0xE7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x80,0x00,0x58,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x40,0x1C,0x60,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x20,0x63,0x82,0x0D,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xE0,0x80,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x02,0x16,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x2F,0x34,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x11,0x28,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xBE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x40,0x40,0x0E,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x40,0x42,0x09,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x80,0x88,0x04,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x80,0x80,0x03,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0xE0,0x80,0x00,0x00,0x00,0x00,0xC0,0x01,
-    0x00,0x00,0x00,0x00,0x10,0x8D,0x00,0x00,0x00,0x06,0x30,0x01,
-    0x00,0x00,0x00,0x00,0xF0,0x02,0x01,0x00,0xC0,0xF9,0x8F,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x14,0x01,0x00,0xA0,0x06,0x40,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x84,0x00,0x00,0xB0,0x01,0x8E,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x88,0x00,0x00,0x6C,0x90,0x31,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x90,0x00,0x00,0x2A,0x60,0xC0,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x1A,0x10,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x3D,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x22,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x1F,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9C,0x80,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xA4,0x90,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0x44,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x40,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xC0,0x01,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x2C,0x02,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xD0,0x03,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x0A,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x08,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x04,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x02,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-  },
-  { // clock-hanzi
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x14,0x08,0x04,0xfc,0x1f,0x80,0x00,0x00,0x14,0x40,0x00,
-   0x00,0x24,0x08,0x04,0x80,0x00,0x80,0x00,0x00,0x24,0x20,0x02,
-   0xff,0x7f,0x08,0x0a,0xfe,0x7f,0xfe,0x3f,0xff,0x7f,0x10,0x04,
-   0x00,0x04,0x08,0x11,0x82,0x40,0x80,0x00,0x00,0x04,0xf8,0x0f,
-   0xfc,0x05,0xbf,0x20,0xb9,0x2e,0xf8,0x0f,0xfc,0x05,0x40,0x00,
-   0x00,0x04,0x48,0x40,0x80,0x00,0x00,0x00,0x00,0x04,0xfe,0x3f,
-   0xfe,0x05,0x88,0x3f,0xb8,0x0e,0xfe,0x7f,0xfe,0x05,0x10,0x04,
-   0x00,0x04,0x28,0x00,0x40,0x01,0x02,0x40,0x00,0x04,0x08,0x08,
-   0xfc,0x05,0x18,0x00,0x30,0x06,0xf9,0x2f,0xfc,0x05,0xe4,0x13,
-   0x04,0x09,0x8c,0x3f,0x4c,0x18,0x00,0x00,0x04,0x09,0x03,0x60,
-   0x24,0x09,0x8b,0x20,0x83,0x60,0xf8,0x0f,0x24,0x09,0x00,0x00,
-   0x24,0x09,0x88,0x20,0xf8,0x07,0x08,0x08,0x24,0x09,0xf0,0x07,
-   0x24,0x51,0x88,0x20,0x00,0x04,0xf8,0x0f,0x24,0x51,0x00,0x00,
-   0x50,0x50,0x88,0x20,0x60,0x02,0x10,0x04,0x50,0x50,0x00,0x00,
-   0x88,0x60,0x8a,0x3f,0x80,0x01,0x20,0x02,0x88,0x60,0xfc,0x1f,
-   0x06,0x41,0x84,0x20,0x00,0x02,0xff,0x7f,0x06,0x41,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x04,0x10,0x00,0x00,0x04,0x04,0x01,0x04,0x20,0x00,0x01,
-   0x7c,0x04,0xd0,0x3f,0x3e,0x04,0x08,0x01,0xe4,0x23,0x00,0x01,
-   0x04,0x3f,0x10,0x02,0x22,0x04,0x00,0x39,0x24,0x22,0x3f,0x01,
-   0x04,0x24,0x08,0x02,0x92,0x3f,0xe2,0x07,0x24,0x2a,0x08,0x1f,
-   0xbc,0x7f,0x08,0x02,0x12,0x04,0x04,0x01,0x3f,0x2a,0x88,0x10,
-   0x04,0x24,0x0c,0x02,0x0a,0x04,0x10,0x21,0xe4,0x2b,0x88,0x10,
-   0x04,0x3f,0xcc,0x1f,0x12,0x04,0x08,0x21,0x44,0x28,0xbe,0x08,
-   0x3c,0x04,0x0a,0x11,0xd2,0x7f,0x06,0x3e,0x54,0x28,0x48,0x08,
-   0x04,0x04,0x09,0x11,0x22,0x04,0x84,0x00,0xec,0x2b,0x08,0x04,
-   0x84,0x3f,0x08,0x11,0x22,0x04,0x80,0x00,0x47,0x2a,0x08,0x04,
-   0x7f,0x04,0x08,0x11,0xa2,0x24,0xff,0x7f,0x44,0x2a,0x08,0x0a,
-   0x04,0x04,0x88,0x10,0x96,0x24,0xa0,0x02,0x44,0x2a,0x38,0x0a,
-   0xa4,0x7f,0x88,0x10,0x8a,0x24,0x90,0x04,0x24,0x22,0x07,0x11,
-   0x42,0x04,0x88,0x10,0x82,0x24,0x8c,0x18,0x24,0x22,0x82,0x10,
-   0x7f,0x04,0xe8,0x7f,0x82,0x3f,0x83,0x60,0x95,0x2a,0x40,0x20,
-   0x42,0x04,0x08,0x00,0x02,0x20,0x80,0x00,0x0a,0x11,0x20,0x40,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0xff,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0xbf,0x7f,0x10,0x04,0x00,0x14,0x40,0x00,0x00,0x04,0x10,0x00,
-   0xbf,0x7f,0x10,0x04,0x00,0x24,0x20,0x02,0x7c,0x04,0xd0,0x3f,
-   0xbf,0x7f,0xff,0x7d,0xff,0x7f,0x10,0x04,0x04,0x3f,0x10,0x02,
-   0x3f,0x40,0x10,0x22,0x00,0x04,0xf8,0x0f,0x04,0x24,0x08,0x02,
-   0xbf,0x7f,0xfe,0x25,0xfc,0x05,0x40,0x00,0xbc,0x7f,0x08,0x02,
-   0xbf,0x7f,0x92,0x24,0x00,0x04,0xfe,0x3f,0x04,0x24,0x0c,0x02,
-   0x03,0x70,0xfe,0x14,0xfe,0x05,0x10,0x04,0x04,0x3f,0xcc,0x1f,
-   0xfb,0x77,0x54,0x08,0x00,0x04,0x08,0x08,0x3c,0x04,0x0a,0x11,
-   0xfb,0x77,0x92,0x14,0xfc,0x05,0xe4,0x13,0x04,0x04,0x09,0x11,
-   0xfb,0x77,0x11,0x62,0x04,0x09,0x03,0x60,0x84,0x3f,0x08,0x11,
-   0x03,0x70,0x00,0x00,0x24,0x09,0x00,0x00,0x7f,0x04,0x08,0x11,
-   0xff,0x7f,0xfe,0x3f,0x24,0x09,0xf0,0x07,0x04,0x04,0x88,0x10,
-   0xdb,0x6e,0x80,0x00,0x24,0x51,0x00,0x00,0xa4,0x7f,0x88,0x10,
-   0xbb,0x5d,0x88,0x1f,0x50,0x50,0x00,0x00,0x42,0x04,0x88,0x10,
-   0xbd,0x5d,0x88,0x00,0x88,0x60,0xfc,0x1f,0x7f,0x04,0xe8,0x7f,
-   0xfe,0x5f,0xff,0x7f,0x06,0x41,0x00,0x00,0x42,0x04,0x08,0x00,
-   0xff,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x08,0x04,0xfc,0x1f,0x80,0x00,0x00,0x14,0x40,0x00,0x00,0x04,
-   0x08,0x04,0x80,0x00,0x80,0x00,0x00,0x24,0x20,0x02,0x7c,0x04,
-   0x08,0x0a,0xfe,0x7f,0xfe,0x3f,0xff,0x7f,0x10,0x04,0x04,0x3f,
-   0x08,0x11,0x82,0x40,0x80,0x00,0x00,0x04,0xf8,0x0f,0x04,0x24,
-   0xbf,0x20,0xb9,0x2e,0xf8,0x0f,0xfc,0x05,0x40,0x00,0xbc,0x7f,
-   0x48,0x40,0x80,0x00,0x00,0x00,0x00,0x04,0xfe,0x3f,0x04,0x24,
-   0x88,0x3f,0xb8,0x0e,0xfe,0x7f,0xfe,0x05,0x10,0x04,0x04,0x3f,
-   0x28,0x00,0x40,0x01,0x02,0x40,0x00,0x04,0x08,0x08,0x3c,0x04,
-   0x18,0x00,0x30,0x06,0xf9,0x2f,0xfc,0x05,0xe4,0x13,0x04,0x04,
-   0x8c,0x3f,0x4c,0x18,0x00,0x00,0x04,0x09,0x03,0x60,0x84,0x3f,
-   0x8b,0x20,0x83,0x60,0xf8,0x0f,0x24,0x09,0x00,0x00,0x7f,0x04,
-   0x88,0x20,0xf8,0x07,0x08,0x08,0x24,0x09,0xf0,0x07,0x04,0x04,
-   0x88,0x20,0x00,0x04,0xf8,0x0f,0x24,0x51,0x00,0x00,0xa4,0x7f,
-   0x88,0x20,0x60,0x02,0x10,0x04,0x50,0x50,0x00,0x00,0x42,0x04,
-   0x8a,0x3f,0x80,0x01,0x20,0x02,0x88,0x60,0xfc,0x1f,0x7f,0x04,
-   0x84,0x20,0x00,0x02,0xff,0x7f,0x06,0x41,0x00,0x00,0x42,0x04,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x10,0x00,0x00,0x04,0x04,0x01,0x04,0x20,0x00,0x01,0x00,0x02,
-   0xd0,0x3f,0x3e,0x04,0x08,0x01,0xe4,0x23,0x00,0x01,0x20,0x02,
-   0x10,0x02,0x22,0x04,0x00,0x39,0x24,0x22,0x3f,0x01,0x20,0x04,
-   0x08,0x02,0x92,0x3f,0xe2,0x07,0x24,0x2a,0x08,0x1f,0x10,0x04,
-   0x08,0x02,0x12,0x04,0x04,0x01,0x3f,0x2a,0x88,0x10,0x08,0x08,
-   0x0c,0x02,0x0a,0x04,0x10,0x21,0xe4,0x2b,0x88,0x10,0x04,0x10,
-   0xcc,0x1f,0x12,0x04,0x08,0x21,0x44,0x28,0xbe,0x08,0x02,0x20,
-   0x0a,0x11,0xd2,0x7f,0x06,0x3e,0x54,0x28,0x48,0x08,0xf9,0x47,
-   0x09,0x11,0x22,0x04,0x84,0x00,0xec,0x2b,0x08,0x04,0x20,0x04,
-   0x08,0x11,0x22,0x04,0x80,0x00,0x47,0x2a,0x08,0x04,0x20,0x04,
-   0x08,0x11,0xa2,0x24,0xff,0x7f,0x44,0x2a,0x08,0x0a,0x20,0x04,
-   0x88,0x10,0x96,0x24,0xa0,0x02,0x44,0x2a,0x38,0x0a,0x10,0x04,
-   0x88,0x10,0x8a,0x24,0x90,0x04,0x24,0x22,0x07,0x11,0x10,0x04,
-   0x88,0x10,0x82,0x24,0x8c,0x18,0x24,0x22,0x82,0x10,0x08,0x04,
-   0xe8,0x7f,0x82,0x3f,0x83,0x60,0x95,0x2a,0x40,0x20,0x84,0x02,
-   0x08,0x00,0x02,0x20,0x80,0x00,0x0a,0x11,0x20,0x40,0x02,0x01,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
- },
- { // notif
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x7f,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x48,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x5d,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x4f,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x47,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x4f,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x5d,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x90,0x48,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x7f,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0f,
-   0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
-   0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,
-   0xf0,0x81,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0f,
-   0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0xff,0xff,0xff,0xff,0xff,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-   0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
-},
- { // City
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7f,0xff,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xfe,0xff,0xff,
-     0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xfc,0xff,0xff,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xf8,0xff,0xff,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xf8,0xff,0xff,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xf8,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0xf8,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x0f,0xf8,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x07,0xf0,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0xe0,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xf8,0xff,0xff,0xff,0x03,0xe0,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xf0,0xff,0xff,0xff,0x03,0xe0,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0xc0,0xff,0xff,0xff,0x03,0xe0,0x7f,0xe0,
-     0x00,0xfe,0xff,0xff,0x80,0xff,0xff,0xff,0x03,0xe0,0x3f,0xe0,
-     0x00,0xfe,0xff,0xff,0x00,0xff,0xff,0xff,0x03,0xe0,0x1f,0xe0,
-     0x00,0xfe,0xff,0xff,0x00,0xfe,0xff,0xff,0x03,0xe0,0x0f,0xe0,
-     0x00,0xfe,0xff,0xff,0x00,0xfc,0xff,0xff,0x03,0xe0,0x0f,0xe0,
-     0x00,0xfe,0x3f,0xe0,0x00,0xfc,0x07,0xfe,0x03,0xe0,0x0f,0xe0,
-     0x00,0xfe,0x3f,0xe0,0x00,0xf8,0x07,0xfe,0x03,0xe0,0x07,0xe0,
-     0x00,0xfe,0x3f,0xe0,0x00,0xf8,0x07,0xfe,0x03,0xe0,0x01,0x00,
-     0x00,0xfe,0x3f,0xe0,0x00,0xf8,0x07,0xfe,0x03,0xe0,0x01,0x00,
-     0x00,0xfe,0x3f,0xe0,0x00,0xf8,0x03,0xfe,0x03,0xe0,0x01,0x00,
-     0x00,0xfe,0x3f,0xe0,0x00,0x38,0x00,0xfe,0x03,0xe0,0x01,0x00,
-     0x00,0xfe,0x3e,0xe0,0x00,0x38,0x00,0x7e,0x00,0xe0,0x01,0x00,
-     0x00,0xfe,0x3e,0xe0,0x00,0x38,0x00,0x3e,0x00,0x20,0x00,0x00,
-     0x00,0xfe,0x3e,0xe0,0x00,0x38,0x00,0x3e,0x00,0x20,0x00,0x00,
-     0x00,0x4e,0x3e,0xe0,0x00,0x38,0x00,0x30,0x00,0x20,0x00,0x00,
-     0x00,0x06,0x3c,0xe0,0x00,0x38,0x00,0x30,0x00,0x20,0x00,0x00,
-     0x00,0x02,0x38,0xe0,0x00,0x38,0x00,0x30,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x38,0xe0,0x00,0x38,0x00,0x30,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x38,0xe0,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x38,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x38,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x38,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-     0x00,0x00
- }
+
+static unsigned char const TEMPLATE_MEM TmplWgtLogo[] =
+{ // clock-logo
+  0x8A,0x55,0x8A,0x00,0x8A,0x01,0x8A,0x00,0x8A,0x01,0x8A,0x00,
+  0x8A,0x01,0x8A,0x00,0x8A,0x55,0x8A,0x00,0x8A,0x01,0x8A,0x00,
+  0x8A,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB7,0x00,0x8A,0x01,
+  0x8A,0x00,0x8A,0x01,0x8A,0x00,0x8A,0x01,0x8A,0x00,0x8A,0x55,
+  0x8A,0x00,0x81,0x01,0x04,0x39,0x01,0x39,0x01,0x39,0x82,0x01,
+  0x81,0x00,0x04,0x38,0x00,0x38,0x00,0x38,0x82,0x00,0x81,0x01,
+  0x04,0x39,0x01,0x39,0x01,0x39,0x82,0x01,0x81,0x00,0x04,0x7C,
+  0x00,0x7C,0x00,0x7C,0x82,0x00,0x81,0x01,0x08,0x7D,0x01,0x7D,
+  0x01,0x7D,0x01,0x01,0x71,0x01,0x81,0x00,0x08,0x7C,0x00,0x7C,
+  0x00,0x7C,0x00,0x00,0xF8,0x00,0x81,0x55,0x08,0xFF,0x55,0xFF,
+  0x55,0xFF,0x55,0xFF,0xFF,0x55,0x81,0x00,0x07,0xEE,0x00,0xEE,
+  0x00,0xEE,0x00,0xFE,0xFF,0x82,0x01,0x08,0xEF,0x01,0xEF,0x01,
+  0xEF,0x01,0xFF,0xFF,0x01,0x81,0x00,0x08,0xC7,0x01,0xC7,0x01,
+  0xC7,0x01,0x07,0xF8,0x00,0x81,0x01,0x08,0xC7,0x01,0xC7,0x01,
+  0xC7,0x01,0x07,0x71,0x01,0x81,0x00,0x41,0xC7,0x01,0xC7,0x00,
+  0xC7,0x01,0x07,0x00,0x00,0x01,0x01,0x81,0x83,0x83,0x43,0x81,
+  0x83,0x83,0x03,0x01,0x01,0x00,0x00,0x80,0x83,0x83,0x43,0x84,
+  0x83,0x83,0x03,0x00,0x00,0x55,0x55,0xD5,0xD7,0xD7,0x57,0xD5,
+  0xD7,0xD7,0x57,0x55,0x55,0x00,0x00,0xC0,0x01,0xC7,0x01,0xC6,
+  0x01,0xC7,0x01,0x00,0x00,0x01,0x1D,0xC1,0x01,0xC7,0x01,0xC7,
+  0x01,0xC7,0x81,0x01,0x14,0x00,0x3E,0xC0,0x01,0xC7,0x01,0xC7,
+  0x01,0xC7,0x01,0x00,0x00,0x01,0xFF,0xFF,0x01,0xEF,0x01,0xEF,
+  0x01,0xEF,0x81,0x01,0x08,0x00,0xFF,0xFF,0x00,0xEE,0x00,0xEE,
+  0x00,0xEE,0x81,0x00,0x08,0x01,0xFF,0xFF,0x01,0xEF,0x01,0xEF,
+  0x01,0xEF,0x81,0x01,0x08,0x00,0x3E,0x00,0x00,0x7C,0x00,0x7C,
+  0x00,0x7C,0x81,0x00,0x08,0x55,0x5D,0x55,0x55,0x7D,0x55,0x7D,
+  0x55,0x7D,0x81,0x55,0x82,0x00,0x04,0x7C,0x00,0x7C,0x00,0x7C,
+  0x81,0x00,0x82,0x01,0x04,0x39,0x01,0x39,0x01,0x39,0x81,0x01,
+  0x82,0x00,0x04,0x38,0x00,0x38,0x00,0x38,0x81,0x00,0x82,0x01,
+  0x04,0x39,0x01,0x39,0x01,0x39,0x81,0x01,0x8A,0x00,0x8A,0x01,
+  0x8A,0x00,0x8A,0x55,0x8A,0x00,0x8A,0x01,0x8A,0x00,0x8A,0x01,
+  0x8A,0x00,0x8A,0x01,0x8A,0x00
 };
 
-#if __IAR_SYSTEMS_ICC__
-unsigned char const __data20 pTemplate2Q[][BYTES_PER_HALF_SCREEN] =
-#else
-unsigned char const pTemplate2Q[][BYTES_PER_HALF_SCREEN] =
-#endif
+static unsigned char const TEMPLATE_MEM TmplWgtFish[] =
+{ // clock-fish
+  0xEE,0x00,0x00,0xE0,0x88,0x00,0x01,0x03,0x98,0x87,0x00,0x02,
+  0xE0,0xFC,0x47,0x87,0x00,0x02,0x50,0x03,0x20,0x87,0x00,0x02,
+  0xD8,0x00,0x47,0x87,0x00,0x02,0x36,0xC8,0x98,0x87,0x00,0x02,
+  0x15,0x30,0xE0,0x87,0x00,0x01,0x0D,0x08,0x87,0x00,0x02,0x80,
+  0x85,0x1E,0x87,0x00,0x02,0x80,0x02,0x11,0x87,0x00,0x02,0x40,
+  0xA0,0x0F,0x87,0x00,0x01,0x4E,0x40,0x88,0x00,0x01,0x52,0x48,
+  0x88,0x00,0x01,0x24,0x22,0x88,0x00,0x01,0x38,0x20,0x88,0x00,
+  0x01,0x20,0xE0,0x88,0x00,0x02,0x20,0x16,0x01,0x87,0x00,0x02,
+  0x10,0xE8,0x01,0x87,0x00,0x01,0x10,0x05,0x88,0x00,0x01,0x20,
+  0x04,0x88,0x00,0x01,0x20,0x02,0x88,0x00,0x01,0x20,0x01,0x88,
+  0x00,0x00,0xC0,0xFF,0x00,0xFF,0x00,0x90,0x00,0x00,0xE0,0x89,
+  0x00,0x02,0x20,0x03,0x18,0x87,0x00,0x02,0x40,0xFC,0xE7,0x87,
+  0x00,0x03,0x80,0x00,0x58,0x01,0x86,0x00,0x03,0x40,0x1C,0x60,
+  0x03,0x86,0x00,0x03,0x20,0x63,0x82,0x0D,0x86,0x00,0x03,0xE0,
+  0x80,0x01,0x15,0x88,0x00,0x01,0x02,0x16,0x88,0x00,0x01,0x2F,
+  0x34,0x88,0x00,0x01,0x11,0x28,0x88,0x00,0x01,0xBE,0x40,0x88,
+  0x00,0x80,0x40,0x00,0x0E,0x87,0x00,0x02,0x40,0x42,0x09,0x87,
+  0x00,0x02,0x80,0x88,0x04,0x87,0x00,0x80,0x80,0x00,0x03,0x87,
+  0x00,0x01,0xE0,0x80,0x82,0x00,0x01,0xC0,0x01,0x82,0x00,0x01,
+  0x10,0x8D,0x81,0x00,0x02,0x06,0x30,0x01,0x82,0x00,0x06,0xF0,
+  0x02,0x01,0x00,0xC0,0xF9,0x8F,0x84,0x00,0x05,0x14,0x01,0x00,
+  0xA0,0x06,0x40,0x84,0x00,0x05,0x84,0x00,0x00,0xB0,0x01,0x8E,
+  0x84,0x00,0x06,0x88,0x00,0x00,0x6C,0x90,0x31,0x01,0x83,0x00,
+  0x06,0x90,0x00,0x00,0x2A,0x60,0xC0,0x01,0x83,0x00,0x04,0x60,
+  0x00,0x00,0x1A,0x10,0x88,0x00,0x01,0x0B,0x3D,0x88,0x00,0x01,
+  0x05,0x22,0x87,0x00,0x02,0x80,0x40,0x1F,0x87,0x00,0x01,0x9C,
+  0x80,0x88,0x00,0x01,0xA4,0x90,0x88,0x00,0x01,0x48,0x44,0x88,
+  0x00,0x01,0x70,0x40,0x88,0x00,0x02,0x40,0xC0,0x01,0x87,0x00,
+  0x02,0x40,0x2C,0x02,0x87,0x00,0x02,0x20,0xD0,0x03,0x87,0x00,
+  0x01,0x20,0x0A,0x88,0x00,0x01,0x40,0x08,0x88,0x00,0x01,0x40,
+  0x04,0x88,0x00,0x01,0x40,0x02,0x88,0x00,0x01,0x80,0x01,0xB1,
+  0x00
+};
+
+static unsigned char const TEMPLATE_MEM TmplWgtHanzi[] =
+{ // clock-hanzi
+  0x97,0x00,0x3F,0x14,0x08,0x04,0xFC,0x1F,0x80,0x00,0x00,0x14,
+  0x40,0x00,0x00,0x24,0x08,0x04,0x80,0x00,0x80,0x00,0x00,0x24,
+  0x20,0x02,0xFF,0x7F,0x08,0x0A,0xFE,0x7F,0xFE,0x3F,0xFF,0x7F,
+  0x10,0x04,0x00,0x04,0x08,0x11,0x82,0x40,0x80,0x00,0x00,0x04,
+  0xF8,0x0F,0xFC,0x05,0xBF,0x20,0xB9,0x2E,0xF8,0x0F,0xFC,0x05,
+  0x40,0x00,0x00,0x04,0x48,0x40,0x80,0x82,0x00,0x78,0x04,0xFE,
+  0x3F,0xFE,0x05,0x88,0x3F,0xB8,0x0E,0xFE,0x7F,0xFE,0x05,0x10,
+  0x04,0x00,0x04,0x28,0x00,0x40,0x01,0x02,0x40,0x00,0x04,0x08,
+  0x08,0xFC,0x05,0x18,0x00,0x30,0x06,0xF9,0x2F,0xFC,0x05,0xE4,
+  0x13,0x04,0x09,0x8C,0x3F,0x4C,0x18,0x00,0x00,0x04,0x09,0x03,
+  0x60,0x24,0x09,0x8B,0x20,0x83,0x60,0xF8,0x0F,0x24,0x09,0x00,
+  0x00,0x24,0x09,0x88,0x20,0xF8,0x07,0x08,0x08,0x24,0x09,0xF0,
+  0x07,0x24,0x51,0x88,0x20,0x00,0x04,0xF8,0x0F,0x24,0x51,0x00,
+  0x00,0x50,0x50,0x88,0x20,0x60,0x02,0x10,0x04,0x50,0x50,0x00,
+  0x00,0x88,0x60,0x8A,0x3F,0x80,0x01,0x20,0x02,0x88,0x60,0xFC,
+  0x1F,0x06,0x41,0x84,0x20,0x00,0x02,0xFF,0x7F,0x06,0x41,0xA5,
+  0x00,0x7F,0x04,0x10,0x00,0x00,0x04,0x04,0x01,0x04,0x20,0x00,
+  0x01,0x7C,0x04,0xD0,0x3F,0x3E,0x04,0x08,0x01,0xE4,0x23,0x00,
+  0x01,0x04,0x3F,0x10,0x02,0x22,0x04,0x00,0x39,0x24,0x22,0x3F,
+  0x01,0x04,0x24,0x08,0x02,0x92,0x3F,0xE2,0x07,0x24,0x2A,0x08,
+  0x1F,0xBC,0x7F,0x08,0x02,0x12,0x04,0x04,0x01,0x3F,0x2A,0x88,
+  0x10,0x04,0x24,0x0C,0x02,0x0A,0x04,0x10,0x21,0xE4,0x2B,0x88,
+  0x10,0x04,0x3F,0xCC,0x1F,0x12,0x04,0x08,0x21,0x44,0x28,0xBE,
+  0x08,0x3C,0x04,0x0A,0x11,0xD2,0x7F,0x06,0x3E,0x54,0x28,0x48,
+  0x08,0x04,0x04,0x09,0x11,0x22,0x04,0x84,0x00,0xEC,0x2B,0x08,
+  0x04,0x84,0x3F,0x08,0x11,0x22,0x04,0x80,0x00,0x47,0x2A,0x08,
+  0x04,0x7F,0x04,0x08,0x11,0xA2,0x24,0xFF,0x7F,0x44,0x3E,0x2A,
+  0x08,0x0A,0x04,0x04,0x88,0x10,0x96,0x24,0xA0,0x02,0x44,0x2A,
+  0x38,0x0A,0xA4,0x7F,0x88,0x10,0x8A,0x24,0x90,0x04,0x24,0x22,
+  0x07,0x11,0x42,0x04,0x88,0x10,0x82,0x24,0x8C,0x18,0x24,0x22,
+  0x82,0x10,0x7F,0x04,0xE8,0x7F,0x82,0x3F,0x83,0x60,0x95,0x2A,
+  0x40,0x20,0x42,0x04,0x08,0x00,0x02,0x20,0x80,0x00,0x0A,0x11,
+  0x20,0x40,0x96,0x00,0x01,0xFF,0x7F,0x88,0x00,0x7F,0xBF,0x7F,
+  0x10,0x04,0x00,0x14,0x40,0x00,0x00,0x04,0x10,0x00,0xBF,0x7F,
+  0x10,0x04,0x00,0x24,0x20,0x02,0x7C,0x04,0xD0,0x3F,0xBF,0x7F,
+  0xFF,0x7D,0xFF,0x7F,0x10,0x04,0x04,0x3F,0x10,0x02,0x3F,0x40,
+  0x10,0x22,0x00,0x04,0xF8,0x0F,0x04,0x24,0x08,0x02,0xBF,0x7F,
+  0xFE,0x25,0xFC,0x05,0x40,0x00,0xBC,0x7F,0x08,0x02,0xBF,0x7F,
+  0x92,0x24,0x00,0x04,0xFE,0x3F,0x04,0x24,0x0C,0x02,0x03,0x70,
+  0xFE,0x14,0xFE,0x05,0x10,0x04,0x04,0x3F,0xCC,0x1F,0xFB,0x77,
+  0x54,0x08,0x00,0x04,0x08,0x08,0x3C,0x04,0x0A,0x11,0xFB,0x77,
+  0x92,0x14,0xFC,0x05,0xE4,0x13,0x04,0x04,0x09,0x11,0xFB,0x77,
+  0x11,0x62,0x04,0x09,0x03,0x60,0x84,0x3F,0x08,0x11,0x03,0x70,
+  0x00,0x00,0x24,0x09,0x00,0x00,0x41,0x7F,0x04,0x08,0x11,0xFF,
+  0x7F,0xFE,0x3F,0x24,0x09,0xF0,0x07,0x04,0x04,0x88,0x10,0xDB,
+  0x6E,0x80,0x00,0x24,0x51,0x00,0x00,0xA4,0x7F,0x88,0x10,0xBB,
+  0x5D,0x88,0x1F,0x50,0x50,0x00,0x00,0x42,0x04,0x88,0x10,0xBD,
+  0x5D,0x88,0x00,0x88,0x60,0xFC,0x1F,0x7F,0x04,0xE8,0x7F,0xFE,
+  0x5F,0xFF,0x7F,0x06,0x41,0x00,0x00,0x42,0x04,0x08,0x00,0xFF,
+  0x7F,0xA0,0x00,0x3E,0x08,0x04,0xFC,0x1F,0x80,0x00,0x00,0x14,
+  0x40,0x00,0x00,0x04,0x08,0x04,0x80,0x00,0x80,0x00,0x00,0x24,
+  0x20,0x02,0x7C,0x04,0x08,0x0A,0xFE,0x7F,0xFE,0x3F,0xFF,0x7F,
+  0x10,0x04,0x04,0x3F,0x08,0x11,0x82,0x40,0x80,0x00,0x00,0x04,
+  0xF8,0x0F,0x04,0x24,0xBF,0x20,0xB9,0x2E,0xF8,0x0F,0xFC,0x05,
+  0x40,0x00,0xBC,0x7F,0x48,0x40,0x80,0x82,0x00,0x7C,0x04,0xFE,
+  0x3F,0x04,0x24,0x88,0x3F,0xB8,0x0E,0xFE,0x7F,0xFE,0x05,0x10,
+  0x04,0x04,0x3F,0x28,0x00,0x40,0x01,0x02,0x40,0x00,0x04,0x08,
+  0x08,0x3C,0x04,0x18,0x00,0x30,0x06,0xF9,0x2F,0xFC,0x05,0xE4,
+  0x13,0x04,0x04,0x8C,0x3F,0x4C,0x18,0x00,0x00,0x04,0x09,0x03,
+  0x60,0x84,0x3F,0x8B,0x20,0x83,0x60,0xF8,0x0F,0x24,0x09,0x00,
+  0x00,0x7F,0x04,0x88,0x20,0xF8,0x07,0x08,0x08,0x24,0x09,0xF0,
+  0x07,0x04,0x04,0x88,0x20,0x00,0x04,0xF8,0x0F,0x24,0x51,0x00,
+  0x00,0xA4,0x7F,0x88,0x20,0x60,0x02,0x10,0x04,0x50,0x50,0x00,
+  0x00,0x42,0x04,0x8A,0x3F,0x80,0x01,0x20,0x02,0x88,0x60,0xFC,
+  0x1F,0x7F,0x04,0x84,0x20,0x00,0x02,0xFF,0x7F,0x06,0x41,0x00,
+  0x00,0x42,0x04,0xA2,0x00,0x7F,0x10,0x00,0x00,0x04,0x04,0x01,
+  0x04,0x20,0x00,0x01,0x00,0x02,0xD0,0x3F,0x3E,0x04,0x08,0x01,
+  0xE4,0x23,0x00,0x01,0x20,0x02,0x10,0x02,0x22,0x04,0x00,0x39,
+  0x24,0x22,0x3F,0x01,0x20,0x04,0x08,0x02,0x92,0x3F,0xE2,0x07,
+  0x24,0x2A,0x08,0x1F,0x10,0x04,0x08,0x02,0x12,0x04,0x04,0x01,
+  0x3F,0x2A,0x88,0x10,0x08,0x08,0x0C,0x02,0x0A,0x04,0x10,0x21,
+  0xE4,0x2B,0x88,0x10,0x04,0x10,0xCC,0x1F,0x12,0x04,0x08,0x21,
+  0x44,0x28,0xBE,0x08,0x02,0x20,0x0A,0x11,0xD2,0x7F,0x06,0x3E,
+  0x54,0x28,0x48,0x08,0xF9,0x47,0x09,0x11,0x22,0x04,0x84,0x00,
+  0xEC,0x2B,0x08,0x04,0x20,0x04,0x08,0x11,0x22,0x04,0x80,0x00,
+  0x47,0x2A,0x08,0x04,0x20,0x04,0x08,0x11,0xA2,0x24,0xFF,0x7F,
+  0x44,0x2A,0x3F,0x08,0x0A,0x20,0x04,0x88,0x10,0x96,0x24,0xA0,
+  0x02,0x44,0x2A,0x38,0x0A,0x10,0x04,0x88,0x10,0x8A,0x24,0x90,
+  0x04,0x24,0x22,0x07,0x11,0x10,0x04,0x88,0x10,0x82,0x24,0x8C,
+  0x18,0x24,0x22,0x82,0x10,0x08,0x04,0xE8,0x7F,0x82,0x3F,0x83,
+  0x60,0x95,0x2A,0x40,0x20,0x84,0x02,0x08,0x00,0x02,0x20,0x80,
+  0x00,0x0A,0x11,0x20,0x40,0x02,0x01,0x96,0x00
+};
+
+static unsigned char const TEMPLATE_MEM TmplNotif[] =
+{ // notif
+  0xAC,0x00,0x01,0xF0,0x7F,0x88,0x00,0x01,0x10,0x40,0x88,0x00,
+  0x01,0x90,0x48,0x88,0x00,0x01,0xD0,0x5D,0x88,0x00,0x01,0x90,
+  0x4F,0x88,0x00,0x01,0x10,0x47,0x88,0x00,0x01,0x90,0x4F,0x88,
+  0x00,0x01,0xD0,0x5D,0x88,0x00,0x01,0x90,0x48,0x88,0x00,0x01,
+  0x10,0x40,0x88,0x00,0x01,0xF0,0x7F,0xAE,0x00,0x00,0xF0,0x88,
+  0xFF,0x01,0x0F,0x08,0x88,0x00,0x01,0x10,0x04,0x88,0x00,0x01,
+  0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,
+  0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,
+  0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,
+  0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,
+  0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,
+  0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,
+  0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,
+  0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,
+  0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,
+  0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,
+  0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,
+  0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,
+  0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,
+  0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,
+  0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,
+  0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,
+  0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,
+  0x01,0x20,0x04,0x88,0x00,0x01,0x20,0x04,0x88,0x00,0x01,0x20,
+  0x08,0x88,0x00,0x02,0x10,0xF0,0x81,0x87,0xFF,0x02,0x0F,0x00,
+  0x41,0x89,0x00,0x00,0x21,0x89,0x00,0x00,0x11,0x89,0x00,0x00,
+  0x09,0x89,0x00,0x00,0x05,0x89,0x00,0x00,0x03,0xFF,0x00,0xA9,
+  0x00,0x00,0xE0,0x83,0xFF,0x84,0x00,0x00,0xC0,0x83,0xFF,0x84,
+  0x00,0x00,0x80,0x83,0xFF,0x85,0x00,0x83,0xFF,0x84,0x00,0x00,
+  0x80,0x83,0xFF,0x84,0x00,0x00,0xC0,0x83,0xFF,0x84,0x00,0x00,
+  0xE0,0x83,0xFF,0xAE,0x00
+};
+
+static unsigned char const TEMPLATE_MEM TmplWgtCity[] =
+{ // City
+  0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x00,0x7F,
+  0x89,0xFF,0x00,0x7F,0x89,0xFF,0x00,0x7F,0x89,0xFF,0x00,0x7F,
+  0x89,0xFF,0x01,0x3F,0xFE,0x88,0xFF,0x05,0x1F,0xFC,0xFF,0xFF,
+  0x00,0xFE,0x84,0xFF,0x05,0x1F,0xF8,0xFF,0xFF,0x00,0xFE,0x84,
+  0xFF,0x05,0x1F,0xF8,0xFF,0xFF,0x00,0xFE,0x84,0xFF,0x05,0x1F,
+  0xF8,0x7F,0xE0,0x00,0xFE,0x84,0xFF,0x05,0x1F,0xF8,0x7F,0xE0,
+  0x00,0xFE,0x84,0xFF,0x05,0x0F,0xF8,0x7F,0xE0,0x00,0xFE,0x84,
+  0xFF,0x05,0x07,0xF0,0x7F,0xE0,0x00,0xFE,0x84,0xFF,0x08,0x03,
+  0xE0,0x7F,0xE0,0x00,0xFE,0xFF,0xFF,0xF8,0x81,0xFF,0x08,0x03,
+  0xE0,0x7F,0xE0,0x00,0xFE,0xFF,0xFF,0xF0,0x81,0xFF,0x08,0x03,
+  0xE0,0x7F,0xE0,0x00,0xFE,0xFF,0xFF,0xC0,0x81,0xFF,0x08,0x03,
+  0xE0,0x7F,0xE0,0x00,0xFE,0xFF,0xFF,0x80,0x81,0xFF,0x08,0x03,
+  0xE0,0x3F,0xE0,0x00,0xFE,0xFF,0xFF,0x00,0x81,0xFF,0x79,0x03,
+  0xE0,0x1F,0xE0,0x00,0xFE,0xFF,0xFF,0x00,0xFE,0xFF,0xFF,0x03,
+  0xE0,0x0F,0xE0,0x00,0xFE,0xFF,0xFF,0x00,0xFC,0xFF,0xFF,0x03,
+  0xE0,0x0F,0xE0,0x00,0xFE,0x3F,0xE0,0x00,0xFC,0x07,0xFE,0x03,
+  0xE0,0x0F,0xE0,0x00,0xFE,0x3F,0xE0,0x00,0xF8,0x07,0xFE,0x03,
+  0xE0,0x07,0xE0,0x00,0xFE,0x3F,0xE0,0x00,0xF8,0x07,0xFE,0x03,
+  0xE0,0x01,0x00,0x00,0xFE,0x3F,0xE0,0x00,0xF8,0x07,0xFE,0x03,
+  0xE0,0x01,0x00,0x00,0xFE,0x3F,0xE0,0x00,0xF8,0x03,0xFE,0x03,
+  0xE0,0x01,0x00,0x00,0xFE,0x3F,0xE0,0x00,0x38,0x00,0xFE,0x03,
+  0xE0,0x01,0x00,0x00,0xFE,0x3E,0xE0,0x00,0x38,0x00,0x7E,0x00,
+  0xE0,0x01,0x00,0x00,0xFE,0x3E,0xE0,0x00,0x38,0x00,0x3E,0x00,
+  0x20,0x81,0x00,0x08,0xFE,0x3E,0xE0,0x00,0x38,0x00,0x3E,0x00,
+  0x20,0x81,0x00,0x08,0x4E,0x3E,0xE0,0x00,0x38,0x00,0x30,0x00,
+  0x20,0x81,0x00,0x08,0x06,0x3C,0xE0,0x00,0x38,0x00,0x30,0x00,
+  0x20,0x81,0x00,0x06,0x02,0x38,0xE0,0x00,0x38,0x00,0x30,0x84,
+  0x00,0x05,0x38,0xE0,0x00,0x38,0x00,0x30,0x84,0x00,0x03,0x38,
+  0xE0,0x00,0x38,0x86,0x00,0x01,0x38,0xE0,0x88,0x00,0x01,0x38,
+  0xE0,0x88,0x00,0x01,0x38,0xE0,0xCE,0x00
+};
+
+tTemplate const pTemplate[] =
 {
-  {0}
+  TmplNotifEmpty,
+  TmplMusic,
+  TmplWgtLogo,
+  TmplWgtFish,
+  TmplWgtHanzi,
+  TmplNotif,
+  TmplWgtCity
+};
+
+static unsigned char const TEMPLATE_MEM Tmpl2QEmpty[] =
+{
+  0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBA,0x00
+};
+
+tTemplate const pTemplate2Q[] =
+{
+  Tmpl2QEmpty
 };
 
 /******************************************************************************/
@@ -892,106 +528,41 @@ unsigned char const pBootloader[BOOTLOADER_COLS * BOOTLOADER_ROWS] =
 	0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00
 };
 
-const unsigned char pWidgetTemplate[][6 * 48] =
+static unsigned char const TEMPLATE_MEM WgtTmplEmpty[] =
+{ // empty 1Q widget
+  0xB6,0x00,0x01,0xF8,0x0F,0x82,0x00,0x01,0x1E,0x3C,0x81,0x00,
+  0x02,0x80,0xE3,0xE3,0x81,0x00,0x7F,0xC0,0xFC,0x9F,0x01,0x00,
+  0x00,0x60,0x0F,0x78,0x03,0x00,0x00,0xB0,0x03,0xE0,0x06,0x00,
+  0x00,0xD8,0x00,0x80,0x0D,0x00,0x00,0x68,0xC0,0x01,0x0B,0x00,
+  0x00,0x6C,0xC0,0x01,0x1B,0x00,0x00,0x34,0xC0,0x01,0x16,0x00,
+  0x00,0x36,0xC0,0x01,0x36,0x00,0x00,0x16,0xC0,0x01,0x34,0x00,
+  0x00,0x1A,0xC0,0x01,0x2C,0x00,0x00,0x1A,0xFE,0x3F,0x2C,0x00,
+  0x00,0x1A,0xFE,0x3F,0x2C,0x00,0x00,0x1A,0xFE,0x3F,0x2C,0x00,
+  0x00,0x1A,0xC0,0x01,0x2C,0x00,0x00,0x16,0xC0,0x01,0x34,0x00,
+  0x00,0x36,0xC0,0x01,0x34,0x00,0x00,0x34,0xC0,0x01,0x16,0x00,
+  0x00,0x6C,0xC0,0x01,0x1B,0x00,0x00,0x68,0xC0,0x01,0x0B,0x00,
+  0x00,0xD8,0x00,0x80,0x0D,0x00,0x00,0xB0,0x03,0xE0,0x06,0x00,
+  0x00,0x60,0x0F,0x0C,0x70,0x03,0x00,0x00,0xC0,0xFC,0x9F,0x01,
+  0x00,0x00,0x80,0xE3,0xE3,0x82,0x00,0x01,0x1E,0x3C,0x82,0x00,
+  0x01,0xF8,0x0F,0xBC,0x00
+};
+
+static unsigned char const TEMPLATE_MEM WgtTmplLoading[] =
+{ // 1Q widget loading
+  0xBC,0x00,0x01,0xFC,0x7F,0x82,0x00,0x01,0xFE,0xFF,0x82,0x00,
+  0x01,0x06,0xC0,0x82,0x00,0x01,0x06,0xC1,0x82,0x00,0x01,0x06,
+  0xC1,0x82,0x00,0x01,0x06,0xC1,0x82,0x00,0x01,0x06,0xC1,0x82,
+  0x00,0x01,0x06,0xC1,0x82,0x00,0x01,0x86,0xC0,0x82,0x00,0x01,
+  0x46,0xC0,0x82,0x00,0x01,0x06,0xC0,0x82,0x00,0x01,0x06,0xC0,
+  0x82,0x00,0x01,0x06,0xC0,0x82,0x00,0x01,0xFE,0xFF,0x82,0x00,
+  0x01,0xFC,0x7F,0x82,0x00,0x01,0xFC,0x7F,0x92,0x00,0x1D,0x80,
+  0x60,0x88,0x73,0x91,0x01,0x80,0x90,0x88,0x24,0x53,0x00,0x80,
+  0x90,0x94,0x24,0x55,0x03,0x80,0x90,0x9C,0x24,0x59,0x02,0x80,
+  0x67,0xA2,0x73,0x91,0x01,0xD2,0x00
+};
+
+tTemplate const pWidgetTemplate[] =
 {
-  { // empty 1Q widget
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xF8,0x0F,0x00,0x00,
-    0x00,0x00,0x1E,0x3C,0x00,0x00,
-    0x00,0x80,0xE3,0xE3,0x00,0x00,
-    0x00,0xC0,0xFC,0x9F,0x01,0x00,
-    0x00,0x60,0x0F,0x78,0x03,0x00,
-    0x00,0xB0,0x03,0xE0,0x06,0x00,
-    0x00,0xD8,0x00,0x80,0x0D,0x00,
-    0x00,0x68,0xC0,0x01,0x0B,0x00,
-    0x00,0x6C,0xC0,0x01,0x1B,0x00,
-    0x00,0x34,0xC0,0x01,0x16,0x00,
-    0x00,0x36,0xC0,0x01,0x36,0x00,
-    0x00,0x16,0xC0,0x01,0x34,0x00,
-    0x00,0x1A,0xC0,0x01,0x2C,0x00,
-    0x00,0x1A,0xFE,0x3F,0x2C,0x00,
-    0x00,0x1A,0xFE,0x3F,0x2C,0x00,
-    0x00,0x1A,0xFE,0x3F,0x2C,0x00,
-    0x00,0x1A,0xC0,0x01,0x2C,0x00,
-    0x00,0x16,0xC0,0x01,0x34,0x00,
-    0x00,0x36,0xC0,0x01,0x34,0x00,
-    0x00,0x34,0xC0,0x01,0x16,0x00,
-    0x00,0x6C,0xC0,0x01,0x1B,0x00,
-    0x00,0x68,0xC0,0x01,0x0B,0x00,
-    0x00,0xD8,0x00,0x80,0x0D,0x00,
-    0x00,0xB0,0x03,0xE0,0x06,0x00,
-    0x00,0x60,0x0F,0x70,0x03,0x00,
-    0x00,0xC0,0xFC,0x9F,0x01,0x00,
-    0x00,0x80,0xE3,0xE3,0x00,0x00,
-    0x00,0x00,0x1E,0x3C,0x00,0x00,
-    0x00,0x00,0xF8,0x0F,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00
-  },
-  {// 1Q widget loading
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xFC,0x7F,0x00,0x00,
-    0x00,0x00,0xFE,0xFF,0x00,0x00,
-    0x00,0x00,0x06,0xC0,0x00,0x00,
-    0x00,0x00,0x06,0xC1,0x00,0x00,
-    0x00,0x00,0x06,0xC1,0x00,0x00,
-    0x00,0x00,0x06,0xC1,0x00,0x00,
-    0x00,0x00,0x06,0xC1,0x00,0x00,
-    0x00,0x00,0x06,0xC1,0x00,0x00,
-    0x00,0x00,0x86,0xC0,0x00,0x00,
-    0x00,0x00,0x46,0xC0,0x00,0x00,
-    0x00,0x00,0x06,0xC0,0x00,0x00,
-    0x00,0x00,0x06,0xC0,0x00,0x00,
-    0x00,0x00,0x06,0xC0,0x00,0x00,
-    0x00,0x00,0xFE,0xFF,0x00,0x00,
-    0x00,0x00,0xFC,0x7F,0x00,0x00,
-    0x00,0x00,0xFC,0x7F,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x80,0x60,0x88,0x73,0x91,0x01,
-    0x80,0x90,0x88,0x24,0x53,0x00,
-    0x80,0x90,0x94,0x24,0x55,0x03,
-    0x80,0x90,0x9C,0x24,0x59,0x02,
-    0x80,0x67,0xA2,0x73,0x91,0x01,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00
-  }
+  WgtTmplEmpty,
+  WgtTmplLoading
 };
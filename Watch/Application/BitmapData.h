@@ -46,24 +46,43 @@
 
 extern unsigned char const pBootloader[BOOTLOADER_COLS * BOOTLOADER_ROWS];
 
+/* Templates are run-length coded. A control byte below TMPL_RUN is followed
+ * by (control + 1) literal bytes; from TMPL_RUN up it is followed by one byte
+ * that repeats (control - TMPL_RUN + TMPL_RUN_MIN) times. Nothing marks the
+ * end, the reader knows the size of the screen, half screen or quad.
+ */
+#define TMPL_RUN                  (0x80)
+#define TMPL_RUN_MIN              (2)
+
 #if __IAR_SYSTEMS_ICC__
-extern unsigned char const __data20 pTemplate[][BYTES_PER_SCREEN];
+#define TEMPLATE_MEM              __data20
 #else
-extern unsigned char const pTemplate[][BYTES_PER_SCREEN];
+#define TEMPLATE_MEM
 #endif
 
-#define TEMPLATE_NUM       (sizeof(pTemplate) / BYTES_PER_SCREEN)
+typedef unsigned char const TEMPLATE_MEM *tTemplate;
 
-extern unsigned char const pWidgetTemplate[][6 * 48];
-#define WIDGET_TEMPLATE_NUM (sizeof(pWidgetTemplate) / (6 * 48))
+typedef struct
+{
+  tTemplate pSrc;
+  unsigned char Count; /* bytes left in the current run or literal */
+  unsigned char Repeat;
+} TemplateReader_t;
 
-#if __IAR_SYSTEMS_ICC__
-extern unsigned char const __data20 pTemplate2Q[][BYTES_PER_HALF_SCREEN];
-#else
-extern unsigned char const pTemplate2Q[][BYTES_PER_HALF_SCREEN];
-#endif
+extern tTemplate const pTemplate[];
+#define TEMPLATE_NUM        (7)
+
+extern tTemplate const pWidgetTemplate[];
+#define WIDGET_TEMPLATE_NUM (2)
+
+extern tTemplate const pTemplate2Q[];
+#define TEMPLATE_2Q_NUM     (1)
+
+/*! Decode a template from the start */
+void StartTemplate(TemplateReader_t *pReader, tTemplate pTemp);
 
-#define TEMPLATE_2Q_NUM    (sizeof(pTemplate2Q) / BYTES_PER_HALF_SCREEN)
+/*! Decode the next Length bytes of the template into pDst */
+void ReadTemplate(TemplateReader_t *pReader, unsigned char *pDst, unsigned int Length);
 
 #if __IAR_SYSTEMS_ICC__
 extern __data20 unsigned char const pWatchFace[][1]; //TEMPLATE_FLASH_SIZE];
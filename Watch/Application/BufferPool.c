@@ -0,0 +1,106 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BufferPool.c
+*
+* Free blocks are kept in a singly linked list threaded through the blocks
+* themselves. Blocks that were never handed out are taken from the end of the
+* array first so the pool needs no initialisation. Both calls only touch the
+* list head inside a critical section so they can be used from tasks and isrs.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "BufferPool.h"
+#include "Statistics.h"
+#include "DebugUart.h"
+
+typedef union _Block_t
+{
+  union _Block_t *pNext;
+  unsigned char Data[MSG_BUFFER_LENGTH];
+} Block_t;
+
+static Block_t Pool[BUFFER_POOL_SIZE];
+static Block_t *pFree = NULL;
+static unsigned char Untouched = 0;
+
+static unsigned char Used = 0;
+static unsigned char HighWater = 0;
+static unsigned int Empty = 0;
+static unsigned int Oversize = 0;
+
+unsigned char *GetPoolBuffer(unsigned int Length)
+{
+  Block_t *pBlock = NULL;
+
+  if (Length > MSG_BUFFER_LENGTH)
+  {
+    Oversize ++;
+    return NULL;
+  }
+
+  portENTER_CRITICAL();
+
+  if (pFree)
+  {
+    pBlock = pFree;
+    pFree = pFree->pNext;
+  }
+  else if (Untouched < BUFFER_POOL_SIZE) pBlock = &Pool[Untouched++];
+
+  if (pBlock)
+  {
+    if (++Used > HighWater) HighWater = Used;
+  }
+  else
+  {
+    Empty ++;
+    if (gAppStats.BufferPoolFailure < 0xFF) gAppStats.BufferPoolFailure ++;
+  }
+
+  portEXIT_CRITICAL();
+
+  return (unsigned char *)pBlock;
+}
+
+unsigned char ReleasePoolBuffer(unsigned char *pBuffer)
+{
+  if (pBuffer < (unsigned char *)Pool ||
+      pBuffer >= (unsigned char *)&Pool[BUFFER_POOL_SIZE]) return 0;
+
+  if ((pBuffer - (unsigned char *)Pool) % sizeof(Block_t))
+  {
+    PrintF("@Pool:%04X", pBuffer);
+    return 1;
+  }
+
+  portENTER_CRITICAL();
+  ((Block_t *)pBuffer)->pNext = pFree;
+  pFree = (Block_t *)pBuffer;
+  Used --;
+  portEXIT_CRITICAL();
+
+  return 1;
+}
+
+void ShowBufferPool(void)
+{
+  PrintF("Pool %u/%u Max:%u", Used, BUFFER_POOL_SIZE, HighWater);
+  PrintF("Empty:%u Big:%u", Empty, Oversize);
+}
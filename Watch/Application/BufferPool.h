@@ -0,0 +1,48 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BufferPool.h
+ *
+ * Fixed-size message buffers. Almost every message fits in MSG_BUFFER_LENGTH
+ * so these are handed out from a static pool in constant time instead of
+ * going through the heap. Larger messages still come from the heap.
+ */
+/******************************************************************************/
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+/*! number of MSG_BUFFER_LENGTH buffers in the pool (taken off the heap) */
+#define BUFFER_POOL_SIZE      32
+
+/*! Get a buffer of MSG_BUFFER_LENGTH bytes
+ *
+ * \param Length is the total buffer length the caller needs
+ * \return NULL if Length does not fit a pool buffer or the pool is empty
+ */
+unsigned char *GetPoolBuffer(unsigned int Length);
+
+/*! Give back a buffer obtained with GetPoolBuffer
+ *
+ * \return 0 if pBuffer is not a pool buffer (nothing is done)
+ */
+unsigned char ReleasePoolBuffer(unsigned char *pBuffer);
+
+/*! Print usage, high water mark and heap fallbacks of the pool */
+void ShowBufferPool(void);
+
+#endif /* BUFFER_POOL_H */
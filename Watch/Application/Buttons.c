@@ -113,6 +113,7 @@ static tButtonAction const DisconnAction[] =
   {BTN_E | IDLE_PAGE | BTN_EVT_IMDT, ChangeModeMsg, MUSIC_MODE | MSG_OPT_UPD_INTERNAL},
   
   {BTN_A | NOTIF_PAGE | BTN_EVT_IMDT, ChangeModeMsg, IDLE_MODE | MSG_OPT_UPD_INTERNAL},
+  {BTN_B | NOTIF_PAGE | BTN_EVT_IMDT, UpdateDisplayMsg, NOTIF_MODE | MSG_OPT_PRV_PAGE | MSG_OPT_UPD_INTERNAL},
   {BTN_C | NOTIF_PAGE | BTN_EVT_IMDT, UpdateDisplayMsg, NOTIF_MODE | MSG_OPT_NXT_PAGE | MSG_OPT_UPD_INTERNAL},
   {BTN_A | MUSIC_PAGE | BTN_EVT_IMDT, ChangeModeMsg, IDLE_MODE | MSG_OPT_UPD_INTERNAL},
 #if SUPPORT_HID
@@ -179,7 +179,7 @@ static void DrawCallNotification(unsigned char const *pVal, int Len)
 
 static void SetCallerNumber(unsigned char const *pNumber, unsigned char Len)
 {
-  pCallerNumber = (unsigned char *)pvPortMalloc(Len);
+  pCallerNumber = (unsigned char *)pvPortMallocFrom(Len, HEAP_SITE_CALLER);
   if (pCallerNumber) memcpy(pCallerNumber, pNumber, Len);
   NumberLen = Len;
 }
@@ -263,7 +263,7 @@ static void ClearSettingView(void)
 
 static void DrawCountdownTimer(void)
 {
-  char *pBuffer = (char *)pvPortMalloc(CDT_TIMER_LENGTH);
+  char *pBuffer = (char *)pvPortMallocFrom(CDT_TIMER_LENGTH, HEAP_SITE_COUNTDOWN);
 
   pBuffer[0] = Hour / 10 + ZERO;
   pBuffer[1] = Hour % 10 + ZERO;
@@ -34,6 +34,7 @@
 #include "task.h"
 #include "TermMode.h"
 #include "Wrapper.h"
+#include "BufferPool.h"
 
 #define DEBUG_BUFFER_SIZE   32
 #define ASCII_BEGIN         32
@@ -121,7 +122,7 @@ void EnableDebugUart(unsigned char Enable)
     xSemaphoreGive(UartMutex);
   }
   
-  if (Enable) Buffer = (char *)pvPortMalloc(DEBUG_BUFFER_SIZE);
+  if (Enable) Buffer = (char *)pvPortMallocFrom(DEBUG_BUFFER_SIZE, HEAP_SITE_DEBUG);
   else vPortFree(Buffer);
 
   DebugEnabled = Enable;
@@ -270,6 +271,9 @@ void vApplicationMallocFailedHook(void)
 
 void vApplicationFreeFailedHook(unsigned char * pBuffer)
 {
+  /* message buffers from the pool can come back through vPortFree */
+  if (ReleasePoolBuffer(pBuffer)) return;
+
   PrintF("@F:%04X", pBuffer);
   SoftwareReset(RESET_MEM_FREE, 0);
 }
@@ -288,6 +292,8 @@ void CheckStackAndQueueUsage(unsigned char Id)
   portBASE_TYPE Water = uxTaskGetStackHighWaterMark(NULL);
   portBASE_TYPE QueLen = QueueHandles[Id]->uxMessagesWaiting;
 
+  MessageServiced(Id);
+
   if (Water < 10 || QueLen > QUEUE_WARNING_LEN)
     PrintF("#%c S:%d Q:%u", Id == DISPLAY_QINDEX ? 'D' : 'W', Water, QueLen);
 }
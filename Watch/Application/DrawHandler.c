@@ -21,7 +21,7 @@
 #include "task.h"
 #include "Messages.h"
 #include "Adc.h"
-#include "hal_Battery.h"
+#include "hal_battery.h"
 #include "hal_lpm.h"
 #include "hal_miscellaneous.h"
 #include "hal_rtc.h"
@@ -75,75 +75,173 @@ static unsigned char const * (* const GetDrawData[])(Draw_t *) =
 
 #define FUNC_DRAW_DATA_NUM    (sizeof(GetDrawData) / sizeof(*GetDrawData))
 
+/* a multipart draw in progress
+ *
+ * Raw bitmaps are drawn straight from each message buffer as soon as whole
+ * rows have arrived; only a row split across two messages is copied into
+ * PartRow. Text, fills and idle bitmaps crossing the half screen line need
+ * the whole payload at once and are collected into a single buffer.
+ */
+#define MAX_ROW_BYTES         WIDTH_IN_BYTES(0xFF)
+
+static Draw_t PartInfo;
+static unsigned char PartActive = FALSE;
+static unsigned char PartMode;
+static unsigned int PartSize; // payload bytes expected
+static unsigned int PartReceived;
+static unsigned char *pPartData = NULL; // collected payload, NULL when streaming
+static unsigned char PartRows; // bitmap rows drawn
+static unsigned char PartCarry; // bytes of an incomplete row in PartRow
+static unsigned char PartRow[MAX_ROW_BYTES];
+
+static void EndPartDraw(void);
+static void StreamBitmap(unsigned char const *pData, unsigned int Length);
+static void DrawRows(unsigned char const *pData, unsigned char Rows);
+
 void DrawMsgHandler(tMessage *pMsg)
 {
-  static Draw_t *pInfo;
-  static unsigned char *pData;
-  static unsigned int Size = 0;
+  unsigned char const *pData = pMsg->pBuffer;
+  unsigned int Length = pMsg->Length;
 
   if (pMsg->Options & DRAW_MSG_BEGIN)
   {
-    pInfo = (Draw_t *)pMsg->pBuffer;
-    pData = pMsg->pBuffer + DRAW_INFO_SIZE;
+    if (Length < DRAW_INFO_SIZE) return;
 
-    if (!(pMsg->Options & DRAW_MSG_END))
+    if (PartActive)
     {
-      pInfo = (Draw_t *)pvPortMalloc(DRAW_INFO_SIZE);
-      PrintF("%cA:%04X %u", pInfo ? PLUS : NOK, pInfo, DRAW_INFO_SIZE);
-      if (pInfo == NULL) return;
-
-      memcpy(pInfo, pMsg->pBuffer, DRAW_INFO_SIZE);
-      PrintF("Id:%02X X:%u Y:%u Opt:%02X", pInfo->Id, pInfo->X, pInfo->Y, pInfo->Opt);
-      PrintF("W:%u H:%u WgtId:%02X", pInfo->Width, pInfo->Height, pInfo->WidgetId);
-      PrintF("TxtLen:%u Align:%u", pInfo->TextLen, pInfo->Align);
-
-      if (pInfo->Id & DRAW_ID_TYPE_BMP)
-        Size = pInfo->Opt & DRAW_OPT_FILL ? 1 : WIDTH_IN_BYTES(pInfo->Width) * pInfo->Height;
-      else Size = pInfo->TextLen;
-
-      pData = (unsigned char *)pvPortMalloc(Size);
-      PrintF("%cA:%04X %u", pData ? PLUS : NOK, pData, Size);
-      if (pData == NULL)
-      {
-        vPortFree(pInfo);
-        return;
-      }
+      PrintF("#Drw Brk %u/%u", PartReceived, PartSize);
+      EndPartDraw();
+    }
+
+    if (pMsg->Options & DRAW_MSG_END)
+    { // single message: draw from the message buffer
+      Draw_t *pInfo = (Draw_t *)pMsg->pBuffer;
+      unsigned char Mode = (pMsg->Options & DRAW_MSG_MODE) >> 6;
+
+      if (Mode == IDLE_MODE) CreateDrawBuffer(pInfo->WidgetId);
+      Draw(pInfo, pMsg->pBuffer + DRAW_INFO_SIZE, Mode);
 
-      Size = pMsg->Length - DRAW_INFO_SIZE;
-      memcpy(pData, pMsg->pBuffer + DRAW_INFO_SIZE, Size);
+      if (Mode == IDLE_MODE && (pMsg->Options & DRAW_WIDGET_END))
+        DrawWidgetToSram(pInfo->WidgetId);
+      return;
     }
-  }
-  else // pure data in payload
-  {
-    if (pData == NULL)
+
+    memcpy(&PartInfo, pMsg->pBuffer, DRAW_INFO_SIZE);
+    PrintF("Id:%02X X:%u Y:%u Opt:%02X", PartInfo.Id, PartInfo.X, PartInfo.Y, PartInfo.Opt);
+    PrintF("W:%u H:%u WgtId:%02X", PartInfo.Width, PartInfo.Height, PartInfo.WidgetId);
+    PrintF("TxtLen:%u Align:%u", PartInfo.TextLen, PartInfo.Align);
+
+    PartMode = (pMsg->Options & DRAW_MSG_MODE) >> 6;
+    PartReceived = 0;
+    PartRows = 0;
+    PartCarry = 0;
+
+    if (PartInfo.Id & DRAW_ID_TYPE_BMP)
+      PartSize = PartInfo.Opt & DRAW_OPT_FILL ? 1 : WIDTH_IN_BYTES(PartInfo.Width) * PartInfo.Height;
+    else PartSize = PartInfo.TextLen;
+
+    /* nothing to draw (a zero width row would never fill up) */
+    if (PartSize == 0)
     {
-      PrintS("#DrwMsg:empty payload");
+      PrintS("#Drw Size:0");
       return;
     }
-    memcpy(pData + Size, pMsg->pBuffer, pMsg->Length);
-    Size += pMsg->Length;
+
+    if (PartMode == IDLE_MODE) CreateDrawBuffer(PartInfo.WidgetId);
+
+    if (!(PartInfo.Id & DRAW_ID_TYPE_BMP) || (PartInfo.Id & DRAW_ID_SUB_TYPE) ||
+        (PartInfo.Opt & DRAW_OPT_FILL) ||
+        PartMode == IDLE_MODE && PartInfo.Y < HALF_SCREEN_ROWS &&
+        PartInfo.Y + PartInfo.Height > HALF_SCREEN_ROWS)
+    {
+      pPartData = (unsigned char *)pvPortMallocFrom(PartSize, HEAP_SITE_DRAW);
+      PrintF("%cA:%04X %u", pPartData ? PLUS : NOK, pPartData, PartSize);
+      if (pPartData == NULL) return;
+      /* a truncated transfer draws blank instead of garbage */
+      memset(pPartData, 0, PartSize);
+    }
+
+    PartActive = TRUE;
+    pData += DRAW_INFO_SIZE;
+    Length -= DRAW_INFO_SIZE;
   }
+  else if (!PartActive)
+  {
+    PrintS("#DrwMsg:empty payload");
+    return;
+  }
+
+  if (Length > PartSize - PartReceived) Length = PartSize - PartReceived;
+
+  if (pPartData) memcpy(pPartData + PartReceived, pData, Length);
+  else StreamBitmap(pData, Length);
+  PartReceived += Length;
 
   if (pMsg->Options & DRAW_MSG_END)
   {
-    unsigned char Mode = (pMsg->Options & DRAW_MSG_MODE) >> 6;
-    if (Mode == IDLE_MODE) CreateDrawBuffer(pInfo->WidgetId);
+    if (PartReceived < PartSize) PrintF("#Drw Trunc %u/%u", PartReceived, PartSize);
+    if (pPartData) Draw(&PartInfo, pPartData, PartMode);
+
+    if (PartMode == IDLE_MODE && (pMsg->Options & DRAW_WIDGET_END))
+      DrawWidgetToSram(PartInfo.WidgetId);
+
+    EndPartDraw();
+  }
+}
+
+static void EndPartDraw(void)
+{
+  if (pPartData)
+  {
+    PrintF("-F:%04X", pPartData);
+    vPortFree(pPartData);
+    pPartData = NULL;
+  }
+  PartActive = FALSE;
+}
 
-    Draw(pInfo, pData, Mode);
+static void StreamBitmap(unsigned char const *pData, unsigned int Length)
+{
+  unsigned char RowBytes = WIDTH_IN_BYTES(PartInfo.Width);
+  unsigned int Rows;
 
-    if (Mode == IDLE_MODE && (pMsg->Options & DRAW_WIDGET_END))
-      DrawWidgetToSram(pInfo->WidgetId);
+  /* complete the row started by the previous message */
+  if (PartCarry)
+  {
+    unsigned char Bytes = RowBytes - PartCarry;
+    if (Bytes > Length) Bytes = Length;
 
-    if (Size)
-    {
-      PrintF("-F:%04X %04X", pInfo, pData);
-      vPortFree(pData);
-      vPortFree(pInfo);
-      Size = 0;
-    }
+    memcpy(PartRow + PartCarry, pData, Bytes);
+    PartCarry += Bytes;
+    pData += Bytes;
+    Length -= Bytes;
+
+    if (PartCarry < RowBytes) return;
+    DrawRows(PartRow, 1);
+    PartCarry = 0;
+  }
+
+  Rows = Length / RowBytes;
+  if (Rows) DrawRows(pData, (unsigned char)Rows);
+
+  Length -= Rows * RowBytes;
+  if (Length)
+  {
+    memcpy(PartRow, pData + Rows * RowBytes, Length);
+    PartCarry = Length;
   }
 }
 
+static void DrawRows(unsigned char const *pData, unsigned char Rows)
+{
+  Draw_t Info = PartInfo;
+
+  Info.Y += PartRows;
+  Info.Height = Rows;
+  Draw(&Info, pData, PartMode);
+  PartRows += Rows;
+}
+
 void Draw(Draw_t *Info, unsigned char const *pData, unsigned char ModePage)
 {
   unsigned char DrawType = (Info->Id & DRAW_ID_TYPE) >> 7;
@@ -209,6 +307,9 @@ static void DrawText(Draw_t *Info, char const *pText)
   Info->Height = pFont->Height;
   unsigned char ModePage = Info->Id >> 4;
 
+  /* all characters share the same rows */
+  if ((ModePage & DRAW_MODE) != IDLE_MODE) OpenSramBand(Info->Y, Info->Height, ModePage & DRAW_MODE);
+
   while (Info->TextLen --)
   {
     unsigned char const *pBitmap = GetFontBitmap(*pText, Font);
@@ -227,6 +328,8 @@ static void DrawText(Draw_t *Info, char const *pText)
     Info->X += (pFont->Type == FONT_TYPE_TIME ? pFont->MaxWidth : Info->Width);
     pText ++;
   }
+
+  if ((ModePage & DRAW_MODE) != IDLE_MODE) CloseSramBand();
 }
 
 static unsigned char GetHour(char *Hour)
@@ -35,7 +35,6 @@
 #include "hal_vibe.h"
 #include "Messages.h"
 #include "OneSecondTimers.h"
-#include "MessageInfo.h"
 #include "Wrapper.h"
 #include "DrawHandler.h"
 #include "LcdBuffer.h"
@@ -800,9 +799,11 @@ void DrawNotifPageNo(unsigned char PageNo)
   }
   else
   {
-    gColumn = 7;
+    /* the ring holds more than 10 pages on the bigger serial ram */
+    gColumn = PageNo > 9 ? 6 : 7;
     gBitColumnMask = BIT3;
-    DrawChar(PageNo + ZERO, MetaWatch5, DRAW_OPT_OR);
+    if (PageNo > 9) DrawChar(PageNo / 10 + ZERO, MetaWatch5, DRAW_OPT_OR);
+    DrawChar(PageNo % 10 + ZERO, MetaWatch5, DRAW_OPT_OR);
     DrawString(" MORE", MetaWatch5, DRAW_OPT_OR);
   }
 
@@ -1074,7 +1075,7 @@ void *GetLcdBuffer(void)
 {
   if (LcdBuf == NULL)
   {
-    LcdBuf = (tLcdLine *)pvPortMalloc(LCD_BUFFER_SIZE);
+    LcdBuf = (tLcdLine *)pvPortMallocFrom(LCD_BUFFER_SIZE, HEAP_SITE_LCD_BUF);
     if (!LcdBuf) PrintS("@LcdBuf");
   }
   return (void *)LcdBuf;
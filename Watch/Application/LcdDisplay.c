@@ -40,10 +40,10 @@
 #include "DrawHandler.h"
 #include "Widget.h"
 #include "ClockWidget.h"
+#include "BitmapData.h"
 #include "SerialRam.h"
 #include "Icons.h"
 #include "LcdDisplay.h"
-#include "BitmapData.h"
 #include "IdleTask.h"
 #include "TermMode.h"
 #include "MuxMode.h"
@@ -54,11 +54,14 @@
 #include "CallNotifier.h"
 #include "Log.h"
 #include "Icons.h"
+#include "Statistics.h"
+#include "Trace.h"
 
 #define PAGE_TYPE_NUM                 3
 #define MUSIC_STATE_START_ROW         43
 
 #define DEV_TYPE_EN_ACK               0x80
+#define DEV_TYPE_EN_CREDIT            0x40
 
 #if BOOTLOADER
 #include "bl_boot.h"
@@ -73,6 +76,7 @@ extern char const VERSION[];
 static unsigned char RtcUpdateEnabled = FALSE;
 
 unsigned char CurrentMode = IDLE_MODE;
+xTaskHandle DisplayTaskHandle;
 unsigned char PageType = PAGE_TYPE_IDLE;
 
 static unsigned char CurrentPage[PAGE_TYPE_NUM];
@@ -104,22 +108,25 @@ static void ReadBatteryVoltageHandler(void);
 static void NvalOperationHandler(tMessage* pMsg);
 static void MonitorBattery(void);
 static void HandleSecInvert(unsigned char Val);
+static unsigned char Superseded(tMessage *pMsg);
 
 /******************************************************************************/
 
 #define DISPLAY_STACK_SIZE      (configMINIMAL_STACK_SIZE + 200) //total 48-88
 #define DISPLAY_PRIORITY        (tskIDLE_PRIORITY + 1)
 extern xQueueHandle QueueHandles[];
+extern xQueueHandle UrgentQueueHandle;
 
 void CreateDisplayTask(void)
 {
-  xTaskHandle Handle;
-
   QueueHandles[DISPLAY_QINDEX] = xQueueCreate(DISPLAY_QUEUE_LENGTH, MESSAGE_SIZE);
   if (!QueueHandles[DISPLAY_QINDEX]) SoftwareReset(RESET_TASK_FAIL, DISPLAY_QINDEX);
 
+  UrgentQueueHandle = xQueueCreate(URGENT_QUEUE_LENGTH, MESSAGE_SIZE);
+  if (!UrgentQueueHandle) SoftwareReset(RESET_TASK_FAIL, DISPLAY_QINDEX);
+
   // task function, task name, stack len, task params, priority, task handle
-  xTaskCreate(DisplayTask, "DISPLAY", DISPLAY_STACK_SIZE, NULL, DISPLAY_PRIORITY, &Handle);
+  xTaskCreate(DisplayTask, "DISPLAY", DISPLAY_STACK_SIZE, NULL, DISPLAY_PRIORITY, &DisplayTaskHandle);
 }
 
 /*! LCD Task Main Loop */
@@ -131,14 +138,32 @@ static void DisplayTask(void *pvParameters)
 
   for(;;)
   {
-    if (xQueueReceive(QueueHandles[DISPLAY_QINDEX], &Msg, portMAX_DELAY))
+    /* urgent lane first; its token only wakes us up */
+    unsigned char Lane = LANE_URGENT;
+    portBASE_TYPE Received = xQueueReceive(UrgentQueueHandle, &Msg, DONT_WAIT);
+
+    if (!Received)
+    {
+      Lane = LANE_NORMAL;
+      Received = xQueueReceive(QueueHandles[DISPLAY_QINDEX], &Msg, portMAX_DELAY) &&
+                 Msg.Type != LaneTokenMsg;
+    }
+
+    if (Received)
     {
-      ShowMessageInfo(&Msg);
-      DisplayQueueMessageHandler(&Msg);
+      ShowMessageInfo(&Msg, Lane);
+
+      if (Superseded(&Msg)) gAppStats.RepaintsSaved ++;
+      else DisplayQueueMessageHandler(&Msg);
 
       if (Msg.pBuffer) FreeMessageBuffer(Msg.pBuffer);
+      UpdateDisplayCredit();
       CheckStackAndQueueUsage(DISPLAY_QINDEX);
     }
+
+#if TRACE_CAPTURE
+    TraceService();
+#endif
   }
 }
 
@@ -198,280 +223,263 @@ static void InitDisplay(void)
   DISABLE_LCD_LED();
 }
 
-/*! Handle the messages routed to the display queue */
-static void DisplayQueueMessageHandler(tMessage *pMsg)
+/*! A repaint is dropped when an equivalent one is right behind it in the
+ * normal lane. Urgent messages may still run between the two, but the
+ * later repaint covers every row of the dropped one, so the screen ends up
+ * the same once it has run */
+static unsigned char Superseded(tMessage *pMsg)
 {
-  tMessage Msg;
+  tMessage Next;
 
-  switch (pMsg->Type)
-  {
-  case ShowCallMsg:
-    HandleCallNotification(pMsg->Options, pMsg->pBuffer, pMsg->Length);
-    break;
+  if (pMsg->Type != UpdateDisplayMsg && pMsg->Type != UpdateClockMsg &&
+      pMsg->Type != DrawClockWidgetMsg && pMsg->Type != IdleUpdateMsg) return FALSE;
 
-  case WriteBufferMsg:
-    WriteBufferHandler(pMsg);
-    break;
+  if (!xQueuePeek(QueueHandles[DISPLAY_QINDEX], &Next, DONT_WAIT) ||
+      Next.Type != pMsg->Type || Next.Options != pMsg->Options) return FALSE;
 
-  case SetWidgetListMsg:
-    SetWidgetList(pMsg);
-    break;
-  
-  case UpdateDisplayMsg:
-  
-    if ((!(pMsg->Options & MSG_OPT_UPD_INTERNAL) &&
-        (pMsg->Options & MODE_MASK) == NOTIF_MODE) &&
-        GetProperty(PROP_AUTO_BACKLIGHT))
-      SendMessage(AutoBacklightMsg, MSG_OPT_NONE);
+  return pMsg->Type == UpdateDisplayMsg ? UpdateSuperseded(pMsg, &Next) : TRUE;
+}
 
-    UpdateDisplayHandler(pMsg);
-    break;
+/* Adapters from a message to the handlers that only need part of it */
+static void ShowCallMsgHandler(tMessage *pMsg)
+{
+  HandleCallNotification(pMsg->Options, pMsg->pBuffer, pMsg->Length);
+}
 
-  case DrawMsg:
-    DrawMsgHandler(pMsg);
-    break;
-    
-  case UpdateClockMsg:
-    UpdateClock();
-    break;
-    
-  case DrawClockWidgetMsg:
-    DrawClockWidget(pMsg->Options);
-    break;
+static void UpdateDisplayMsgHandler(tMessage *pMsg)
+{
+  if ((!(pMsg->Options & MSG_OPT_UPD_INTERNAL) &&
+      (pMsg->Options & MODE_MASK) == NOTIF_MODE) &&
+      GetProperty(PROP_AUTO_BACKLIGHT))
+    SendMessage(AutoBacklightMsg, MSG_OPT_NONE);
 
-  case BluetoothStateChangeMsg:
-    BluetoothStateChangeHandler(pMsg);
-    break;
+  UpdateDisplayHandler(pMsg);
+}
 
-  case IdleUpdateMsg:
-    IdleUpdateHandler();
-    break;
+static void UpdateClockMsgHandler(tMessage *pMsg)
+{
+  UpdateClock();
+}
 
-  case ButtonStateMsg:
-    ButtonStateHandler();
-    break;
+static void DrawClockWidgetMsgHandler(tMessage *pMsg)
+{
+  DrawClockWidget(pMsg->Options);
+}
 
-  case StopTimerMsg:
-    StopTimer((eTimerId)pMsg->Options);
-    break;
+static void IdleUpdateMsgHandler(tMessage *pMsg)
+{
+  IdleUpdateHandler();
+}
 
-  case MonitorBatteryMsg:
-    MonitorBattery();
-    break;
+static void ButtonStateMsgHandler(tMessage *pMsg)
+{
+  ButtonStateHandler();
+}
 
-  case MusicIconMsg:
-      MusicIcon(pMsg->Options);
-      break;
+static void StopTimerMsgHandler(tMessage *pMsg)
+{
+  StopTimer((eTimerId)pMsg->Options);
+}
 
-  case MusicStateMsg:
-    HandleMusicStateChange(pMsg->Options);
-    break;
-    
-  case ChangeModeMsg:
-    ChangeMode(pMsg->Options);
-    break;
-  
-  case ControlFullScreenMsg:
-    SetProperty(PROP_PHONE_DRAW_TOP, pMsg->Options || *pMsg->pBuffer ? PROP_PHONE_DRAW_TOP : 0);
-    break;
+static void MonitorBatteryMsgHandler(tMessage *pMsg)
+{
+  MonitorBattery();
+}
 
-  case ModifyTimeMsg:
-    ModifyTimeHandler(pMsg);
-    break;
+static void MusicIconMsgHandler(tMessage *pMsg)
+{
+  MusicIcon(pMsg->Options);
+}
 
-  case MenuModeMsg:
-    MenuModeHandler(pMsg->Options);
-    break;
+static void MusicStateMsgHandler(tMessage *pMsg)
+{
+  HandleMusicStateChange(pMsg->Options);
+}
 
-  case MenuButtonMsg:
-    MenuButtonHandler(pMsg->Options);
-    break;
+static void ChangeModeMsgHandler(tMessage *pMsg)
+{
+  ChangeMode(pMsg->Options);
+}
 
-  case EnableButtonMsg:
-    EnableButtonMsgHandler(pMsg);
-    break;
+static void ControlFullScreenMsgHandler(tMessage *pMsg)
+{
+  SetProperty(PROP_PHONE_DRAW_TOP, pMsg->Options || *pMsg->pBuffer ? PROP_PHONE_DRAW_TOP : 0);
+}
 
-  case DevTypeMsg:
+static void MenuModeMsgHandler(tMessage *pMsg)
+{
+  MenuModeHandler(pMsg->Options);
+}
 
-    Msg.Length = 1;
-    Msg.Type = DevTypeRespMsg;
-    Msg.Options = BOARD_TYPE; //default G2
+static void MenuButtonMsgHandler(tMessage *pMsg)
+{
+  MenuButtonHandler(pMsg->Options);
+}
 
-    if (CreateMessage(&Msg))
-    {
-      Msg.pBuffer[0] = BOARD_TYPE; // backward compatible
+static void DevTypeMsgHandler(tMessage *pMsg)
+{
+  tMessage Msg;
 
-      if (GetMsp430HardwareRevision() < 'F')
-      {
-        Msg.Options = DIGITAL_WATCH_TYPE_G1;
-        Msg.pBuffer[0] = DIGITAL_WATCH_TYPE_G1; // backward compatible
-      }
+  Msg.Length = 1;
+  Msg.Type = DevTypeRespMsg;
+  Msg.Options = BOARD_TYPE; //default G2
 
-      Msg.Options |= DEV_TYPE_EN_ACK; // support ACK
-      RouteMsg(&Msg);
-    }
+  if (CreateMessage(&Msg))
+  {
+    Msg.pBuffer[0] = BOARD_TYPE; // backward compatible
 
-    PrintF("- DevTypeResp:%u", Msg.Options);
+    if (GetMsp430HardwareRevision() < 'F')
+    {
+      Msg.Options = DIGITAL_WATCH_TYPE_G1;
+      Msg.pBuffer[0] = DIGITAL_WATCH_TYPE_G1; // backward compatible
+    }
 
-    // set ACK and HFP/MAP bits
-//    SendMessage(ConnTypeMsg, pMsg->Options);
-    break;
+    Msg.Options |= DEV_TYPE_EN_ACK | DEV_TYPE_EN_CREDIT; // support ACK and credits
+    RouteMsg(&Msg);
+  }
 
-  case VerInfoMsg:
+  PrintF("- DevTypeResp:%u", Msg.Options);
 
-    Msg.Length = BUILD_LENGTH + 4 + 3;
-    Msg.Type = VerInfoRespMsg;
-    Msg.Options = MSG_OPT_NONE;
+  // set ACK and HFP/MAP bits
+//  SendMessage(ConnTypeMsg, pMsg->Options);
+}
 
-    if (CreateMessage(&Msg))
-    {
-      GetBuildNumber(Msg.pBuffer);
+static void VerInfoMsgHandler(tMessage *pMsg)
+{
+  tMessage Msg;
 
-      *(Msg.pBuffer + BUILD_LENGTH) = VERSION[0] - ZERO;
-      *(Msg.pBuffer + BUILD_LENGTH + 1) = VERSION[2] - ZERO;
-      *(Msg.pBuffer + BUILD_LENGTH + 2) = VERSION[4] - ZERO;
-      *(Msg.pBuffer + BUILD_LENGTH + 3) = GetMsp430HardwareRevision();
-      *(Msg.pBuffer + BUILD_LENGTH + 4) = BootVersion[0] - ZERO;
-      *(Msg.pBuffer + BUILD_LENGTH + 5) = BootVersion[2] - ZERO;
-      *(Msg.pBuffer + BUILD_LENGTH + 6) = BootVersion[4] - ZERO;
+  Msg.Length = BUILD_LENGTH + 4 + 3;
+  Msg.Type = VerInfoRespMsg;
+  Msg.Options = MSG_OPT_NONE;
 
-      RouteMsg(&Msg);
-    }
-    PrintE("-Ver(%u):", Msg.Length); PrintQ(Msg.pBuffer, Msg.Length);
-    break;
+  if (CreateMessage(&Msg))
+  {
+    GetBuildNumber(Msg.pBuffer);
 
-  case LogMsg:
-    SendStateLog();
-    break;
-    
-  case VibrateMsg:
-    SetVibrateModeHandler(pMsg);
-    break;
+    *(Msg.pBuffer + BUILD_LENGTH) = VERSION[0] - ZERO;
+    *(Msg.pBuffer + BUILD_LENGTH + 1) = VERSION[2] - ZERO;
+    *(Msg.pBuffer + BUILD_LENGTH + 2) = VERSION[4] - ZERO;
+    *(Msg.pBuffer + BUILD_LENGTH + 3) = GetMsp430HardwareRevision();
+    *(Msg.pBuffer + BUILD_LENGTH + 4) = BootVersion[0] - ZERO;
+    *(Msg.pBuffer + BUILD_LENGTH + 5) = BootVersion[2] - ZERO;
+    *(Msg.pBuffer + BUILD_LENGTH + 6) = BootVersion[4] - ZERO;
 
-  case SetRtcMsg:
-    if (SetRtc((Rtc_t *)pMsg->pBuffer)) UpdateClock();
-    break;
-    
-  case CountdownMsg:
-    if (pMsg->Options == CDT_ENTER)
-    {
-      PageType = PAGE_TYPE_INFO;
-      CurrentPage[PageType] = CountdownPage;
-    }
-    CountdownHandler(pMsg->Options);
-    break;
+    RouteMsg(&Msg);
+  }
+  PrintE("-Ver(%u):", Msg.Length); PrintQ(Msg.pBuffer, Msg.Length);
+}
 
-  case ServiceMenuMsg:
-    ServiceMenuHandler();
-    break;
+static void SetRtcMsgHandler(tMessage *pMsg)
+{
+  if (SetRtc((Rtc_t *)pMsg->pBuffer)) UpdateClock();
+}
 
-  case FieldTestMsg:
-    HandleFieldTestMode(pMsg->Options);
-    break;
+static void CountdownMsgHandler(tMessage *pMsg)
+{
+  if (pMsg->Options == CDT_ENTER)
+  {
+    PageType = PAGE_TYPE_INFO;
+    CurrentPage[PageType] = CountdownPage;
+  }
+  CountdownHandler(pMsg->Options);
+}
 
-  case DisableButtonMsg:
-    DisableButtonMsgHandler(pMsg);
-    break;
+static void ServiceMenuMsgHandler(tMessage *pMsg)
+{
+  ServiceMenuHandler();
+}
 
-  case ReadButtonConfigMsg:
-    ReadButtonConfigHandler(pMsg);
-    break;
+static void FieldTestMsgHandler(tMessage *pMsg)
+{
+  HandleFieldTestMode(pMsg->Options);
+}
 
-  case SetBacklightMsg:
-    SetBacklight(pMsg->Options);
-    // testing
-//    pMsg->Type = AccelMsg;
-//    pMsg->Options = 1; //enable
-//    HandleAccelerometer(pMsg);
-    break;
+static void SetBacklightMsgHandler(tMessage *pMsg)
+{
+  SetBacklight(pMsg->Options);
+}
 
-  case AutoBacklightMsg:
-    if (LightSenseCycle() < DARK_LEVEL) SetBacklight(LED_ON);
-    break;
+static void AutoBacklightMsgHandler(tMessage *pMsg)
+{
+  if (LightSenseCycle() < DARK_LEVEL) SetBacklight(LED_ON);
+}
 
-  case BatteryConfigMsg:
-    SetBatteryLevels(pMsg->pBuffer);
-    break;
+static void BatteryConfigMsgHandler(tMessage *pMsg)
+{
+  SetBatteryLevels(pMsg->pBuffer);
+}
 
-  case ReadBatteryVoltageMsg:
-    ReadBatteryVoltageHandler();
-    break;
+static void ReadBatteryVoltageMsgHandler(tMessage *pMsg)
+{
+  ReadBatteryVoltageHandler();
+}
 
-  case ResetMsg:
-    SoftwareReset(RESET_BUTTON_PRESS, pMsg->Options);
-    break;
+static void ResetMsgHandler(tMessage *pMsg)
+{
+  SoftwareReset(RESET_BUTTON_PRESS, pMsg->Options);
+}
 
-  case NvalOperationMsg:
-    NvalOperationHandler(pMsg);
-    break;
+static void SecInvertMsgHandler(tMessage *pMsg)
+{
+  HandleSecInvert(pMsg->Options);
+}
 
-  case SecInvertMsg:
-    HandleSecInvert(pMsg->Options);
-    break;
+static void LinkAlarmMsgHandler(tMessage *pMsg)
+{
+  SendMessage(VibrateMsg, VIBRA_PATTERN_LNKALM);
+}
 
-  case LoadTemplateMsg:
-    LoadTemplateHandler(pMsg);
-    break;
+static void ModeTimeoutMsgHandler(tMessage *pMsg)
+{
+  ModeTimeoutHandler();
+}
 
-  case LinkAlarmMsg:
-    SendMessage(VibrateMsg, VIBRA_PATTERN_LNKALM);
-    break;
+static void WatchStatusMsgHandler(tMessage *pMsg)
+{
+  PageType = PAGE_TYPE_INFO;
+  CurrentPage[PageType] = StatusPage;
+  DrawWatchStatusScreen(TRUE);
+}
 
-  case ModeTimeoutMsg:
-    ModeTimeoutHandler();
-    break;
+static void TermModeMsgHandler(tMessage *pMsg)
+{
+  TermModeHandler();
+}
 
-  case WatchStatusMsg:
-    PageType = PAGE_TYPE_INFO;
-    CurrentPage[PageType] = StatusPage;
-    DrawWatchStatusScreen(TRUE);
-    break;
+static void ReadLightSensorMsgHandler(tMessage *pMsg)
+{
+  ReadLightSensorHandler();
+}
 
-  case TermModeMsg:
-    TermModeHandler();
-    break;
-    
-  case LowBatteryWarningMsg:
-    break;
-    
-  case LowBatteryBtOffMsg:
-    UpdateClock();
-    break;
+static void RateTestMsgHandler(tMessage *pMsg)
+{
+  /* don't care what data is */
+  tMessage Msg = {10, DiagnosticLoopback, MSG_OPT_NONE, NULL};
+  if (CreateMessage(&Msg)) RouteMsg(&Msg);
+}
 
-#if __IAR_SYSTEMS_ICC__
-  case EraseTemplateMsg:
-//    EraseTemplateHandler(pMsg);
-    break;
-    
-  case WriteToTemplateMsg:
-//    WriteToTemplateHandler(pMsg);
-    break;
-#endif
+/* low battery warning, erase and write template */
+static void IgnoreMsgHandler(tMessage *pMsg)
+{
+}
 
-  case AccelMsg:
-    HandleAccelerometer(pMsg);
-    break;
+/* display task handlers indexed by message type, generated from MessageInfo.h */
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) _Handler,
+#define MSG_RESERVED()  NULL,
 
-  case ReadLightSensorMsg:
-    ReadLightSensorHandler();
-    break;
+static void (* const DisplayHandler[MAXIMUM_MESSAGE_TYPES])(tMessage *pMsg) =
+{
+#include "MessageInfo.h"
+};
 
-  case WatchDrawnScreenTimeout:
-    IdleUpdateHandler();
-    break;
+#undef MSG_INFO
+#undef MSG_RESERVED
 
-  case RateTestMsg:
-    /* don't care what data is */
-    Msg.Length = 10;
-    Msg.Type = DiagnosticLoopback;
-    Msg.Options = MSG_OPT_NONE;
-    if (CreateMessage(&Msg)) RouteMsg(&Msg);
-    break;
-    
-  default:
-    PrintF("# Disp Msg:x%02X", pMsg->Type);
-    break;
-  }
+/*! Handle the messages routed to the display queue */
+static void DisplayQueueMessageHandler(tMessage *pMsg)
+{
+  if (DisplayHandler[pMsg->Type]) DisplayHandler[pMsg->Type](pMsg);
+  else PrintF("# Disp Msg:x%02X", pMsg->Type);
 }
 
 /*! Switch from other-mode/menu page back to idle type page
@@ -510,6 +518,9 @@ void ChangeMode(unsigned char Option)
 
   CurrentMode = Mode;
 
+  /* the new UI idle screen never goes through UpdateDisplayHandler */
+  if (Mode != NOTIF_MODE) DropReadAhead();
+
   if (Mode == IDLE_MODE)
   {
     if (Ringing()) SendMessage(ShowCallMsg, CALL_REJECTED);
@@ -15,12 +15,15 @@
 //==============================================================================
 
 #include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
 #include "hal_board_type.h"
 #include "hal_clock_control.h"
 #include "DebugUart.h"
 #include "LcdDriver.h"
 #include "LcdDisplay.h"
 #include "Property.h"
+#include "Statistics.h"
 
 /******************************************************************************/
 
@@ -35,13 +38,32 @@
 /* the first LCD line is one, NOT zero */
 #define FIRST_LCD_LINE_OFFSET  1
 
+/* writes at least this long (0.5 ms at 1 MHz) block the task instead of
+ * spinning; DMA_ISR switches back to it as soon as the DMA is done. The
+ * bursts of UpdateDisplayHandler (8 lines, 112 bytes) block, so the cpu is
+ * free for about 1 ms of every burst. */
+#define LCD_BLOCKING_LENGTH    64
+
 /* errata - DMA variables cannot be function scope */
 static unsigned char LcdDmaBusy = 0;
 
-static void Write(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size);
+/* a write has been started and WaitForLcd has not finished it */
+static unsigned char LcdWriting = 0;
+
+/* the task waiting for the current write blocks on LcdDmaDone */
+static unsigned char LcdDmaBlocking = 0;
+static xSemaphoreHandle LcdDmaDone = NULL;
+
+static void StartWrite(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size);
 
 void LcdPeripheralInit(void)
 {
+  if (!LcdDmaDone)
+  {
+    vSemaphoreCreateBinary(LcdDmaDone);
+    xSemaphoreTake(LcdDmaDone, 0);
+  }
+
   /*
    * configure the MSP430 SPI peripheral for use with Lcd
    */
@@ -70,6 +92,14 @@ void LcdPeripheralInit(void)
 
 void WriteToLcd(tLcdLine *pData, unsigned char LineNum)
 {
+  StartWriteToLcd(pData, LineNum);
+  WaitForLcd();
+}
+
+void StartWriteToLcd(tLcdLine *pData, unsigned char LineNum)
+{
+  WaitForLcd();
+
   /* flip bits */
   if (!GetProperty(PROP_INVERT_DISPLAY))
   {
@@ -82,17 +112,19 @@ void WriteToLcd(tLcdLine *pData, unsigned char LineNum)
     }
   }
 
-  Write(LCD_WRITE_CMD, (unsigned char *)pData, sizeof(tLcdLine) * LineNum);
+  StartWrite(LCD_WRITE_CMD, (unsigned char *)pData, sizeof(tLcdLine) * LineNum);
 }
 
-static void Write(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
+static void StartWrite(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
 {  
   EnableSmClkUser(LCD_USER);
+  LcdWriting = 1;
   LCD_CS_ASSERT();
   
 #if LCD_DMA
   
   LcdDmaBusy = 1;
+  LcdDmaBlocking = Size >= LCD_BLOCKING_LENGTH && LcdDmaDone && (__get_interrupt_state() & GIE);
   
   /* send the lcd write command before starting the dma */
   LCD_SPI_UCBxTXBUF = Cmd;
@@ -116,8 +148,6 @@ static void Write(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
   
   /* start the transfer */
   DMA2CTL |= DMAEN;
-  
-  while(LcdDmaBusy);
 
 #else
 
@@ -132,7 +162,27 @@ static void Write(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
   }
     
 #endif
-  
+}
+
+void WaitForLcd(void)
+{
+  if (!LcdWriting) return;
+  LcdWriting = 0;
+
+#if LCD_DMA
+  if (LcdDmaBlocking)
+  {
+    portTickType Start = xTaskGetTickCount();
+
+    xSemaphoreTake(LcdDmaDone, portMAX_DELAY);
+    LcdDmaBlocking = 0;
+
+    gAppStats.DmaWaits ++;
+    gAppStats.DmaTicksFreed += xTaskGetTickCount() - Start;
+  }
+  else while(LcdDmaBusy);
+#endif
+
   /* add one more dummy byte at the end */
   LCD_SPI_UCBxTXBUF = 0x00;
   while (!(LCD_SPI_UCBxIFG&UCTXIFG));
@@ -153,6 +203,7 @@ static void Write(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
 
 void ClearLcd(void)
 {
+  WaitForLcd();
   EnableSmClkUser(LCD_USER);
   LCD_CS_ASSERT();
 
@@ -169,7 +220,12 @@ void ClearLcd(void)
   DisableSmClkUser(LCD_USER);
 }
 
-void LcdDmaIsr(void)
+unsigned char LcdDmaIsr(void)
 {
+  signed portBASE_TYPE HigherPriorityTaskWoken = pdFALSE;
+
   LcdDmaBusy = 0;
+  if (LcdDmaBlocking) xSemaphoreGiveFromISR(LcdDmaDone, &HigherPriorityTaskWoken);
+
+  return HigherPriorityTaskWoken;
 }
@@ -46,11 +46,22 @@ void LcdPeripheralInit(void);
 
 void WriteToLcd(tLcdLine *pData, unsigned char LineNum);
 
+/*! Start writing lines to the lcd and return while the dma sends them.
+ * Other spi ports and dma channels can be used meanwhile; pData must not
+ * be touched until WaitForLcd returns.
+ */
+void StartWriteToLcd(tLcdLine *pData, unsigned char LineNum);
+
+/*! Wait for the write started by StartWriteToLcd to complete */
+void WaitForLcd(void);
+
 void ClearLcd(void);
 
 /*! Callback from the DMA interrupt service routing that lets LCD task know 
  * that the dma has finished
+ *
+ * \return TRUE if it woke a task of higher priority than the one running
  */
-void LcdDmaIsr(void);
+unsigned char LcdDmaIsr(void);
 
 #endif /* LCD_TASK_H */
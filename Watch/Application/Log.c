@@ -18,7 +18,6 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "Messages.h"
-#include "MessageInfo.h"
 #include "DebugUart.h"
 #include "Log.h"
 #include "hal_boot.h"
@@ -156,7 +155,7 @@ void SaveStateLog(void)
   SavedLogNum = niLogBuffer.Num;
 
   /* save old state and log to heap for reading */
-  pStateLog = (unsigned char *)pvPortMalloc(STATE_INFO_SIZE + niLogBuffer.Num * RESET_LOG_SIZE);
+  pStateLog = (unsigned char *)pvPortMallocFrom(STATE_INFO_SIZE + niLogBuffer.Num * RESET_LOG_SIZE, HEAP_SITE_LOG);
 
   if (pStateLog)
   {
@@ -209,9 +208,15 @@ void ShowStateLog(void)
 
   for (i = 0; i < SavedLogNum; ++i)
   {
+#if MESSAGE_STRINGS
     PrintF("%u:%u:%u %s x%02X",
       pLog[i].Timestamp >> 12, (pLog[i].Timestamp & 0x0FC0) >> 6, pLog[i].Timestamp & 0x003F,
       MsgInfo[pLog[i].MsgType].MsgStr, pLog[i].MsgOpt);
+#else
+    PrintF("%u:%u:%u x%02X x%02X",
+      pLog[i].Timestamp >> 12, (pLog[i].Timestamp & 0x0FC0) >> 6, pLog[i].Timestamp & 0x003F,
+      pLog[i].MsgType, pLog[i].MsgOpt);
+#endif
   }
 
   vPortFree(pStateLog);
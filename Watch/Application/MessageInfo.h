@@ -14,280 +14,295 @@
 //  limitations under the License.
 //==============================================================================
 
-#ifndef MESSAGE_INFORMATION_H
-#define MESSAGE_INFORMATION_H
-
-/*! structure contains message name as a string, 
+/******************************************************************************/
+/*! \file MessageInfo.h
+ *
+ * The message schema: one row per message type, in type order, giving
+ *
+ * the message name printed to the debug terminal,
  * queue to route message to,
- * and if it should be printed to the debug terminal
+ * lane of the queue (urgent messages are handled before normal ones),
+ * if it should be printed to the debug terminal
+ * and the display task handler (NULL if the display task has none)
+ *
+ * urgent wrapper messages are put at the front of the wrapper queue so only
+ * messages whose order does not matter should be urgent there
+ *
+ * an urgent display message overtakes every normal message still queued,
+ * including ones the phone sent before it: a ShowCallMsg draws the call
+ * screen before an UpdateDisplayMsg that was already waiting, which then
+ * replaces it. A message that relies on earlier normal messages having
+ * been handled (or that has no handler) stays in the normal lane. What the
+ * display task routes to itself while it handles an urgent message goes in
+ * the urgent lane whatever its row says, so the steps of a button action
+ * (its ChangeModeMsg, then the UpdateDisplayMsg of the new mode) do not
+ * wait behind the phone's traffic either.
+ *
+ * There is no include guard. Each table derived from the schema defines
+ * MSG_INFO(Name, Queue, Lane, Log, Handler) and MSG_RESERVED() to expand
+ * a row and includes this file inside its initializer. A new message is
+ * added here only.
  */
-typedef struct
-{
-  char const * const MsgStr;
-  unsigned char MsgQueue;
-  unsigned char Log;
-} tMsgInfo;
-
-static char const ReservedMsg[] = "ReservedMsg";
+/******************************************************************************/
 
-static tMsgInfo const MsgInfo[MAXIMUM_MESSAGE_TYPES] =
-{
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x00 */
-  {"GetDevTypeMsg",               DISPLAY_QINDEX,    1 }, /* 0x01 */
-  {"GetDevTypeResp",              WRAPPER_QINDEX,    1 }, /* 0x02 */
-  {"GetInfoMsg",                  DISPLAY_QINDEX,    1 }, /* 0x03 */
-  {"GetInfoResp",                 WRAPPER_QINDEX,    1 }, /* 0x04 */
-  {"DiagLoopback",                WRAPPER_QINDEX,    1 }, /* 0x05 */
-  {"ShippingModMsg",              WRAPPER_QINDEX,    1 }, /* 0x06 */
-  {"SoftResetMsg",                DISPLAY_QINDEX,    1 }, /* 0x07 */
-  {"ConnTimeoutMsg",              WRAPPER_QINDEX,    1 }, /* 0x08 */
-  {"TurnRadioOnMsg",              WRAPPER_QINDEX,    1 }, /* 0x09 */
-  {"TurnRadioOffMsg",             WRAPPER_QINDEX,    1 }, /* 0x0a */
-  {"ReadRssiMsg",                 WRAPPER_QINDEX,    1 }, /* 0x0b */
-  {"PairCtrlMsg",                 WRAPPER_QINDEX,    0 }, /* 0x0c */
-  {"ReadRssiResp",                WRAPPER_QINDEX,    1 }, /* 0x0d */
-  {"SniffCtrlMsg",                WRAPPER_QINDEX,    1 }, /* 0x0e */
-  {"LnkAlmMsg",                   DISPLAY_QINDEX,    0 }, /* 0x0f */
-  {"OledWrtBufMsg",               DISPLAY_QINDEX,    0 }, /* 0x10 */
-  {"OleConfModMsg",               DISPLAY_QINDEX,    0 }, /* 0x11 */
-  {"OleChgModMsg",                DISPLAY_QINDEX,    0 }, /* 0x12 */
-  {"OleWrtScrlBufMsg",            DISPLAY_QINDEX,    0 }, /* 0x13 */
-  {"OleScrlMsg",                  DISPLAY_QINDEX,    0 }, /* 0x14 */
-  {"OleShowIdleBufMsg",           DISPLAY_QINDEX,    0 }, /* 0x15 */
-  {"OleCrwnMenuMsg",              DISPLAY_QINDEX,    0 }, /* 0x16 */
-  {"OleCrwnMenuBtnMsg",           DISPLAY_QINDEX,    0 }, /* 0x17 */
-  {"MusCtlMsg",                   DISPLAY_QINDEX,    1 }, /* 0x18 */
-  {"DrwMsg",                      DISPLAY_QINDEX,    0 }, /* 0x19 */
-  {"SetCliCfgMsg",                WRAPPER_QINDEX,    0 }, /* 0x1a */
-  {"HidMsg",                      WRAPPER_QINDEX,    0 }, /* 0x1b */
-  {"MusicIcon",                   DISPLAY_QINDEX,    0 }, /* 0x1c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x1d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x1e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x1f */
-  {"WatchHandMsg",                DISPLAY_QINDEX,    0 }, /* 0x20 */
-  {"TermModMsg",                  DISPLAY_QINDEX,    1 }, /* 0x21 */
-  {"FtmMsg",                      DISPLAY_QINDEX,    1 }, /* 0x22 */
-  {"SetVbrMsg",                   DISPLAY_QINDEX,    0 }, /* 0x23 */
-  {"BtnStateMsg",                 DISPLAY_QINDEX,    0 }, /* 0x24 */
-  {"StopTimerMsg",                DISPLAY_QINDEX,    0 }, /* 0x25 */
-  {"SetRtcMsg",                   DISPLAY_QINDEX,    0 }, /* 0x26 */
-  {"GetRtcMsg",                   DISPLAY_QINDEX,    0 }, /* 0x27 */
-  {"GetRtcResp",                  WRAPPER_QINDEX,    1 }, /* 0x28 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x29 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x2f */
-  {"PropMsg",                     DISPLAY_QINDEX,    0 }, /* 0x30 */
-  {"PropResp",                    WRAPPER_QINDEX,    0 }, /* 0x31 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x32 */
-  {"ModChgIndMsg",                WRAPPER_QINDEX,    0 }, /* 0x33 */
-  {"BtnEventMsg",                 WRAPPER_QINDEX,    0 }, /* 0x34 */
-  {"GeneralPhoneMsg",             WRAPPER_QINDEX,    0 }, /* 0x35 */
-  {"GeneralWatchMsg",             DISPLAY_QINDEX,    0 }, /* 0x36 */
-  {"WrpTskMsg",                   WRAPPER_QINDEX,    0 }, /* 0x37 */
-  {"DspTskMsg",                   DISPLAY_QINDEX,    0 }, /* 0x38 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x39 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x3f */
-  {"WrtBufMsg",                   DISPLAY_QINDEX,    0 }, /* 0x40 */
-  {"ConfDispMsg",                 DISPLAY_QINDEX,    1 }, /* 0x41 */
-  {"ConfDrwTopMsg",               DISPLAY_QINDEX,    1 }, /* 0x42 */
-  {"UpdDispMsg",                  DISPLAY_QINDEX,    0 }, /* 0x43 */
-  {"LdTmplMsg",                   DISPLAY_QINDEX,    1 }, /* 0x44 */
-  {"ExtAppMsg",                   WRAPPER_QINDEX,    1 }, /* 0x45 */
-  {"EnBtnMsg",                    DISPLAY_QINDEX,    0 }, /* 0x46 */
-  {"DisBtnMsg",                   DISPLAY_QINDEX,    0 }, /* 0x47 */
-  {"RdBtnConfMsg",                DISPLAY_QINDEX,    0 }, /* 0x48 */
-  {"RdBtnConfResp",               WRAPPER_QINDEX,    0 }, /* 0x49 */
-  {"ExtAppIndMsg",                WRAPPER_QINDEX,    1 }, /* 0x4a */
-  {"EraseTmplMsg",                DISPLAY_QINDEX,    1 }, /* 0x4b */
-  {"WrtTmplMsg",                  DISPLAY_QINDEX,    1 }, /* 0x4c */
-  {"SetClkWgtMsg",                DISPLAY_QINDEX,    0 }, /* 0x4d */
-  {"DrwClkWgtMsg",                DISPLAY_QINDEX,    0 }, /* 0x4e */
-  {"LogMsg",                      WRAPPER_QINDEX,    1 }, /* 0x4f */
-  {"SetExtWgtMsg",                WRAPPER_QINDEX,    1 }, /* 0x50 */
-  {"UpdClkWgt",                   DISPLAY_QINDEX,    0 }, /* 0x51 */
-  {"BattChrgCtrlMsg",             DISPLAY_QINDEX,    0 }, /* 0x52 */
-  {"BattConfMsg",                 DISPLAY_QINDEX,    0 }, /* 0x53 */
-  {"LowBattIndMsg",               WRAPPER_QINDEX,    0 }, /* 0x54 */
-  {"LowBattBtOffIndMsg",          WRAPPER_QINDEX,    0 }, /* 0x55 */
-  {"RdBattVoltMsg",               DISPLAY_QINDEX,    0 }, /* 0x56 */
-  {"RdBattVoltResp",              WRAPPER_QINDEX,    1 }, /* 0x57 */
-  {"RdLightSensorMsg",            DISPLAY_QINDEX,    0 }, /* 0x58 */
-  {"RdLightSensorResp",           WRAPPER_QINDEX,    1 }, /* 0x59 */
-  {"LowBattMsg",                  DISPLAY_QINDEX,    0 }, /* 0x5a */
-  {"LowBattBtOffMsg",             DISPLAY_QINDEX,    0 }, /* 0x5b */
-  {"AutoBklightMsg",              DISPLAY_QINDEX,    0 }, /* 0x5c */
-  {"SetBacklightMsg",             DISPLAY_QINDEX,    0 }, /* 0x5d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x5e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x5f */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x60 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x61 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x62 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x63 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x64 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x65 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x66 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x67 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x68 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x69 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x6f */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x70 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x71 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x72 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x73 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x74 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x75 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x76 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x77 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x78 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x79 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x7f */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x80 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x81 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x82 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x83 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x84 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x85 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x86 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x87 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x88 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x89 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x8f */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x90 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x91 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x92 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x93 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x94 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x95 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x96 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x97 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x98 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x99 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9a */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9b */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9c */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9d */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9e */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0x9f */
-  {"IdleUpdMsg",                  DISPLAY_QINDEX,    0 }, /* 0xa0 */
-  {"SetWgtListMsg",               DISPLAY_QINDEX,    0 }, /* 0xa1 */
-  {"WatchDrawnTout",              DISPLAY_QINDEX,    0 }, /* 0xa2 */
-  {"AncsNtfMsg",                  WRAPPER_QINDEX,    0 }, /* 0xa3 */
-  {"AncsGetAttrMsg",              WRAPPER_QINDEX,    1 }, /* 0xa4 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xa5 */
-  {"ChgModMsg",                   DISPLAY_QINDEX,    0 }, /* 0xa6 */
-  {"ModeTimeoutMsg",              DISPLAY_QINDEX,    0 }, /* 0xa7 */
-  {"WatchStatusMsg",              DISPLAY_QINDEX,    0 }, /* 0xa8 */
-  {"MenuModeMsg",                 DISPLAY_QINDEX,    0 }, /* 0xa9 */
-  {"TrigSrvMenuMsg",              DISPLAY_QINDEX,    1 }, /* 0xaa */
-  {"LstPairedDevMsg",             DISPLAY_QINDEX,    0 }, /* 0xab */
-  {"BTStateChgMsg",               DISPLAY_QINDEX,    0 }, /* 0xac */
-  {"ModifyTimeMsg",               DISPLAY_QINDEX,    0 }, /* 0xad */
-  {"MenuBtnMsg",                  DISPLAY_QINDEX,    0 }, /* 0xae */
-  {"ToggleSecMsg",                DISPLAY_QINDEX,    0 }, /* 0xaf */
-  {"HBMsg",                       WRAPPER_QINDEX,    0 }, /* 0xb0 */
-  {"HBToutMsg",                   WRAPPER_QINDEX,    1 }, /* 0xb1 */
-  {"UpdIntvMsg",                  WRAPPER_QINDEX,    1 }, /* 0xb2 */
-  {"CallerIdIndMsg",              WRAPPER_QINDEX,    1 }, /* 0xb3 */
-  {"ShowCallMsg",                 DISPLAY_QINDEX,    1 }, /* 0xb4 */
-  {"CallerIdMsg",                 DISPLAY_QINDEX,    1 }, /* 0xb5 */
-  {"HfpMsg",                      WRAPPER_QINDEX,    0 }, /* 0xb6 */
-  {"MapMsg",                      WRAPPER_QINDEX,    0 }, /* 0xb7 */
-  {"MapIndMsg",                   WRAPPER_QINDEX,    0 }, /* 0xb8 */
-  {"ConnChgMsg",                  WRAPPER_QINDEX,    0 }, /* 0xb9 */
-  {"UpdWgtIndMsg",                WRAPPER_QINDEX,    0 }, /* 0xba */
-  {"IntvChgIndMsg",               WRAPPER_QINDEX,    1 }, /* 0xbb */
-  {"TunnelToutMsg",               WRAPPER_QINDEX,    0 }, /* 0xbc */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xbd */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xbe */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xbf */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc0 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc1 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc2 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc3 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc4 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc5 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc6 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc7 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc8 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xc9 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xca */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xcb */
-  {"AckMsg",                      WRAPPER_QINDEX,    1 }, /* 0xcc */
-  {"CntdwnMsg",                   DISPLAY_QINDEX,    0 }, /* 0xcd */
-  {"SetDoneMsg",                  DISPLAY_QINDEX,    0 }, /* 0xce */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xcf */
-  {"QueryMemMsg",                 WRAPPER_QINDEX,    0 }, /* 0xd0 */
-  {"ConnTypeMsg",                 WRAPPER_QINDEX,    1 }, /* 0xd1 */
-  {"RateTstMsg",                  DISPLAY_QINDEX,    1 }, /* 0xd2 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd3 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd4 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd5 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd6 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd7 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd8 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xd9 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xda */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xdb */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xdc */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xdd */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xde */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xdf */
-  {"AccelIndMsg",                 WRAPPER_QINDEX,    0 }, /* 0xe0 */
-  {"AccelMsg" ,                   DISPLAY_QINDEX,    0 }, /* 0xe1 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe2 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe3 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe4 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe5 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe6 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe7 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe8 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xe9 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xea */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xeb */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xec */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xed */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xee */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xef */
-  {"RadioPwrCtrlMsg",             WRAPPER_QINDEX,    1 }, /* 0xf0 */
-  {"EnableAdvMsg",                WRAPPER_QINDEX,    1 }, /* 0xf1 */
-  {"SetAdvDataMsg",               WRAPPER_QINDEX,    1 }, /* 0xf2 */
-  {"SetScanRespMsg",              WRAPPER_QINDEX,    1 }, /* 0xf3 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf4 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf5 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf6 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf7 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf8 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xf9 */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xfa */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xfb */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xfc */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xfd */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xfe */
-  {ReservedMsg,                   FREE_QINDEX,       0 }, /* 0xff */
-};
+#if !defined(MSG_INFO) || !defined(MSG_RESERVED)
+#error "MSG_INFO and MSG_RESERVED must be defined to include MessageInfo.h"
+#endif
 
-#endif /* MESSAGE_INFORMATION_H */
+/*        Name               Queue           Lane         Log Handler */
+  MSG_RESERVED()                                                                          /* 0x00 */
+  MSG_INFO(GetDevTypeMsg,     DISPLAY_QINDEX, LANE_NORMAL, 1, DevTypeMsgHandler)          /* 0x01 */
+  MSG_INFO(GetDevTypeResp,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x02 */
+  MSG_INFO(GetInfoMsg,        DISPLAY_QINDEX, LANE_NORMAL, 1, VerInfoMsgHandler)          /* 0x03 */
+  MSG_INFO(GetInfoResp,       WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x04 */
+  MSG_INFO(DiagLoopback,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x05 */
+  MSG_INFO(ShippingModMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x06 */
+  MSG_INFO(SoftResetMsg,      DISPLAY_QINDEX, LANE_NORMAL, 1, ResetMsgHandler)            /* 0x07 */
+  MSG_INFO(ConnTimeoutMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x08 */
+  MSG_INFO(TurnRadioOnMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x09 */
+  MSG_INFO(TurnRadioOffMsg,   WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x0a */
+  MSG_INFO(ReadRssiMsg,       WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x0b */
+  MSG_INFO(PairCtrlMsg,       WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x0c */
+  MSG_INFO(ReadRssiResp,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x0d */
+  MSG_INFO(SniffCtrlMsg,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x0e */
+  MSG_INFO(LnkAlmMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, LinkAlarmMsgHandler)        /* 0x0f */
+  MSG_INFO(OledWrtBufMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x10 */
+  MSG_INFO(OleConfModMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x11 */
+  MSG_INFO(OleChgModMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x12 */
+  MSG_INFO(OleWrtScrlBufMsg,  DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x13 */
+  MSG_INFO(OleScrlMsg,        DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x14 */
+  MSG_INFO(OleShowIdleBufMsg, DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x15 */
+  MSG_INFO(OleCrwnMenuMsg,    DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x16 */
+  MSG_INFO(OleCrwnMenuBtnMsg, DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x17 */
+  MSG_INFO(MusCtlMsg,         DISPLAY_QINDEX, LANE_NORMAL, 1, MusicStateMsgHandler)       /* 0x18 */
+  MSG_INFO(DrwMsg,            DISPLAY_QINDEX, LANE_NORMAL, 0, DrawMsgHandler)             /* 0x19 */
+  MSG_INFO(SetCliCfgMsg,      WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x1a */
+  MSG_INFO(HidMsg,            WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x1b */
+  MSG_INFO(MusicIcon,         DISPLAY_QINDEX, LANE_NORMAL, 0, MusicIconMsgHandler)        /* 0x1c */
+  MSG_RESERVED()                                                                          /* 0x1d */
+  MSG_RESERVED()                                                                          /* 0x1e */
+  MSG_RESERVED()                                                                          /* 0x1f */
+  MSG_INFO(WatchHandMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x20 */
+  MSG_INFO(TermModMsg,        DISPLAY_QINDEX, LANE_NORMAL, 1, TermModeMsgHandler)         /* 0x21 */
+  MSG_INFO(FtmMsg,            DISPLAY_QINDEX, LANE_NORMAL, 1, FieldTestMsgHandler)        /* 0x22 */
+  MSG_INFO(SetVbrMsg,         DISPLAY_QINDEX, LANE_URGENT, 0, SetVibrateModeHandler)      /* 0x23 */
+  MSG_INFO(BtnStateMsg,       DISPLAY_QINDEX, LANE_URGENT, 0, ButtonStateMsgHandler)      /* 0x24 */
+  MSG_INFO(StopTimerMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, StopTimerMsgHandler)        /* 0x25 */
+  MSG_INFO(SetRtcMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, SetRtcMsgHandler)           /* 0x26 */
+  MSG_INFO(GetRtcMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x27 */
+  MSG_INFO(GetRtcResp,        WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x28 */
+  MSG_RESERVED()                                                                          /* 0x29 */
+  MSG_RESERVED()                                                                          /* 0x2a */
+  MSG_RESERVED()                                                                          /* 0x2b */
+  MSG_RESERVED()                                                                          /* 0x2c */
+  MSG_RESERVED()                                                                          /* 0x2d */
+  MSG_RESERVED()                                                                          /* 0x2e */
+  MSG_RESERVED()                                                                          /* 0x2f */
+  MSG_INFO(PropMsg,           DISPLAY_QINDEX, LANE_NORMAL, 0, NvalOperationHandler)       /* 0x30 */
+  MSG_INFO(PropResp,          WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x31 */
+  MSG_RESERVED()                                                                          /* 0x32 */
+  MSG_INFO(ModChgIndMsg,      WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x33 */
+  MSG_INFO(BtnEventMsg,       WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x34 */
+  MSG_INFO(GeneralPhoneMsg,   WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x35 */
+  MSG_INFO(GeneralWatchMsg,   DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x36 */
+  MSG_INFO(WrpTskMsg,         WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x37 */
+  MSG_INFO(DspTskMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x38 */
+  MSG_RESERVED()                                                                          /* 0x39 */
+  MSG_RESERVED()                                                                          /* 0x3a */
+  MSG_RESERVED()                                                                          /* 0x3b */
+  MSG_RESERVED()                                                                          /* 0x3c */
+  MSG_RESERVED()                                                                          /* 0x3d */
+  MSG_RESERVED()                                                                          /* 0x3e */
+  MSG_RESERVED()                                                                          /* 0x3f */
+  MSG_INFO(WrtBufMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, WriteBufferHandler)         /* 0x40 */
+  MSG_INFO(ConfDispMsg,       DISPLAY_QINDEX, LANE_NORMAL, 1, SecInvertMsgHandler)        /* 0x41 */
+  MSG_INFO(ConfDrwTopMsg,     DISPLAY_QINDEX, LANE_NORMAL, 1, ControlFullScreenMsgHandler)/* 0x42 */
+  MSG_INFO(UpdDispMsg,        DISPLAY_QINDEX, LANE_NORMAL, 0, UpdateDisplayMsgHandler)    /* 0x43 */
+  MSG_INFO(LdTmplMsg,         DISPLAY_QINDEX, LANE_NORMAL, 1, LoadTemplateHandler)        /* 0x44 */
+  MSG_INFO(ExtAppMsg,         WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x45 */
+  MSG_INFO(EnBtnMsg,          DISPLAY_QINDEX, LANE_NORMAL, 0, EnableButtonMsgHandler)     /* 0x46 */
+  MSG_INFO(DisBtnMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, DisableButtonMsgHandler)    /* 0x47 */
+  MSG_INFO(RdBtnConfMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, ReadButtonConfigHandler)    /* 0x48 */
+  MSG_INFO(RdBtnConfResp,     WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x49 */
+  MSG_INFO(ExtAppIndMsg,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x4a */
+  MSG_INFO(EraseTmplMsg,      DISPLAY_QINDEX, LANE_NORMAL, 1, IgnoreMsgHandler)           /* 0x4b */
+  MSG_INFO(WrtTmplMsg,        DISPLAY_QINDEX, LANE_NORMAL, 1, IgnoreMsgHandler)           /* 0x4c */
+  MSG_INFO(SetClkWgtMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x4d */
+  MSG_INFO(DrwClkWgtMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, DrawClockWidgetMsgHandler)  /* 0x4e */
+  MSG_INFO(LogMsg,            WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x4f */
+  MSG_INFO(SetExtWgtMsg,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x50 */
+  MSG_INFO(UpdClkWgt,         DISPLAY_QINDEX, LANE_NORMAL, 0, UpdateClockMsgHandler)      /* 0x51 */
+  MSG_INFO(BattChrgCtrlMsg,   DISPLAY_QINDEX, LANE_NORMAL, 0, MonitorBatteryMsgHandler)   /* 0x52 */
+  MSG_INFO(BattConfMsg,       DISPLAY_QINDEX, LANE_NORMAL, 0, BatteryConfigMsgHandler)    /* 0x53 */
+  MSG_INFO(LowBattIndMsg,     WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x54 */
+  MSG_INFO(LowBattBtOffIndMsg,WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0x55 */
+  MSG_INFO(RdBattVoltMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, ReadBatteryVoltageMsgHandler)/* 0x56 */
+  MSG_INFO(RdBattVoltResp,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x57 */
+  MSG_INFO(RdLightSensorMsg,  DISPLAY_QINDEX, LANE_NORMAL, 0, ReadLightSensorMsgHandler)  /* 0x58 */
+  MSG_INFO(RdLightSensorResp, WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0x59 */
+  MSG_INFO(LowBattMsg,        DISPLAY_QINDEX, LANE_NORMAL, 0, IgnoreMsgHandler)           /* 0x5a */
+  MSG_INFO(LowBattBtOffMsg,   DISPLAY_QINDEX, LANE_NORMAL, 0, UpdateClockMsgHandler)      /* 0x5b */
+  MSG_INFO(AutoBklightMsg,    DISPLAY_QINDEX, LANE_NORMAL, 0, AutoBacklightMsgHandler)    /* 0x5c */
+  MSG_INFO(SetBacklightMsg,   DISPLAY_QINDEX, LANE_NORMAL, 0, SetBacklightMsgHandler)     /* 0x5d */
+  MSG_RESERVED()                                                                          /* 0x5e */
+  MSG_RESERVED()                                                                          /* 0x5f */
+  MSG_RESERVED()                                                                          /* 0x60 */
+  MSG_RESERVED()                                                                          /* 0x61 */
+  MSG_RESERVED()                                                                          /* 0x62 */
+  MSG_RESERVED()                                                                          /* 0x63 */
+  MSG_RESERVED()                                                                          /* 0x64 */
+  MSG_RESERVED()                                                                          /* 0x65 */
+  MSG_RESERVED()                                                                          /* 0x66 */
+  MSG_RESERVED()                                                                          /* 0x67 */
+  MSG_RESERVED()                                                                          /* 0x68 */
+  MSG_RESERVED()                                                                          /* 0x69 */
+  MSG_RESERVED()                                                                          /* 0x6a */
+  MSG_RESERVED()                                                                          /* 0x6b */
+  MSG_RESERVED()                                                                          /* 0x6c */
+  MSG_RESERVED()                                                                          /* 0x6d */
+  MSG_RESERVED()                                                                          /* 0x6e */
+  MSG_RESERVED()                                                                          /* 0x6f */
+  MSG_RESERVED()                                                                          /* 0x70 */
+  MSG_RESERVED()                                                                          /* 0x71 */
+  MSG_RESERVED()                                                                          /* 0x72 */
+  MSG_RESERVED()                                                                          /* 0x73 */
+  MSG_RESERVED()                                                                          /* 0x74 */
+  MSG_RESERVED()                                                                          /* 0x75 */
+  MSG_RESERVED()                                                                          /* 0x76 */
+  MSG_RESERVED()                                                                          /* 0x77 */
+  MSG_RESERVED()                                                                          /* 0x78 */
+  MSG_RESERVED()                                                                          /* 0x79 */
+  MSG_RESERVED()                                                                          /* 0x7a */
+  MSG_RESERVED()                                                                          /* 0x7b */
+  MSG_RESERVED()                                                                          /* 0x7c */
+  MSG_RESERVED()                                                                          /* 0x7d */
+  MSG_RESERVED()                                                                          /* 0x7e */
+  MSG_RESERVED()                                                                          /* 0x7f */
+  MSG_RESERVED()                                                                          /* 0x80 */
+  MSG_RESERVED()                                                                          /* 0x81 */
+  MSG_RESERVED()                                                                          /* 0x82 */
+  MSG_RESERVED()                                                                          /* 0x83 */
+  MSG_RESERVED()                                                                          /* 0x84 */
+  MSG_RESERVED()                                                                          /* 0x85 */
+  MSG_RESERVED()                                                                          /* 0x86 */
+  MSG_RESERVED()                                                                          /* 0x87 */
+  MSG_RESERVED()                                                                          /* 0x88 */
+  MSG_RESERVED()                                                                          /* 0x89 */
+  MSG_RESERVED()                                                                          /* 0x8a */
+  MSG_RESERVED()                                                                          /* 0x8b */
+  MSG_RESERVED()                                                                          /* 0x8c */
+  MSG_RESERVED()                                                                          /* 0x8d */
+  MSG_RESERVED()                                                                          /* 0x8e */
+  MSG_RESERVED()                                                                          /* 0x8f */
+  MSG_RESERVED()                                                                          /* 0x90 */
+  MSG_RESERVED()                                                                          /* 0x91 */
+  MSG_RESERVED()                                                                          /* 0x92 */
+  MSG_RESERVED()                                                                          /* 0x93 */
+  MSG_RESERVED()                                                                          /* 0x94 */
+  MSG_RESERVED()                                                                          /* 0x95 */
+  MSG_RESERVED()                                                                          /* 0x96 */
+  MSG_RESERVED()                                                                          /* 0x97 */
+  MSG_RESERVED()                                                                          /* 0x98 */
+  MSG_RESERVED()                                                                          /* 0x99 */
+  MSG_RESERVED()                                                                          /* 0x9a */
+  MSG_RESERVED()                                                                          /* 0x9b */
+  MSG_RESERVED()                                                                          /* 0x9c */
+  MSG_RESERVED()                                                                          /* 0x9d */
+  MSG_RESERVED()                                                                          /* 0x9e */
+  MSG_RESERVED()                                                                          /* 0x9f */
+  MSG_INFO(IdleUpdMsg,        DISPLAY_QINDEX, LANE_NORMAL, 0, IdleUpdateMsgHandler)       /* 0xa0 */
+  MSG_INFO(SetWgtListMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, SetWidgetList)              /* 0xa1 */
+  MSG_INFO(WatchDrawnTout,    DISPLAY_QINDEX, LANE_NORMAL, 0, IdleUpdateMsgHandler)       /* 0xa2 */
+  MSG_INFO(AncsNtfMsg,        WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xa3 */
+  MSG_INFO(AncsGetAttrMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xa4 */
+  MSG_RESERVED()                                                                          /* 0xa5 */
+  MSG_INFO(ChgModMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, ChangeModeMsgHandler)       /* 0xa6 */
+  MSG_INFO(ModeTimeoutMsg,    DISPLAY_QINDEX, LANE_NORMAL, 0, ModeTimeoutMsgHandler)      /* 0xa7 */
+  MSG_INFO(WatchStatusMsg,    DISPLAY_QINDEX, LANE_NORMAL, 0, WatchStatusMsgHandler)      /* 0xa8 */
+  MSG_INFO(MenuModeMsg,       DISPLAY_QINDEX, LANE_NORMAL, 0, MenuModeMsgHandler)         /* 0xa9 */
+  MSG_INFO(TrigSrvMenuMsg,    DISPLAY_QINDEX, LANE_NORMAL, 1, ServiceMenuMsgHandler)      /* 0xaa */
+  MSG_INFO(LstPairedDevMsg,   DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xab */
+  MSG_INFO(BTStateChgMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, BluetoothStateChangeHandler)/* 0xac */
+  MSG_INFO(ModifyTimeMsg,     DISPLAY_QINDEX, LANE_NORMAL, 0, ModifyTimeHandler)          /* 0xad */
+  MSG_INFO(MenuBtnMsg,        DISPLAY_QINDEX, LANE_URGENT, 0, MenuButtonMsgHandler)       /* 0xae */
+  MSG_INFO(ToggleSecMsg,      DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xaf */
+  MSG_INFO(HBMsg,             WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xb0 */
+  MSG_INFO(HBToutMsg,         WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xb1 */
+  MSG_INFO(UpdIntvMsg,        WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xb2 */
+  MSG_INFO(CallerIdIndMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xb3 */
+  MSG_INFO(ShowCallMsg,       DISPLAY_QINDEX, LANE_URGENT, 1, ShowCallMsgHandler)         /* 0xb4 */
+  MSG_INFO(CallerIdMsg,       DISPLAY_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xb5 */
+  MSG_INFO(HfpMsg,            WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xb6 */
+  MSG_INFO(MapMsg,            WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xb7 */
+  MSG_INFO(MapIndMsg,         WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xb8 */
+  MSG_INFO(ConnChgMsg,        WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xb9 */
+  MSG_INFO(UpdWgtIndMsg,      WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xba */
+  MSG_INFO(IntvChgIndMsg,     WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xbb */
+  MSG_INFO(TunnelToutMsg,     WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xbc */
+  MSG_RESERVED()                                                                          /* 0xbd */
+  MSG_RESERVED()                                                                          /* 0xbe */
+  MSG_RESERVED()                                                                          /* 0xbf */
+  MSG_RESERVED()                                                                          /* 0xc0 */
+  MSG_RESERVED()                                                                          /* 0xc1 */
+  MSG_RESERVED()                                                                          /* 0xc2 */
+  MSG_RESERVED()                                                                          /* 0xc3 */
+  MSG_RESERVED()                                                                          /* 0xc4 */
+  MSG_RESERVED()                                                                          /* 0xc5 */
+  MSG_RESERVED()                                                                          /* 0xc6 */
+  MSG_RESERVED()                                                                          /* 0xc7 */
+  MSG_RESERVED()                                                                          /* 0xc8 */
+  MSG_RESERVED()                                                                          /* 0xc9 */
+  MSG_RESERVED()                                                                          /* 0xca */
+  MSG_RESERVED()                                                                          /* 0xcb */
+  MSG_INFO(AckMsg,            WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xcc */
+  MSG_INFO(CntdwnMsg,         DISPLAY_QINDEX, LANE_NORMAL, 0, CountdownMsgHandler)        /* 0xcd */
+  MSG_INFO(SetDoneMsg,        DISPLAY_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xce */
+  MSG_RESERVED()                                                                          /* 0xcf */
+  MSG_INFO(QueryMemMsg,       WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xd0 */
+  MSG_INFO(ConnTypeMsg,       WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xd1 */
+  MSG_INFO(RateTstMsg,        DISPLAY_QINDEX, LANE_NORMAL, 1, RateTestMsgHandler)         /* 0xd2 */
+  MSG_RESERVED()                                                                          /* 0xd3 */
+  MSG_RESERVED()                                                                          /* 0xd4 */
+  MSG_RESERVED()                                                                          /* 0xd5 */
+  MSG_RESERVED()                                                                          /* 0xd6 */
+  MSG_RESERVED()                                                                          /* 0xd7 */
+  MSG_RESERVED()                                                                          /* 0xd8 */
+  MSG_RESERVED()                                                                          /* 0xd9 */
+  MSG_RESERVED()                                                                          /* 0xda */
+  MSG_RESERVED()                                                                          /* 0xdb */
+  MSG_RESERVED()                                                                          /* 0xdc */
+  MSG_RESERVED()                                                                          /* 0xdd */
+  MSG_RESERVED()                                                                          /* 0xde */
+  MSG_RESERVED()                                                                          /* 0xdf */
+  MSG_INFO(AccelIndMsg,       WRAPPER_QINDEX, LANE_NORMAL, 0, NULL)                       /* 0xe0 */
+  MSG_INFO(AccelMsg,          DISPLAY_QINDEX, LANE_NORMAL, 0, HandleAccelerometer)        /* 0xe1 */
+  MSG_RESERVED()                                                                          /* 0xe2 */
+  MSG_RESERVED()                                                                          /* 0xe3 */
+  MSG_RESERVED()                                                                          /* 0xe4 */
+  MSG_RESERVED()                                                                          /* 0xe5 */
+  MSG_RESERVED()                                                                          /* 0xe6 */
+  MSG_RESERVED()                                                                          /* 0xe7 */
+  MSG_RESERVED()                                                                          /* 0xe8 */
+  MSG_RESERVED()                                                                          /* 0xe9 */
+  MSG_RESERVED()                                                                          /* 0xea */
+  MSG_RESERVED()                                                                          /* 0xeb */
+  MSG_RESERVED()                                                                          /* 0xec */
+  MSG_RESERVED()                                                                          /* 0xed */
+  MSG_RESERVED()                                                                          /* 0xee */
+  MSG_RESERVED()                                                                          /* 0xef */
+  MSG_INFO(RadioPwrCtrlMsg,   WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xf0 */
+  MSG_INFO(EnableAdvMsg,      WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xf1 */
+  MSG_INFO(SetAdvDataMsg,     WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xf2 */
+  MSG_INFO(SetScanRespMsg,    WRAPPER_QINDEX, LANE_NORMAL, 1, NULL)                       /* 0xf3 */
+  MSG_RESERVED()                                                                          /* 0xf4 */
+  MSG_RESERVED()                                                                          /* 0xf5 */
+  MSG_RESERVED()                                                                          /* 0xf6 */
+  MSG_RESERVED()                                                                          /* 0xf7 */
+  MSG_RESERVED()                                                                          /* 0xf8 */
+  MSG_RESERVED()                                                                          /* 0xf9 */
+  MSG_RESERVED()                                                                          /* 0xfa */
+  MSG_RESERVED()                                                                          /* 0xfb */
+  MSG_RESERVED()                                                                          /* 0xfc */
+  MSG_RESERVED()                                                                          /* 0xfd */
+  MSG_RESERVED()                                                                          /* 0xfe */
+  MSG_RESERVED()                                                                          /* 0xff */
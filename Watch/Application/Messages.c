@@ -25,24 +25,72 @@
 #include "task.h"
 #include "hal_board_type.h"
 #include "Messages.h"
-#include "MessageInfo.h"
 #include "DebugUart.h"
 #include "IdleTask.h"
 #include "Log.h"
+#include "BufferPool.h"
+#include "Statistics.h"
+#include "Trace.h"
 
 #define QUEUE_NUM         2
 xQueueHandle QueueHandles[QUEUE_NUM];
+xQueueHandle UrgentQueueHandle;
+
+/* deepest each lane has been: display, wrapper, display urgent */
+#define URGENT_LANE       QUEUE_NUM
+static unsigned char MaxLaneDepth[QUEUE_NUM + 1];
+
+/* lane of the message the display task is handling */
+static unsigned char HandlingLane = LANE_NORMAL;
+extern xTaskHandle DisplayTaskHandle;
+
+/* display queue flow control: when it runs low on free slots the phone is
+ * sent an SppAckMsg whose options hold the number of free slots, and again
+ * once the queue has drained. SppAckMsg is already forwarded to the phone
+ * by the stack. Routing never waits for a slot, so a full queue still drops
+ * the message (counted in QueueOverflow) rather than stalling the sender. */
+#define CREDIT_LOW_WATER    (DISPLAY_QUEUE_LENGTH / 8)
+#define CREDIT_HIGH_WATER   (DISPLAY_QUEUE_LENGTH / 2)
+
+static unsigned char CreditStalled = FALSE;
+
+static void LaneQueued(unsigned char Lane, xQueueHandle Handle, portBASE_TYPE Result, unsigned char Front);
+static void CountQueueOverflow(unsigned char Index);
 
 #define HEAP_MIN_ADDR     (0x2000)
 
+#if MESSAGE_STRINGS
+static char const ReservedMsg[] = "ReservedMsg";
+
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) {#_Name, _Queue, _Lane, _Log},
+#define MSG_RESERVED()  {ReservedMsg, FREE_QINDEX, LANE_NORMAL, 0},
+#else
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) {_Queue, _Lane, _Log},
+#define MSG_RESERVED()  {FREE_QINDEX, LANE_NORMAL, 0},
+#endif
+
+tMsgInfo const MsgInfo[MAXIMUM_MESSAGE_TYPES] =
+{
+#include "MessageInfo.h"
+};
+
+#undef MSG_INFO
+#undef MSG_RESERVED
+
 unsigned char *CreateMessage(tMessage *pMsg)
 {
-  pMsg->pBuffer = (unsigned char *)pvPortMalloc(pMsg->Length + MSG_OVERHEAD_LENGTH);
-  
-  if (pMsg->pBuffer < (volatile unsigned char *)HEAP_MIN_ADDR)
+  /* only oversize messages or an empty pool go to the heap */
+  pMsg->pBuffer = GetPoolBuffer(pMsg->Length + MSG_OVERHEAD_LENGTH);
+
+  if (!pMsg->pBuffer)
   {
-    PrintF("@^@ %04X:%u", pMsg->pBuffer, pMsg->Length + MSG_OVERHEAD_LENGTH);
-    pMsg->pBuffer = NULL;
+    pMsg->pBuffer = (unsigned char *)pvPortMallocFrom(pMsg->Length + MSG_OVERHEAD_LENGTH, HEAP_SITE_MSG);
+    
+    if (pMsg->pBuffer < (volatile unsigned char *)HEAP_MIN_ADDR)
+    {
+      PrintF("@^@ %04X:%u", pMsg->pBuffer, pMsg->Length + MSG_OVERHEAD_LENGTH);
+      pMsg->pBuffer = NULL;
+    }
   }
 //  else PrintF("+%04X:%u", pMsg->pBuffer, pMsg->Length + MSG_OVERHEAD_LENGTH);
 
@@ -52,7 +100,7 @@ unsigned char *CreateMessage(tMessage *pMsg)
 
 void FreeMessageBuffer(unsigned char *pBuffer)
 {
-  vPortFree(pBuffer - MSG_HEADER_LENGTH);
+  if (!ReleasePoolBuffer(pBuffer - MSG_HEADER_LENGTH)) vPortFree(pBuffer - MSG_HEADER_LENGTH);
 //  PrintF("-%04X", pBuffer - MSG_HEADER_LENGTH);
 }
 
@@ -67,15 +115,53 @@ void RouteMsg(tMessage *pMsg)
   if (pMsg->Length == 0 && pMsg->pBuffer || pMsg->Length && pMsg->pBuffer == NULL)
   {
     if (pMsg->pBuffer) FreeMessageBuffer(pMsg->pBuffer);
+#if MESSAGE_STRINGS
     PrintF("# Memleak:%s", MsgInfo[pMsg->Type].MsgStr);
+#else
+    PrintF("# Memleak:x%02X", pMsg->Type);
+#endif
     return;
   }
 
-  portBASE_TYPE Result = xQueueSend(QueueHandles[MsgInfo[pMsg->Type].MsgQueue], pMsg, DONT_WAIT);
+#if TRACE_CAPTURE
+  TraceMsg(pMsg);
+#endif
+
+  unsigned char Index = MsgInfo[pMsg->Type].MsgQueue;
+  unsigned char Lane = MsgInfo[pMsg->Type].Lane;
+  portBASE_TYPE Result;
+
+  /* what the display task sends itself for an urgent message (a button
+   * action, the redraw of a mode change) is part of the same user action */
+  if (Index == DISPLAY_QINDEX && HandlingLane == LANE_URGENT &&
+      xTaskGetCurrentTaskHandle() == DisplayTaskHandle) Lane = LANE_URGENT;
+
+  if (Lane == LANE_NORMAL)
+  {
+    Result = xQueueSend(QueueHandles[Index], pMsg, DONT_WAIT);
+    LaneQueued(Index, QueueHandles[Index], Result, FALSE);
+    if (Index == DISPLAY_QINDEX) UpdateDisplayCredit();
+  }
+  else if (Index == DISPLAY_QINDEX)
+  {
+    Result = xQueueSend(UrgentQueueHandle, pMsg, DONT_WAIT);
+    LaneQueued(URGENT_LANE, UrgentQueueHandle, Result, FALSE);
+
+    if (Result == pdPASS)
+    {
+      tMessage Token = {0, LaneTokenMsg, MSG_OPT_NONE, NULL};
+      xQueueSendToFront(QueueHandles[DISPLAY_QINDEX], &Token, DONT_WAIT);
+    }
+  }
+  else
+  {
+    Result = xQueueSendToFront(QueueHandles[Index], pMsg, DONT_WAIT);
+    LaneQueued(Index, QueueHandles[Index], Result, TRUE);
+  }
   
   if (Result == errQUEUE_FULL)
   {
-    PrintF("#%c Q Full", MsgInfo[pMsg->Type].MsgQueue == WRAPPER_QINDEX ? 'W' : 'D');
+    CountQueueOverflow(Index);
     if (pMsg->pBuffer) FreeMessageBuffer(pMsg->pBuffer);
   }
 }
@@ -90,14 +176,92 @@ void SendMessageIsr(unsigned char Type, unsigned char Options)
   signed portBASE_TYPE HigherPriorityTaskWoken;
   
   tMessage Msg = {0, Type, Options, NULL};
+  unsigned char Index = MsgInfo[Type].MsgQueue;
+  portBASE_TYPE Result;
+
+  if (MsgInfo[Type].Lane == LANE_NORMAL)
+  {
+    Result = xQueueSendFromISR(QueueHandles[Index], &Msg, &HigherPriorityTaskWoken);
+    LaneQueued(Index, QueueHandles[Index], Result, FALSE);
+  }
+  else if (Index == DISPLAY_QINDEX)
+  {
+    Result = xQueueSendFromISR(UrgentQueueHandle, &Msg, &HigherPriorityTaskWoken);
+    LaneQueued(URGENT_LANE, UrgentQueueHandle, Result, FALSE);
 
-  if (errQUEUE_FULL == xQueueSendFromISR(QueueHandles[MsgInfo[Type].MsgQueue], &Msg, &HigherPriorityTaskWoken))
-    PrintF("#%c Q Full", MsgInfo[Type].MsgQueue == WRAPPER_QINDEX ? 'W' : 'D');
+    if (Result == pdPASS)
+    {
+      Msg.Type = LaneTokenMsg;
+      Msg.Options = MSG_OPT_NONE;
+      xQueueSendToFrontFromISR(QueueHandles[DISPLAY_QINDEX], &Msg, &HigherPriorityTaskWoken);
+    }
+  }
+  else
+  {
+    Result = xQueueSendToFrontFromISR(QueueHandles[Index], &Msg, &HigherPriorityTaskWoken);
+    LaneQueued(Index, QueueHandles[Index], Result, TRUE);
+  }
+
+  if (Result == errQUEUE_FULL) CountQueueOverflow(Index);
+}
+
+static void CountQueueOverflow(unsigned char Index)
+{
+  if (gAppStats.QueueOverflow < 0xFF) gAppStats.QueueOverflow ++;
+  PrintF("#%c Q Full", Index == WRAPPER_QINDEX ? 'W' : 'D');
+}
+
+void UpdateDisplayCredit(void)
+{
+  unsigned char Free;
+  unsigned char Changed = FALSE;
+
+  /* the queue and CreditStalled change under the wrapper and display tasks */
+  portENTER_CRITICAL();
+  Free = DISPLAY_QUEUE_LENGTH - QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting;
+  if (!CreditStalled && Free < CREDIT_LOW_WATER || CreditStalled && Free >= CREDIT_HIGH_WATER)
+  {
+    CreditStalled = !CreditStalled;
+    Changed = TRUE;
+  }
+  portEXIT_CRITICAL();
+
+  if (Changed) SendMessage(SppAckMsg, Free);
 }
 
-void ShowMessageInfo(tMessage *pMsg)
+static void LaneQueued(unsigned char Lane, xQueueHandle Handle, portBASE_TYPE Result, unsigned char Front)
 {
+  if (Result != pdPASS) return;
+
+  MessageQueued(Lane, Front);
+
+  unsigned char Depth = Handle->uxMessagesWaiting;
+  if (Depth > MaxLaneDepth[Lane]) MaxLaneDepth[Lane] = Depth;
+}
+
+void ShowLaneInfo(void)
+{
+  PrintF("D:%u/%u U:%u/%u", QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting,
+    MaxLaneDepth[DISPLAY_QINDEX], UrgentQueueHandle->uxMessagesWaiting, MaxLaneDepth[URGENT_LANE]);
+  PrintF("W:%u/%u", QueueHandles[WRAPPER_QINDEX]->uxMessagesWaiting, MaxLaneDepth[WRAPPER_QINDEX]);
+}
+
+void ShowMessageInfo(tMessage *pMsg, unsigned char Lane)
+{
+  unsigned char Index = MsgInfo[pMsg->Type].MsgQueue;
+
+  HandlingLane = Lane;
+
+  if (Index != FREE_QINDEX)
+  {
+    MessageReceived(pMsg->Type, Lane == LANE_URGENT ? URGENT_LANE : Index, Index);
+  }
+
+#if MESSAGE_STRINGS
   if (MsgInfo[pMsg->Type].Log) PrintF("%s x%02X", MsgInfo[pMsg->Type].MsgStr, pMsg->Options);
+#else
+  if (MsgInfo[pMsg->Type].Log) PrintF("Msg:x%02X x%02X", pMsg->Type, pMsg->Options);
+#endif
 
   UpdateLog(pMsg->Type, pMsg->Options);
   UpdateQueueInfo();
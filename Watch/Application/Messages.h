@@ -65,6 +65,7 @@ typedef struct
  */
 typedef enum
 {
+  LaneTokenMsg = 0x00,
   DevTypeMsg = 0x01,
   DevTypeRespMsg = 0x02,
   VerInfoMsg = 0x03,
@@ -749,6 +750,25 @@ typedef struct
 #define DISPLAY_QUEUE_LENGTH   128 //16
 #define WRAPPER_QUEUE_LENGTH   32 //20, 16
 
+/* urgent display messages wait in their own queue; a LaneTokenMsg put at
+ * the front of the display queue wakes the display task up for them */
+#define LANE_NORMAL            0
+#define LANE_URGENT            1
+#define URGENT_QUEUE_LENGTH    8
+
+/*! routing information of a message type (generated from MessageInfo.h) */
+typedef struct
+{
+#if MESSAGE_STRINGS
+  char const * const MsgStr;
+#endif
+  unsigned char MsgQueue;
+  unsigned char Lane;
+  unsigned char Log;
+} tMsgInfo;
+
+extern tMsgInfo const MsgInfo[MAXIMUM_MESSAGE_TYPES];
+
 unsigned char *CreateMessage(tMessage *pMsg);
 void FreeMessageBuffer(unsigned char *pBuffer);
 
@@ -763,7 +783,19 @@ void SendMessageIsr(unsigned char Type, unsigned char Options);
  */
 void RouteMsg(tMessage *pMsg);
 
-/*! Print the message type */
-void ShowMessageInfo(tMessage *pMsg);
+/*! Print the message type; called by the display task for each message it
+ * handles
+ *
+ * \param Lane the lane it came in: while an urgent message is handled, the
+ * display messages the display task routes are urgent too
+ */
+void ShowMessageInfo(tMessage *pMsg, unsigned char Lane);
+
+/*! Print current and maximum depth of the display, urgent and wrapper lanes */
+void ShowLaneInfo(void);
+
+/*! Tell the phone the number of free display queue slots (SppAckMsg options) when
+ * the queue runs low and when it has drained again */
+void UpdateDisplayCredit(void);
 
 #endif  /* MESSAGES_H */
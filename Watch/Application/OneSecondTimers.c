@@ -91,7 +91,7 @@ void StartTimer(eTimerId Id)
   }
 
   // create a timer
-  Timer_t *pNext = (Timer_t *)pvPortMalloc(TIMER_SIZE);
+  Timer_t *pNext = (Timer_t *)pvPortMallocFrom(TIMER_SIZE, HEAP_SITE_TIMER);
   PrintF("CrtTmr:%s", TimerName[Id]);
 
   pNext->Id = Id;
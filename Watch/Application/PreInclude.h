@@ -78,6 +78,33 @@
 
 /*! when 0 the message type is printed in hex, when 1 it is not */
 #define PRINT_MESSAGE_OPTIONS   1
+
+/*! keep message names for printing, 0 prints the message type in hex */
+#define MESSAGE_STRINGS         1
+
+/*! keep queue wait and service time histograms of the most used message types */
+#define MESSAGE_TIMING          1
+
+/*! allow recording the routed messages into the spare serial ram (256 Kbit part) */
+#define TRACE_CAPTURE           1
+
+/*! mode buffer lines kept in a write-back cache in MCU ram for drawing
+ * (16 bytes each), 0 draws every bitmap straight to the serial ram */
+#ifndef SRAM_LINE_CACHE
+#define SRAM_LINE_CACHE         8
+#endif
+
+/*! a text is drawn into its lines read into MCU ram at once and written
+ * back at once (SerialRam.c), 0 draws it a character and a row at a time;
+ * the host build draws both ways to compare them */
+#ifndef SRAM_DRAW_BAND
+#define SRAM_DRAW_BAND          1
+#endif
+
+/*! keep the next older notification page read into MCU ram (1344 bytes of
+ * heap while in notification mode, given back on leaving it) so paging
+ * needs no serial ram read */
+#define NOTIF_READ_AHEAD        1
    
 /*! use mutex to attempt to make string printing look prettier */
 #define PRETTY_PRINT            1
@@ -26,41 +26,53 @@
 #include "DrawHandler.h"
 #include "ClockWidget.h"
 #include "LcdDriver.h"
+#include "hal_serial_ram.h"
+#include "BitmapData.h"
 #include "SerialRam.h"
+#include "SramMap.h"
 #include "LcdDisplay.h"
 #include "LcdBuffer.h"
-#include "BitmapData.h"
 #include "CallNotifier.h"
 #include "Property.h"
 #include "Widget.h"
+#include "Statistics.h"
+#include "hal_rtc.h"
 
-/* write and read status register */
-#define SPI_RDSR                (0x05)
-#define SPI_WRSR                (0x01)
-#define SPI_OVERHEAD            (3)
-#define SPI_INIT_DELAY_IN_MS    (10 * portTICK_RATE_MS)
-
-/* the 256Kbit part does not have a 1 in bit position 1 */
-#define DEFAULT_SR_VALUE        (0x02)
-#define FINAL_SR_VALUE          (0x43)
-#define DEFAULT_SR_VALUE_256    (0x00)
-#define FINAL_SR_VALUE_256      (0x41)
-#define SEQUENTIAL_MODE_COMMAND (0x41)
-
-#define SRAM_TOTAL_SIZE         (8 * 1024)
-#define MODE_BUF_START_ADDR     (0x0E00) // 1152x3 = 3456
-#define MODE_BUFFER_SIZE        (0x1200) // 1152x4
-#define WGT_BUF_START_ADDR      (0x80) //(1024x8-1152x7=128 (0x1B00) // 96x12x(4 + 2) = 6912
+#define WGT_BUF_START_ADDR      (SramRegionAddr(SRAM_REGION_WIDGET))
 
 #define WRITE_BUFFER_TWO_LINES     (0x00)
 #define MSG_OPT_WRTBUF_BPL_MASK    (0x38)
 
-#define STATUS_BAR_IN_MODES ((1 << IDLE_MODE) | (1 << APP_MODE)) // | (1 << MUSIC_MODE))
+/* taller bands are not worth the heap; those bitmaps are drawn row by row */
+#define SRAM_BAND_MAX_ROWS        32
+
+/* lines read from the serial ram in one transaction (at least 2) */
+#define LCD_BURST_LINES           8
+/* a burst is read into the end of its line buffer and spread out in place;
+ * there are two line buffers so one is read while the other goes to the lcd */
+#define LCD_BURST_OFFSET          (sizeof(tLcdLine) * LCD_BURST_LINES - \
+                                   BYTES_PER_LINE * LCD_BURST_LINES - SRAM_READ_OVERHEAD)
+
+/* templates are decoded into LineBuf and written to the serial ram in bursts;
+ * drawn lines are copied between the pages of a mode the same way */
+#define LINE_BUF_LINES            8
+#define LINE_BUF_LEN              (BYTES_PER_LINE * LINE_BUF_LINES)
 
-#define IDLE_PAGE_NUM             4
-#define NOTIF_TOTAL_PAGES         5
 #define DRAW_PAGE                 0
 #define SHOW_PAGE                 1
+/* one bit for each row drawn since a mode was last flipped */
+#define ROW_MASK_BYTES            (LCD_ROW_NUM / 8)
+
+#define STATUS_BAR_IN_MODES ((1 << IDLE_MODE) | (1 << APP_MODE)) // | (1 << MUSIC_MODE))
+
+#define NOTIF_TOTAL_PAGES         (SramRegionUnits(SRAM_REGION_NOTIF))
+
+/* where a notification page came from */
+#define NOTIF_SRC_PHONE           'P'
+#define NOTIF_SRC_CALL            'C'
+
+/* the next page is only read ahead if the heap keeps this much besides */
+#define READ_AHEAD_HEAP_RESERVE   1024
 
 #define TEMPLATE_1                2  //starts at 2 because 0,1 are clear and fill
 #define TEMPLATE_2                3
@@ -70,20 +82,69 @@
 /* errata - DMA variables cannot be function scope */
 static unsigned char const DummyData = 0x00;
 
-static unsigned char ReadData = 0x00;
-static unsigned char DmaBusy  = 0;
-
-static unsigned char const ModeAddrIndex[] = {0, 1, 3, 2};
+/* screen of each mode in SRAM_REGION_MODE; notifications have their own region */
+static unsigned char const ModeScreen[] = {0, 1, 0, 2};
 static unsigned char IdleShowPage = 0;
 static unsigned char NotifShowPage = 0;
 static unsigned char NotifDrawPage = 0;
 static unsigned char NotifPageNum = 0;
+
+/* a mode with a screen in SRAM_REGION_BACK draws on one while the other is
+ * shown; ModeBack is TRUE while the back screen is shown */
+static unsigned char ModeBack[MODE_NUM];
+static unsigned char DrawnRows[MODE_NUM][ROW_MASK_BYTES];
+
+typedef struct
+{
+  unsigned char Hour; /* BCD, when the page was added */
+  unsigned char Min;
+  unsigned char Source;
+  unsigned char Read; /* the page was turned to or away from */
+} NotifPage_t;
+
+static NotifPage_t NotifPage[NOTIF_MAX_PAGES];
+
+#if NOTIF_READ_AHEAD
+/* the page the next button press shows, ready for the lcd */
+static tLcdLine *pAhead = NULL;
+static unsigned char AheadPage;
+#endif
 static unsigned char StatusBarInModes = STATUS_BAR_IN_MODES;
 
 /* avoid conflicting widget buffer read/write btw SetWidgetList and UpdateDisplay */
 xSemaphoreHandle SramMutex;
 
 static unsigned char SramBuf[SRAM_HEADER_LEN];
+static unsigned char LineBuf[SRAM_READ_OVERHEAD + LINE_BUF_LEN];
+
+/* full lines of a mode buffer held in MCU ram while several bitmaps are
+ * drawn into them (read overhead bytes first) */
+static unsigned char *pBand = NULL;
+static unsigned char BandMode;
+static unsigned char BandStartRow;
+static unsigned char BandRowNum;
+
+#if SRAM_LINE_CACHE
+/* write-back cache of mode buffer lines for bitmaps drawn outside a band
+ *
+ * Age orders the lines from 0 (last used) to SRAM_LINE_CACHE - 1 (next to
+ * go). An empty line has Addr NO_LINE, which no line starts at.
+ */
+#define NO_LINE                   (0xFFFF)
+
+typedef struct
+{
+  unsigned int Addr;
+  unsigned char Dirty;
+  unsigned char Age;
+  unsigned char Buf[SRAM_READ_OVERHEAD + BYTES_PER_LINE];
+} CachedLine_t;
+
+static CachedLine_t Cache[SRAM_LINE_CACHE];
+
+static unsigned char *GetCachedLine(unsigned int Addr);
+static void WriteBackLine(CachedLine_t *pLine);
+#endif
 static unsigned char const ModePriority[] = {NOTIF_MODE, APP_MODE, IDLE_MODE, MUSIC_MODE};
 
 typedef struct
@@ -92,12 +153,27 @@ typedef struct
   unsigned char RowNum;
 } Rect_t;
 
-#define MODE_START_ADDR(_x) (ModeAddrIndex[_x] * BYTES_PER_SCREEN + MODE_BUF_START_ADDR)
+#define DOUBLE_BUFFERED(_x)  (ModeScreen[_x] < SramRegionUnits(SRAM_REGION_BACK))
+
+#define MODE_DRAW_ADDR(_x)   ModeAddr(_x, DRAW_PAGE)
+#define MODE_SHOW_ADDR(_x)   ModeAddr(_x, SHOW_PAGE)
 
 /******************************************************************************/
-static void SetAddr(unsigned int Addr);
+static void GetUpdateRows(tMessage *pMsg, unsigned char *pStart, unsigned char *pEnd);
+static unsigned int ModeAddr(unsigned char Mode, unsigned char Page);
+static void MarkDrawn(unsigned char Mode, unsigned char Row, unsigned char RowNum);
+static void FlipPage(unsigned char Mode);
+static void CopyLines(unsigned int From, unsigned int To, unsigned char Lines);
 static signed char ComparePriority(unsigned char Mode);
-static void TurnPage(unsigned char PageNo);
+static void AddNotifPage(unsigned char Source);
+static void TurnNotifPage(unsigned char Dir);
+static unsigned char OlderNotifPage(unsigned char Page);
+static void ReadLines(tLcdLine *pLine, unsigned int Addr, unsigned char Row, unsigned char Lines);
+static tLcdLine *KeepPageNoRows(tLcdLine *DrawBuf, tLcdLine *pLine, unsigned char Lines);
+#if NOTIF_READ_AHEAD
+static void ReadAhead(void);
+#endif
+static void WriteTemplate(unsigned int Addr, tTemplate pTemp, unsigned int Length);
 
 //#define MSG_OPT_NEWUI             (0x80)
 //#define MSG_OPT_HOME_WGT          (0x40) // new ui only
@@ -112,16 +188,12 @@ void WriteBufferHandler(tMessage *pMsg)
   if (pMsg->Options & MSG_OPT_NEWUI) WriteWidgetBuffer(pMsg);
   else
   {
-    unsigned int Addr = MODE_START_ADDR(pMsg->Options & MODE_MASK) + *pMsg->pBuffer * BYTES_PER_LINE;
+    unsigned int LineAddr = MODE_DRAW_ADDR(pMsg->Options & MODE_MASK) + *pMsg->pBuffer * BYTES_PER_LINE;
+    unsigned int Addr = LineAddr;
     unsigned char *pBuffer = pMsg->pBuffer + 1 - SRAM_HEADER_LEN;
     unsigned char BytesPerLine = BYTES_PER_LINE;
     unsigned char DataLength = pMsg->Length - 1;
 
-    if ((pMsg->Options & MODE_MASK) == NOTIF_MODE)
-    {
-        Addr += NotifDrawPage * BYTES_PER_SCREEN;
-    }
-
     if (pMsg->Options & MSG_OPT_WRTBUF_MULTILINE)
     {
         Addr += *(pMsg->pBuffer + 1);
@@ -132,13 +204,18 @@ void WriteBufferHandler(tMessage *pMsg)
 
     unsigned char LineNum = DataLength / BytesPerLine;
     if (BytesPerLine != BYTES_PER_LINE) PrintF("- Wrtbuf BPL:%d %s %d", BytesPerLine, "Ln:", LineNum);
+    MarkDrawn(pMsg->Options & MODE_MASK, *pMsg->pBuffer, LineNum);
+
+    /* lines can be partly written (Addr is not always a line start, and the
+     * last bytes can spill into one more line) so cached changes go first */
+    DropSramCache(LineAddr, (LineNum + 1) * BYTES_PER_LINE, TRUE);
     
     while (LineNum--)
     {
       pBuffer[0] = SPI_WRITE;
       pBuffer[1] = Addr >> 8;
       pBuffer[2] = Addr;
-      Write((unsigned long)pBuffer, BytesPerLine, DMA_COPY);
+      SramWrite((unsigned long)pBuffer, BytesPerLine, DMA_COPY);
 
       Addr += BYTES_PER_LINE;
       pBuffer += BytesPerLine + (BytesPerLine == BYTES_PER_LINE);
@@ -161,6 +238,45 @@ unsigned char CurrentIdleScreen(void)
 //#define MSG_OPT_NXT_PAGE          (0x04)
 //#define MODE_MASK                 (0x03)
 
+unsigned char UpdateSuperseded(tMessage *pMsg, tMessage *pNext)
+{
+  /* notification updates and page turns change the page every time */
+  if ((pMsg->Options & MODE_MASK) == NOTIF_MODE || (pMsg->Options & MSG_OPT_TURN_PAGE))
+    return FALSE;
+
+  unsigned char Start, End, NextStart, NextEnd;
+  GetUpdateRows(pMsg, &Start, &End);
+  GetUpdateRows(pNext, &NextStart, &NextEnd);
+
+  /* a full screen update in idle mode leaves out the watch drawn rows at the
+   * top, so it only covers pMsg if pMsg does not reach into them either */
+  if (pNext->Length == 0) return Start >= NextStart;
+
+  Rect_t *pRect = (Rect_t *)pNext->pBuffer;
+
+  if (NextStart < Start) Start = NextStart;
+  if (NextEnd > End) End = NextEnd;
+  pRect->StartRow = Start;
+  pRect->RowNum = End - Start;
+  return TRUE;
+}
+
+/* rows repainted by an update, as UpdateDisplayHandler does */
+static void GetUpdateRows(tMessage *pMsg, unsigned char *pStart, unsigned char *pEnd)
+{
+  Rect_t *pRect = (Rect_t *)pMsg->pBuffer;
+  unsigned char Mode = pMsg->Options & MODE_MASK;
+
+  *pStart = (Mode == IDLE_MODE && !GetProperty(PROP_PHONE_DRAW_TOP)) ?
+            WATCH_DRAW_SCREEN_ROW_NUM : 0;
+  *pEnd = LCD_ROW_NUM;
+
+  if (pMsg->Length == 0) return; // no rectangle means full screen
+
+  if (pRect->StartRow < LCD_ROW_NUM) *pStart = pRect->StartRow;
+  if (pRect->RowNum && pRect->RowNum + *pStart <= LCD_ROW_NUM) *pEnd = *pStart + pRect->RowNum;
+}
+
 void UpdateDisplayHandler(tMessage *pMsg)
 {
   unsigned char Mode = pMsg->Options & MODE_MASK;
@@ -204,22 +320,25 @@ void UpdateDisplayHandler(tMessage *pMsg)
     // for external msg, NOTIF > APP > IDLE > MUSIC
     if (pMsg->Options & MSG_OPT_UPD_INTERNAL)
     {
-      if ((pMsg->Options & MSG_OPT_TURN_PAGE) == MSG_OPT_NXT_PAGE)
+      if (pMsg->Options & MSG_OPT_TURN_PAGE)
       {
         if (NotifPageNum == 0) return;
-        TurnPage(SHOW_PAGE);
+        TurnNotifPage(pMsg->Options & MSG_OPT_TURN_PAGE);
       }
-      else if (Mode == NOTIF_MODE && Ringing()) TurnPage(DRAW_PAGE);
+      else if (Mode == NOTIF_MODE && Ringing()) AddNotifPage(NOTIF_SRC_CALL);
     }
     else
     {
+      /* the phone is done drawing this mode */
+      if (Mode != NOTIF_MODE) FlipPage(Mode);
+
       signed char Result = ComparePriority(Mode);
 //      PrintF("- UpdDsp Priority:%d", Result);
 
       if (Result >= 0)
       {
         if (Result > 0) ChangeMode(Mode);
-        if (Mode == NOTIF_MODE) TurnPage(DRAW_PAGE);
+        if (Mode == NOTIF_MODE) AddNotifPage(NOTIF_SRC_PHONE);
         if (CurrentMode != IDLE_MODE) ResetModeTimer();
         else if (PageType != PAGE_TYPE_IDLE) return;
       }
@@ -239,35 +358,54 @@ void UpdateDisplayHandler(tMessage *pMsg)
       if (pRect->RowNum && pRect->RowNum + StartRow <= LCD_ROW_NUM) RowNum = pRect->RowNum;
     }
 
+    /* lines drawn since the last update have to be in the serial ram */
+    FlushSramCache();
+
     /* now calculate the absolute address */
-    unsigned int Addr = MODE_START_ADDR(Mode) + StartRow * BYTES_PER_LINE;
-    if (Mode == NOTIF_MODE) Addr += NotifShowPage * BYTES_PER_SCREEN;
+    unsigned int Addr = MODE_SHOW_ADDR(Mode) + StartRow * BYTES_PER_LINE;
 //    PrintF("UpdDsp NtfShwPg:%u Rows:%u", NotifShowPage, RowNum);
     tLcdLine *DrawBuf = NULL;
-    LcdReadBuffer_t *LcdBuf = (LcdReadBuffer_t *)pvPortMalloc(LCD_READ_BUFFER_SIZE);
+    unsigned char Keep = (Mode == NOTIF_MODE && NotifPageNum > 0);
 
-    while (RowNum --)
+#if NOTIF_READ_AHEAD
+    if (Mode != NOTIF_MODE) DropReadAhead();
+    else if (pAhead && AheadPage == NotifShowPage && RowNum == LCD_ROW_NUM)
     {
-      SramBuf[0] = SPI_READ;
-      SramBuf[1] = Addr >> 8;
-      SramBuf[2] = Addr;
-      Read(SramBuf, (unsigned char *)LcdBuf, BYTES_PER_LINE);
-      /* now add the row number */
-      LcdBuf->Line.Row = StartRow ++;
-      LcdBuf->Line.Trailer = 0;
-
-      if (Mode == NOTIF_MODE && NotifPageNum > 0 &&
-          LcdBuf->Line.Row >= NOTIF_PAGE_NO_START_ROW &&
-          LcdBuf->Line.Row <= NOTIF_PAGE_NO_END_ROW)
-      {
-        if (DrawBuf == NULL) DrawBuf = (tLcdLine *)GetLcdBuffer();
-        memcpy(&DrawBuf[LcdBuf->Line.Row], (unsigned char *)&LcdBuf->Line, sizeof(tLcdLine));
-      }
+      if (Keep) DrawBuf = KeepPageNoRows(DrawBuf, pAhead, LCD_ROW_NUM);
+      WriteToLcd(pAhead, LCD_ROW_NUM);
+      RowNum = 0;
+    }
+#endif
 
-      WriteToLcd(&LcdBuf->Line, 1);
-      Addr += BYTES_PER_LINE;
+    tLcdLine *pBuf = NULL;
+    tLcdLine *pLine;
+
+    if (RowNum) pBuf = (tLcdLine *)pvPortMallocFrom(sizeof(tLcdLine) * LCD_BURST_LINES * 2, HEAP_SITE_LCD_READ);
+    pLine = pBuf;
+
+    /* mode buffer lines are contiguous so a sequential read gets several
+     * lines with one header and chip select */
+    while (RowNum)
+    {
+      unsigned char Lines = RowNum < LCD_BURST_LINES ? RowNum : LCD_BURST_LINES;
+
+      ReadLines(pLine, Addr, StartRow, Lines);
+      if (Keep) DrawBuf = KeepPageNoRows(DrawBuf, pLine, Lines);
+
+      /* waits for the previous burst to finish first */
+      StartWriteToLcd(pLine, Lines);
+      pLine = (pLine == pBuf) ? pBuf + LCD_BURST_LINES : pBuf;
+
+      StartRow += Lines;
+      Addr += BYTES_PER_LINE * Lines;
+      RowNum -= Lines;
+    }
+
+    if (pBuf)
+    {
+      WaitForLcd();
+      vPortFree(pBuf);
     }
-    vPortFree(LcdBuf);
 
     if (DrawBuf)
     {
@@ -277,11 +415,109 @@ void UpdateDisplayHandler(tMessage *pMsg)
 
       DrawNotifPageNo(PageMore); // include freebuf
     }
+
+#if NOTIF_READ_AHEAD
+    if (Mode == NOTIF_MODE) ReadAhead();
+#endif
   }
 
   DrawStatusBar();
 }
 
+void SramToLcd(unsigned int Addr, unsigned char StartRow, unsigned char RowNum)
+{
+  tLcdLine *pBuf = (tLcdLine *)pvPortMallocFrom(sizeof(tLcdLine) * LCD_BURST_LINES * 2, HEAP_SITE_LCD_READ);
+  tLcdLine *pLine = pBuf;
+
+  while (RowNum)
+  {
+    unsigned char Lines = RowNum < LCD_BURST_LINES ? RowNum : LCD_BURST_LINES;
+
+    ReadLines(pLine, Addr, StartRow, Lines);
+    StartWriteToLcd(pLine, Lines);
+    pLine = (pLine == pBuf) ? pBuf + LCD_BURST_LINES : pBuf;
+
+    StartRow += Lines;
+    Addr += BYTES_PER_LINE * Lines;
+    RowNum -= Lines;
+  }
+
+  WaitForLcd();
+  vPortFree(pBuf);
+}
+
+/* address of the draw or show page of a mode */
+static unsigned int ModeAddr(unsigned char Mode, unsigned char Page)
+{
+  if (Mode == NOTIF_MODE)
+    return SramRegionAddr(SRAM_REGION_NOTIF) +
+           (Page == DRAW_PAGE ? NotifDrawPage : NotifShowPage) * BYTES_PER_SCREEN;
+
+  unsigned char Back = ModeBack[Mode];
+  if (Page == DRAW_PAGE && DOUBLE_BUFFERED(Mode)) Back = !Back;
+
+  return SramRegionAddr(Back ? SRAM_REGION_BACK : SRAM_REGION_MODE) +
+         ModeScreen[Mode] * BYTES_PER_SCREEN;
+}
+
+static void MarkDrawn(unsigned char Mode, unsigned char Row, unsigned char RowNum)
+{
+  if (Mode == NOTIF_MODE || !DOUBLE_BUFFERED(Mode)) return;
+
+  for (; RowNum && Row < LCD_ROW_NUM; --RowNum, ++Row)
+    DrawnRows[Mode][Row >> 3] |= 1 << (Row & 0x07);
+}
+
+/* show the page drawn last and bring the other one, which is drawn next,
+ * up to date by copying the rows that were drawn */
+static void FlipPage(unsigned char Mode)
+{
+  unsigned char *pRows = DrawnRows[Mode];
+  unsigned char Row;
+
+  for (Row = 0; Row < ROW_MASK_BYTES && pRows[Row] == 0; ++Row);
+  if (Row == ROW_MASK_BYTES) return; // nothing drawn (or not double buffered)
+
+  /* cached lines belong to the page that is going to be shown */
+  FlushSramCache();
+  ModeBack[Mode] = !ModeBack[Mode];
+
+  unsigned int From = MODE_SHOW_ADDR(Mode);
+  unsigned int To = MODE_DRAW_ADDR(Mode);
+  DropSramCache(To, BYTES_PER_SCREEN, FALSE);
+
+  for (Row = 0; Row < LCD_ROW_NUM;)
+  {
+    unsigned char Lines = 0;
+
+    while (Row + Lines < LCD_ROW_NUM && Lines < LINE_BUF_LINES &&
+           (pRows[(Row + Lines) >> 3] & (1 << ((Row + Lines) & 0x07)))) Lines ++;
+
+    if (Lines)
+    {
+      CopyLines(From + Row * BYTES_PER_LINE, To + Row * BYTES_PER_LINE, Lines);
+      Row += Lines;
+    }
+    else Row ++;
+  }
+
+  memset(pRows, 0, ROW_MASK_BYTES);
+}
+
+static void CopyLines(unsigned int From, unsigned int To, unsigned char Lines)
+{
+  SramBuf[0] = SPI_READ;
+  SramBuf[1] = From >> 8;
+  SramBuf[2] = From;
+  SramRead(SramBuf, LineBuf, Lines * BYTES_PER_LINE);
+
+  /* the write header goes over the last read overhead bytes */
+  LineBuf[1] = SPI_WRITE;
+  LineBuf[2] = To >> 8;
+  LineBuf[3] = To;
+  SramWrite((unsigned long)(LineBuf + 1), Lines * BYTES_PER_LINE, DMA_COPY);
+}
+
 static signed char ComparePriority(unsigned char Mode)
 {
   if (Mode == CurrentMode) return 0;
@@ -292,307 +528,480 @@ static signed char ComparePriority(unsigned char Mode)
   return -1;
 }
 
-static void TurnPage(unsigned char PageNo)
+/* read up to LCD_BURST_LINES lines of a mode buffer into lcd lines */
+static void ReadLines(tLcdLine *pLine, unsigned int Addr, unsigned char Row, unsigned char Lines)
 {
-  if (PageNo == DRAW_PAGE)
+  unsigned char *pData = (unsigned char *)pLine + LCD_BURST_OFFSET;
+  unsigned char i;
+
+  SramBuf[0] = SPI_READ;
+  SramBuf[1] = Addr >> 8;
+  SramBuf[2] = Addr;
+  SramRead(SramBuf, pData, BYTES_PER_LINE * Lines);
+  pData += SRAM_READ_OVERHEAD;
+
+  /* each line moves down to or before where it was read, never over
+   * a line that has not moved yet */
+  for (i = 0; i < Lines; ++i)
   {
-    NotifShowPage = NotifDrawPage;
-    if (++NotifDrawPage == NOTIF_TOTAL_PAGES) NotifDrawPage = 0;
-    if (NotifPageNum < NOTIF_TOTAL_PAGES) NotifPageNum ++;
+    memmove(pLine[i].Data, pData, BYTES_PER_LINE);
+    pData += BYTES_PER_LINE;
+    pLine[i].Row = Row ++;
+    pLine[i].Trailer = 0;
   }
-  else if (NotifShowPage-- == 0) NotifShowPage = NotifPageNum - 1;
 }
 
-void DrawStatusBar(void)
+/* copy the lines under the notification page number into the lcd buffer
+ * so DrawNotifPageNo draws over the page */
+static tLcdLine *KeepPageNoRows(tLcdLine *DrawBuf, tLcdLine *pLine, unsigned char Lines)
 {
-  if ((1 << CurrentMode) & StatusBarInModes)
+  unsigned char i;
+
+  for (i = 0; i < Lines; ++i)
   {
-    if (CurrentMode == IDLE_MODE) DrawStatusBarToWidget();
-    else DrawStatusBarToLcd();
+    if (pLine[i].Row >= NOTIF_PAGE_NO_START_ROW && pLine[i].Row <= NOTIF_PAGE_NO_END_ROW)
+    {
+      if (DrawBuf == NULL) DrawBuf = (tLcdLine *)GetLcdBuffer();
+      memcpy(&DrawBuf[pLine[i].Row], (unsigned char *)&pLine[i], sizeof(tLcdLine));
+    }
   }
+  return DrawBuf;
 }
 
-void Read(unsigned char *pWriteData, unsigned char *pReadData, unsigned int Length)
-{
-  DmaBusy = 1;
-  SRAM_CSN_ASSERT();
-
-  /*
-   * SPI has to write bytes to receive bytes so
-   *
-   * two DMA channels are used
-   *
-   * read requires 4 leading bytes because the shift in of the read data
-   * lags the transmit data by one byte
-   */
-
-  /* USCIA0 TXIFG is the DMA trigger for DMA0 and RXIFG is the DMA trigger
-   * for dma1 (DMACTL0 controls both)
-   */
-  DMACTL0 = DMA1TSEL_16 | DMA0TSEL_17;
-  __data16_write_addr((unsigned short)&DMA0SA, (unsigned long)pWriteData);
-  __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCA0TXBUF);
-  DMA0SZ = Length + SRAM_HEADER_LEN + 1;
-
-  /* don't enable interrupt for transmit dma done(channel 0)
-   * increment the source address because the message contains the address
-   * the other bytes are don't care
-   */
-  DMA0CTL = DMADT_0 + DMASRCINCR_3 + DMASBDB + DMALEVEL;
-
-  /* receive data is source for dma 1 */
-  __data16_write_addr((unsigned short)&DMA1SA, (unsigned long)&UCA0RXBUF);
-  __data16_write_addr((unsigned short)&DMA1DA, (unsigned long)pReadData);
-  DMA1SZ = Length + SRAM_HEADER_LEN + 1;
-
-  /* increment destination address */
-  DMA1CTL = DMADT_0 + DMADSTINCR_3 + DMASBDB + DMALEVEL + DMAIE;
-
-  /* start the transfer */
-  DMA1CTL |= DMAEN;
-  DMA0CTL |= DMAEN;
-  while (DmaBusy);
-  
-  SRAM_CSN_DEASSERT();
+/* the page just drawn becomes the newest page of the ring */
+static void AddNotifPage(unsigned char Source)
+{
+  NotifShowPage = NotifDrawPage;
+  if (++NotifDrawPage == NOTIF_TOTAL_PAGES) NotifDrawPage = 0;
+  if (NotifPageNum < NOTIF_TOTAL_PAGES) NotifPageNum ++;
+
+  NotifPage[NotifShowPage].Hour = RTCHOUR;
+  NotifPage[NotifShowPage].Min = RTCMIN;
+  NotifPage[NotifShowPage].Source = Source;
+  NotifPage[NotifShowPage].Read = FALSE;
+
+#if NOTIF_READ_AHEAD
+  /* the page read ahead may just have been drawn over */
+  DropReadAhead();
+#endif
 }
 
-/* use DMA to write a block of data to the serial ram */
-void Write(unsigned long const pData, unsigned int Length, unsigned char Op)
+/* MSG_OPT_NXT_PAGE goes to the next older page, MSG_OPT_PRV_PAGE back to
+ * the next newer one */
+static void TurnNotifPage(unsigned char Dir)
 {
-  EnableSmClkUser(SERIAL_RAM_USER);
-  DmaBusy = 1;
-  SRAM_CSN_ASSERT();
+  NotifPage[NotifShowPage].Read = TRUE;
 
-  /* USCIA0 TXIFG is the DMA trigger */
-  DMACTL0 = DMA0TSEL_17;
+  if (Dir == MSG_OPT_NXT_PAGE) NotifShowPage = OlderNotifPage(NotifShowPage);
+  else if (++NotifShowPage >= NotifPageNum) NotifShowPage = 0;
 
-  __data16_write_addr((unsigned short)&DMA0SA, pData);
-  __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCA0TXBUF);
+  NotifPage[NotifShowPage].Read = TRUE;
+}
 
-  DMA0SZ = Length + SRAM_HEADER_LEN;
+static unsigned char OlderNotifPage(unsigned char Page)
+{
+  return Page ? Page - 1 : NotifPageNum - 1;
+}
 
-  /*
-   * single transfer, source byte and dest byte,
-   * level sensitive, enable interrupt, clear interrupt flag
-   */
-  DMA0CTL = DMADT_0 + DMASBDB + DMALEVEL + DMAIE;
+#if NOTIF_READ_AHEAD
+/* read the page the next button press shows while the current one is
+ * looked at; skipped if the heap is short */
+static void ReadAhead(void)
+{
+  if (NotifPageNum < 2) return;
 
-  /*  increment source addres */
-  if (Op == DMA_COPY) DMA0CTL += DMASRCINCR_3;
+  unsigned char Page = OlderNotifPage(NotifShowPage);
+  if (pAhead && AheadPage == Page) return;
 
-  /* start the transfer */
-  DMA0CTL |= DMAEN;
-  while (DmaBusy);
+  if (pAhead == NULL)
+  {
+    xHeapStats Stats;
+    vPortGetHeapStats(&Stats);
+    if (Stats.xLargestFreeBlock < sizeof(tLcdLine) * LCD_ROW_NUM + READ_AHEAD_HEAP_RESERVE) return;
 
-  SRAM_CSN_DEASSERT();
-  DisableSmClkUser(SERIAL_RAM_USER);
+    pAhead = (tLcdLine *)pvPortMallocFrom(sizeof(tLcdLine) * LCD_ROW_NUM, HEAP_SITE_LCD_READ);
+  }
+
+  unsigned int Addr = SramRegionAddr(SRAM_REGION_NOTIF) + Page * BYTES_PER_SCREEN;
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; Row += LCD_BURST_LINES)
+  {
+    ReadLines(pAhead + Row, Addr, Row, LCD_BURST_LINES);
+    Addr += BYTES_PER_LINE * LCD_BURST_LINES;
+  }
+  AheadPage = Page;
 }
+#endif
 
-static void SetAddr(unsigned int Addr)
+void DropReadAhead(void)
 {
-  SRAM_CSN_ASSERT();
+#if NOTIF_READ_AHEAD
+  if (pAhead == NULL) return;
 
-  SramBuf[0] = SPI_WRITE;
-  SramBuf[1] = Addr >> 8;
-  SramBuf[2] = Addr;
+  vPortFree(pAhead);
+  pAhead = NULL;
+#endif
+}
 
+void ShowNotifRing(void)
+{
+  unsigned char Page = NotifDrawPage;
   unsigned char i;
 
-  for (i = 0; i < 3; ++i)
+  PrintF("Notif %u of %u Draw:%u", NotifPageNum, NOTIF_TOTAL_PAGES, NotifDrawPage);
+
+  /* newest first */
+  for (i = 0; i < NotifPageNum; ++i)
   {
-    UCA0TXBUF = SramBuf[i];
-    while (!(UCA0IFG&UCTXIFG));
-    while (!(UCA0IFG&UCRXIFG));
-    SramBuf[i] = UCA0RXBUF;
+    Page = OlderNotifPage(Page);
+    PrintF("%c%u %02X:%02X %c %s", Page == NotifShowPage ? '>' : ' ', Page,
+           NotifPage[Page].Hour, NotifPage[Page].Min, NotifPage[Page].Source,
+           NotifPage[Page].Read ? "read" : "new");
+  }
+
+#if NOTIF_READ_AHEAD
+  if (pAhead) PrintF("Ahead:%u", AheadPage);
+#endif
+}
+
+void DrawStatusBar(void)
+{
+  if ((1 << CurrentMode) & StatusBarInModes)
+  {
+    if (CurrentMode == IDLE_MODE) DrawStatusBarToWidget();
+    else DrawStatusBarToLcd();
   }
 }
 
 /* Load a template from flash into mode SRAM */
 void LoadTemplateHandler(tMessage *pMsg)
 {
-  unsigned int Addr = MODE_START_ADDR(pMsg->Options & MODE_MASK);
-  if ((pMsg->Options & MODE_MASK) == NOTIF_MODE) Addr += NotifDrawPage * BYTES_PER_SCREEN;
-  SetAddr(Addr);
+  unsigned int Addr = MODE_DRAW_ADDR(pMsg->Options & MODE_MASK);
+  DropSramCache(Addr, BYTES_PER_SCREEN, FALSE);
+  MarkDrawn(pMsg->Options & MODE_MASK, 0, LCD_ROW_NUM);
 
   if (pMsg->pBuffer == NULL)
   { // internal usage: high 4-bit is TmpID
-    Write((unsigned long)&pTemplate[pMsg->Options >> 4], BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_COPY);
+    WriteTemplate(Addr, pTemplate[pMsg->Options >> 4], BYTES_PER_SCREEN);
+    return;
   }
-  else if (*pMsg->pBuffer <= 1)
+
+  SramSetAddr(Addr);
+
+  if (*pMsg->pBuffer <= 1)
   {
     /* clear or fill the screen */
-    Write((unsigned long)(*pMsg->pBuffer ? &FILL_BLACK : &FILL_WHITE), BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_FILL);
+    SramWrite((unsigned long)(*pMsg->pBuffer ? &FILL_BLACK : &FILL_WHITE), BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_FILL);
   }
   else
   {
     /* template zero is reserved for simple patterns */
-    Write((unsigned long)&pWatchFace[*pMsg->pBuffer - TEMPLATE_1][0], BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_COPY);
+    SramWrite((unsigned long)&pWatchFace[*pMsg->pBuffer - TEMPLATE_1][0], BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_COPY);
     PrintF("-Template:%d", *pMsg->pBuffer);
   }
 }
 
-void LoadBuffer(unsigned char QuadIndex, unsigned char const *pTemp)
+void LoadBuffer(unsigned char QuadIndex, tTemplate pTemp)
 {
-  SetAddr(QuadIndex * BYTES_PER_QUAD + WGT_BUF_START_ADDR);
-  Write((unsigned long)pTemp, BYTES_PER_QUAD - SRAM_HEADER_LEN, DMA_COPY);
+  WriteTemplate(QuadIndex * BYTES_PER_QUAD + WGT_BUF_START_ADDR, pTemp, BYTES_PER_QUAD);
+}
+
+/* decode a template into the serial ram at Addr without a copy of it in ram */
+static void WriteTemplate(unsigned int Addr, tTemplate pTemp, unsigned int Length)
+{
+  TemplateReader_t Reader;
+  unsigned int Count;
+
+  StartTemplate(&Reader, pTemp);
+  SramSetAddr(Addr);
+
+  for (; Length; Length -= Count)
+  {
+    Count = Length < LINE_BUF_LEN ? Length : LINE_BUF_LEN;
+    ReadTemplate(&Reader, LineBuf, Count);
+    SramWriteNext((unsigned long)LineBuf, Count, DMA_COPY);
+  }
+
+  SramEndWrite();
 }
 
 void ClearSram(unsigned char Mode)
 {
-  unsigned int Addr = MODE_START_ADDR(Mode);
-  if (Mode == NOTIF_MODE) Addr += NotifDrawPage * BYTES_PER_SCREEN;
-  SetAddr(Addr);
-  Write((unsigned long)&DummyData, BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_FILL);
+  unsigned int Addr = MODE_DRAW_ADDR(Mode);
+  DropSramCache(Addr, BYTES_PER_SCREEN, FALSE);
+  MarkDrawn(Mode, 0, LCD_ROW_NUM);
+  SramSetAddr(Addr);
+  SramWrite((unsigned long)&DummyData, BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_FILL);
+}
+
+#if SRAM_LINE_CACHE
+static void WriteBackLine(CachedLine_t *pLine)
+{
+  /* the write header goes over the last read overhead bytes */
+  pLine->Buf[1] = SPI_WRITE;
+  pLine->Buf[2] = pLine->Addr >> 8;
+  pLine->Buf[3] = pLine->Addr;
+  SramWrite((unsigned long)(pLine->Buf + 1), BYTES_PER_LINE, DMA_COPY);
+  pLine->Dirty = FALSE;
+}
+
+/* get a line to modify; it is written back when it is flushed or evicted */
+static unsigned char *GetCachedLine(unsigned int Addr)
+{
+  CachedLine_t *pLine = NULL;
+  unsigned char i;
+
+  for (i = 0; i < SRAM_LINE_CACHE; ++i)
+  {
+    if (Cache[i].Addr == Addr) pLine = &Cache[i];
+  }
+
+  if (pLine) gAppStats.SramCacheHits ++;
+  else
+  {
+    gAppStats.SramCacheMisses ++;
+
+    for (i = 0; i < SRAM_LINE_CACHE; ++i)
+    {
+      if (Cache[i].Age == SRAM_LINE_CACHE - 1) pLine = &Cache[i];
+    }
+
+    if (pLine->Dirty) WriteBackLine(pLine);
+
+    pLine->Addr = Addr;
+    SramBuf[0] = SPI_READ;
+    SramBuf[1] = Addr >> 8;
+    SramBuf[2] = Addr;
+    SramRead(SramBuf, pLine->Buf, BYTES_PER_LINE);
+  }
+
+  for (i = 0; i < SRAM_LINE_CACHE; ++i)
+  {
+    if (Cache[i].Age < pLine->Age) Cache[i].Age ++;
+  }
+  pLine->Age = 0;
+  pLine->Dirty = TRUE;
+
+  return pLine->Buf + SRAM_READ_OVERHEAD;
+}
+#endif
+
+void FlushSramCache(void)
+{
+#if SRAM_LINE_CACHE
+  unsigned char i;
+
+  for (i = 0; i < SRAM_LINE_CACHE; ++i)
+  {
+    if (Cache[i].Dirty) WriteBackLine(&Cache[i]);
+  }
+#endif
+}
+
+void DropSramCache(unsigned int Addr, unsigned int Length, unsigned char WriteBack)
+{
+#if SRAM_LINE_CACHE
+  unsigned char i;
+
+  for (i = 0; i < SRAM_LINE_CACHE; ++i)
+  {
+    if (Cache[i].Addr >= Addr && Cache[i].Addr - Addr < Length)
+    {
+      if (WriteBack && Cache[i].Dirty) WriteBackLine(&Cache[i]);
+      Cache[i].Addr = NO_LINE;
+      Cache[i].Dirty = FALSE;
+    }
+  }
+#endif
+}
+
+void OpenSramBand(unsigned char StartRow, unsigned char RowNum, unsigned char Mode)
+{
+  if (!SRAM_DRAW_BAND || pBand || StartRow >= LCD_ROW_NUM || RowNum == 0) return;
+  if (RowNum > LCD_ROW_NUM - StartRow) RowNum = LCD_ROW_NUM - StartRow;
+  if (RowNum > SRAM_BAND_MAX_ROWS) return;
+
+  pBand = (unsigned char *)pvPortMallocFrom(RowNum * BYTES_PER_LINE + SRAM_READ_OVERHEAD, HEAP_SITE_SRAM);
+  BandMode = Mode;
+  BandStartRow = StartRow;
+  BandRowNum = RowNum;
+
+  unsigned int Addr = StartRow * BYTES_PER_LINE + MODE_DRAW_ADDR(Mode);
+
+  /* the band is written back over these lines */
+  DropSramCache(Addr, RowNum * BYTES_PER_LINE, TRUE);
+
+  SramBuf[0] = SPI_READ;
+  SramBuf[1] = Addr >> 8;
+  SramBuf[2] = Addr;
+  SramRead(SramBuf, pBand, RowNum * BYTES_PER_LINE);
+}
+
+void CloseSramBand(void)
+{
+  if (!pBand) return;
+
+  unsigned int Addr = BandStartRow * BYTES_PER_LINE + MODE_DRAW_ADDR(BandMode);
+
+  /* the write header goes over the last read overhead bytes */
+  pBand[1] = SPI_WRITE;
+  pBand[2] = Addr >> 8;
+  pBand[3] = Addr;
+  SramWrite((unsigned long)(pBand + 1), BandRowNum * BYTES_PER_LINE, DMA_COPY);
+
+  vPortFree(pBand);
+  pBand = NULL;
 }
 
-#define SRAM_READ_OVERHEAD  (SRAM_HEADER_LEN + 1)
+/* draw one bitmap row into the serial ram bytes at pByte (up to pEnd) */
+static unsigned char DrawBitmapRow(Draw_t *Info, unsigned char const *pBmp,
+                                   unsigned char *pByte, unsigned char const *pEnd)
+{
+  unsigned char ColBit = BIT0 << (Info->X % 8); // dst
+  unsigned char MaskBit = BIT0; // src
+  unsigned char x;
+  unsigned char Set;
+
+  for (x = 0; x < Info->Width && (x + Info->X) < LCD_COL_NUM; ++x)
+  {
+    if (pByte >= pEnd) PrintF("#DrwSram x:%u y:%u", x+Info->X, Info->Y);
+
+    Set = *pBmp & MaskBit;
+    BitOp(pByte, ColBit, Set, Info->Opt & DRAW_OPT_MASK);
+
+    MaskBit <<= 1;
+    if (MaskBit == 0)
+    {
+      MaskBit = BIT0;
+      pBmp ++;
+    }
+    
+    ColBit <<= 1;
+    if (ColBit == 0)
+    {
+      ColBit = BIT0;
+      pByte ++;
+    }
+  }
+
+  return x;
+}
 
 void DrawBitmapToSram(Draw_t *Info, unsigned char WidthInBytes, unsigned char const *pBitmap, unsigned char Mode)
 {
-  unsigned int Addr = (Info->X >> 3) + Info->Y * BYTES_PER_LINE + MODE_START_ADDR(Mode);
-  if (Mode == NOTIF_MODE) Addr += NotifDrawPage * BYTES_PER_SCREEN;
-//  PrintF("DrwBmpSrm NtfDrwPg:%u", NotifDrawPage);
+  unsigned char x = 0, y;
+  unsigned char Rows = 0;
+  if (Info->Y < LCD_ROW_NUM) Rows = Info->Height < LCD_ROW_NUM - Info->Y ? Info->Height : LCD_ROW_NUM - Info->Y;
+  MarkDrawn(Mode, Info->Y, Rows);
 
+#if !SRAM_LINE_CACHE
   unsigned char SramBytes = ((Info->Width + Info->X % 8) >> 3) + 1;
   int Overflow = SramBytes + (Info->X >> 3) - BYTES_PER_LINE;
   if (Overflow > 0) SramBytes -= Overflow;
-//  PrintF("WB:%u", SramBytes);
 
-  unsigned char x, y;
-  unsigned char Set;
-  unsigned char *pBuf = (unsigned char *)pvPortMalloc(SramBytes + SRAM_READ_OVERHEAD);
-//  memset(pBuf, 0x55, SramBytes + SRAM_READ_OVERHEAD);
+  /* a bitmap on its own gets its own band if its whole lines are fewer
+   * bytes on the bus than a read and a write of every row */
+  unsigned char OwnBand = !pBand && Rows * (unsigned int)(2 * SramBytes + SRAM_READ_OVERHEAD + SRAM_HEADER_LEN) >
+    Rows * 2U * BYTES_PER_LINE + SRAM_READ_OVERHEAD + SRAM_HEADER_LEN;
+  if (OwnBand) OpenSramBand(Info->Y, Rows, Mode);
+#endif
 
-  for (y = 0; y < Info->Height && (y + Info->Y) < LCD_ROW_NUM; ++y)
+  if (pBand && Mode == BandMode && Info->Y >= BandStartRow &&
+      Info->Y + Rows <= BandStartRow + BandRowNum)
   {
-    unsigned char ColBit = BIT0 << (Info->X % 8); // dst
-    unsigned char MaskBit = BIT0; // src
-    unsigned char const *pBmp = pBitmap + y * WidthInBytes;
-    unsigned char *pByte = pBuf + SRAM_READ_OVERHEAD;
+    unsigned char *pLine = pBand + SRAM_READ_OVERHEAD + (Info->Y - BandStartRow) * BYTES_PER_LINE;
 
-    SramBuf[0] = SPI_READ;
-    SramBuf[1] = Addr >> 8;
-    SramBuf[2] = Addr;
-    Read(SramBuf, pBuf, SramBytes);
-//    PrintQ(pBuf, SramBytes + SRAM_READ_OVERHEAD);
+    for (y = 0; y < Rows; ++y)
+    {
+      x = DrawBitmapRow(Info, pBitmap + y * WidthInBytes, pLine + (Info->X >> 3), pLine + BYTES_PER_LINE);
+      pLine += BYTES_PER_LINE;
+    }
+  }
+#if SRAM_LINE_CACHE
+  else
+  {
+    /* bitmaps drawn on their own go through the line cache */
+    unsigned int Addr = Info->Y * BYTES_PER_LINE + MODE_DRAW_ADDR(Mode);
 
-    for (x = 0; x < Info->Width && (x + Info->X) < LCD_COL_NUM; ++x)
+    for (y = 0; y < Rows; ++y)
     {
-      if (pByte >= pBuf + SramBytes + SRAM_READ_OVERHEAD) PrintF("#DrwSram x:%u y:%u", x+Info->X, y+Info->Y);
+      unsigned char *pLine = GetCachedLine(Addr);
 
-      Set = *pBmp & MaskBit;
-      BitOp(pByte, ColBit, Set, Info->Opt & DRAW_OPT_MASK);
+      x = DrawBitmapRow(Info, pBitmap + y * WidthInBytes, pLine + (Info->X >> 3), pLine + BYTES_PER_LINE);
+      Addr += BYTES_PER_LINE;
+    }
+  }
+#else
+  else
+  {
+    /* read-modify-write every row */
+    unsigned int Addr = (Info->X >> 3) + Info->Y * BYTES_PER_LINE + MODE_DRAW_ADDR(Mode);
+//  PrintF("DrwBmpSrm NtfDrwPg:%u", NotifDrawPage);
+//  PrintF("WB:%u", SramBytes);
 
-      MaskBit <<= 1;
-      if (MaskBit == 0)
-      {
-        MaskBit = BIT0;
-        pBmp ++;
-      }
-      
-      ColBit <<= 1;
-      if (ColBit == 0)
-      {
-        ColBit = BIT0;
-        pByte ++;
-      }
+    unsigned char *pBuf = (unsigned char *)pvPortMallocFrom(SramBytes + SRAM_READ_OVERHEAD, HEAP_SITE_SRAM);
+
+    for (y = 0; y < Rows; ++y)
+    {
+      SramBuf[0] = SPI_READ;
+      SramBuf[1] = Addr >> 8;
+      SramBuf[2] = Addr;
+      SramRead(SramBuf, pBuf, SramBytes);
+//    PrintQ(pBuf, SramBytes + SRAM_READ_OVERHEAD);
+
+      x = DrawBitmapRow(Info, pBitmap + y * WidthInBytes, pBuf + SRAM_READ_OVERHEAD,
+                        pBuf + SramBytes + SRAM_READ_OVERHEAD);
+
+      pBuf[1] = SPI_WRITE;
+      pBuf[2] = Addr >> 8;
+      pBuf[3] = Addr;
+      SramWrite((unsigned long)(pBuf + 1), SramBytes, DMA_COPY);
+      Addr += BYTES_PER_LINE;
     }
 
-    pBuf[1] = SPI_WRITE;
-    pBuf[2] = Addr >> 8;
-    pBuf[3] = Addr;
-    Write((unsigned long)(pBuf + 1), SramBytes, DMA_COPY);
-    Addr += BYTES_PER_LINE;
+    vPortFree(pBuf);
   }
 
-  vPortFree(pBuf);
+  if (OwnBand) CloseSramBand();
+#endif
+
   if ((y + Info->Y) >= LCD_ROW_NUM || (x + Info->X) >= LCD_COL_NUM)
     PrintF("DrwBmp x:%d y:%d", x + Info->X, y + Info->Y);
 }
 
 void DrawTemplateToSram(Draw_t *Info, unsigned char Mode)
 {
-  unsigned int Addr = MODE_START_ADDR(Mode) + Info->Y * BYTES_PER_LINE;
-  if (Mode == NOTIF_MODE) Addr += NotifDrawPage * BYTES_PER_SCREEN;
+  unsigned int Addr = MODE_DRAW_ADDR(Mode) + Info->Y * BYTES_PER_LINE;
   
-  SetAddr(Addr);
-  Write((unsigned long)pTemplate[Info->Id & TMPL_ID_MASK], BYTES_PER_SCREEN - SRAM_HEADER_LEN, DMA_COPY);
+  DropSramCache(Addr, BYTES_PER_SCREEN, FALSE);
+  MarkDrawn(Mode, Info->Y, LCD_ROW_NUM - Info->Y);
+  WriteTemplate(Addr, pTemplate[Info->Id & TMPL_ID_MASK], BYTES_PER_SCREEN);
 }
 
 /* configure the MSP430 SPI peripheral */
 void InitSerialRam(void)
 {
-  /* assert reset when configuring */
-  UCA0CTL1 = UCSWRST;
   EnableSmClkUser(SERIAL_RAM_USER);
-
-  SRAM_SCLK_PSEL |= SRAM_SCLK_PIN;
-  SRAM_SOMI_PSEL |= SRAM_SOMI_PIN;
-  SRAM_SIMO_PSEL |= SRAM_SIMO_PIN;
-
-  /* 3 pin SPI master, MSB first, clock inactive when low, phase is 1 */
-  UCA0CTL0 |= UCMST + UCMSB + UCCKPH + UCSYNC;
-  UCA0CTL1 |= UCSSEL__SMCLK;
-
-  /* spi clock of 8.39 MHz (chip can run at 16 MHz max)*/
-  UCA0BR0 = 0x02;
-  UCA0BR1 = 0x00;
-
-  /* release reset and wait for SPI to initialize */
-  UCA0CTL1 &= ~UCSWRST;
-  vTaskDelay(SPI_INIT_DELAY_IN_MS);
-    /*
-     * Read the status register
-     */
-    SRAM_CSN_ASSERT();
-    while (!(UCA0IFG & UCTXIFG));
-
-    /* writing automatically clears flag */
-    UCA0TXBUF = SPI_RDSR;
-    while (!(UCA0IFG&UCTXIFG));
-    UCA0TXBUF = DummyData;
-    while (!(UCA0IFG&UCTXIFG));
-    WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
-    ReadData = UCA0RXBUF;
-
-    unsigned char FinalSrValue = DEFAULT_SR_VALUE;
-    unsigned char DefaultSrValue = FINAL_SR_VALUE;
-
-    if (GetBoardConfiguration() >= 2)
-    {
-      DefaultSrValue = DEFAULT_SR_VALUE_256;
-      FinalSrValue = FINAL_SR_VALUE_256;
-    }
-
-    /* make sure correct value is read from the part */
-    if (ReadData != DefaultSrValue && ReadData != FinalSrValue) PrintS("# SRAM Init1");
-    SRAM_CSN_DEASSERT();
-
-    /* put the part into sequential mode */
-    SRAM_CSN_ASSERT();
-    UCA0TXBUF = SPI_WRSR;
-    while (!(UCA0IFG&UCTXIFG));
-    UCA0TXBUF = SEQUENTIAL_MODE_COMMAND;
-    while (!(UCA0IFG&UCTXIFG));
-    WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
-    SRAM_CSN_DEASSERT();
-
-    SRAM_CSN_ASSERT();
-    UCA0TXBUF = SPI_RDSR;
-    while (!(UCA0IFG&UCTXIFG));
-
-    UCA0TXBUF = DummyData;
-    while (!(UCA0IFG&UCTXIFG));
-    WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
-    ReadData = UCA0RXBUF;
-
-    /* make sure correct value is read from the part */
-    if (ReadData != FinalSrValue) PrintS("# SRAM Init2");
-    SRAM_CSN_DEASSERT();
-
-  /* now use the DMA to clear the serial ram */
-    SetAddr(MODE_BUF_START_ADDR);
-    Write((unsigned long)&DummyData, MODE_BUFFER_SIZE - SRAM_HEADER_LEN, DMA_FILL);
+  InitSramSpi();
+  InitSramMap();
+
+  /* now use the DMA to clear the mode screens, their back screens and the
+   * notification pages (the last two are next to each other) */
+  SramSetAddr(SramRegionAddr(SRAM_REGION_MODE));
+  SramWrite((unsigned long)&DummyData, SramRegionSize(SRAM_REGION_MODE) - SRAM_HEADER_LEN, DMA_FILL);
+  SramSetAddr(SramRegionAddr(SRAM_REGION_BACK));
+  SramWrite((unsigned long)&DummyData, SramRegionSize(SRAM_REGION_BACK) +
+            SramRegionSize(SRAM_REGION_NOTIF) - SRAM_HEADER_LEN, DMA_FILL);
+
+#if SRAM_LINE_CACHE
+  unsigned char i;
+  for (i = 0; i < SRAM_LINE_CACHE; ++i)
+  {
+    Cache[i].Addr = NO_LINE;
+    Cache[i].Age = i;
+  }
+#endif
 
   InitWidget();
   
@@ -601,24 +1010,3 @@ void InitSerialRam(void)
 
   DisableSmClkUser(SERIAL_RAM_USER);
 }
-
-/* Serial RAM controller uses two dma channels
- * LCD driver task uses one dma channel
- */
-#ifndef __IAR_SYSTEMS_ICC__
-#pragma CODE_SECTION(DMA_ISR,".text:_isr");
-#endif
-
-#pragma vector=DMA_VECTOR
-__interrupt void DMA_ISR(void)
-{
-  /* 0 is no interrupt and remainder are channels 0-7 */
-  switch(__even_in_range(DMAIV,16))
-  {
-  case 0: break;
-  case 2: DmaBusy = 0; break;
-  case 4: DmaBusy = 0; break;
-  case 6: LcdDmaIsr(); break;
-  default: break;
-  }
-}
@@ -17,12 +17,6 @@
 #ifndef SERIAL_RAM_H
 #define SERIAL_RAM_H
 
-#define SRAM_HEADER_LEN           3
-#define SPI_READ                (0x03)
-#define SPI_WRITE               (0x02)
-#define DMA_FILL                  1
-#define DMA_COPY                  0
-
 /* defines for write buffer command */
 #define MSG_OPT_WRTBUF_1_LINE      (0x10)
 #define MSG_OPT_WRTBUF_MULTILINE   (0x40)
@@ -42,17 +36,53 @@ void WriteBufferHandler(tMessage *pMsg);
 /*! Handle the update display message */
 void UpdateDisplayHandler(tMessage *pMsg);
 
+/*! Check if the next update message (same options) repaints everything pMsg
+ * would. If needed the rectangle of pNext is widened to cover pMsg.
+ *
+ * \return TRUE if pMsg can be dropped
+ */
+unsigned char UpdateSuperseded(tMessage *pMsg, tMessage *pNext);
+
 /*! Handle the load template message */
 void LoadTemplateHandler(tMessage *pMsg);
 
-void Write(unsigned long const pData, unsigned int Length, unsigned char Op);
-void Read(unsigned char *pWriteData, unsigned char *pReadData, unsigned int Length);
+/*! Read full lines of the draw page of a mode into MCU ram so the following
+ * DrawBitmapToSram calls on those lines need no serial ram access. Nothing is
+ * done if a band is already open, it is too tall or SRAM_DRAW_BAND is 0;
+ * bitmaps outside the band are still drawn row by row.
+ */
+void OpenSramBand(unsigned char StartRow, unsigned char RowNum, unsigned char Mode);
+
+/*! Write the open band back to the serial ram in one transfer */
+void CloseSramBand(void);
+
+/*! Write the changed lines of the line cache to the serial ram
+ * (before the mode buffers are read) */
+void FlushSramCache(void);
+
+/*! Forget cached lines in Addr .. Addr + Length - 1 before they are
+ * written directly
+ *
+ * \param WriteBack is FALSE if the lines are going to be overwritten completely
+ */
+void DropSramCache(unsigned int Addr, unsigned int Length, unsigned char WriteBack);
+
+/*! Send RowNum screen lines at Addr in the serial ram to the lcd from
+ * StartRow on, reading the next burst while the last one is written */
+void SramToLcd(unsigned int Addr, unsigned char StartRow, unsigned char RowNum);
+
+/*! Give the notification page read ahead back to the heap */
+void DropReadAhead(void);
 
 void DrawBitmapToSram(Draw_t *Info, unsigned char WidthInBytes, unsigned char const *pBitmap, unsigned char Mode);
 void DrawTemplateToSram(Draw_t *Info, unsigned char Mode);
 void DrawStatusBar(void);
 void ClearSram(unsigned char Mode);
-void LoadBuffer(unsigned char QuadIndex, unsigned char const *pTemp);
+void LoadBuffer(unsigned char QuadIndex, tTemplate pTemp);
+
+/*! Print the notification pages newest first with their time, source
+ * (P phone, C call) and whether they have been paged through */
+void ShowNotifRing(void);
 
 /*! This sets up the peripheral in the MSP430, the external serial ram,
  * and clears the serial RAM memory to zero. */
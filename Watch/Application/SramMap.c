@@ -0,0 +1,122 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file SramMap.c
+*
+* Every region is a whole number of units. Regions are placed one after
+* another from address 0 in the order of their defines.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "hal_board_type.h"
+#include "hal_miscellaneous.h"
+#include "Messages.h"
+#include "DebugUart.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "BitmapData.h"
+#include "Widget.h"
+#include "Trace.h"
+#include "SramMap.h"
+
+/* the 256 Kbit part is fitted from board configuration 2 */
+#define SRAM_SIZE_64K             (0x2000)
+#define SRAM_SIZE_256K            (0x8000)
+
+typedef struct
+{
+  unsigned int Unit;
+  unsigned int Min[2]; // 64 Kbit, 256 Kbit part
+  unsigned int Max;
+} RegionRule_t;
+
+typedef struct
+{
+  unsigned int Addr;
+  unsigned int Units;
+} Region_t;
+
+/* same order as SRAM_REGION_ */
+static RegionRule_t const Rule[SRAM_REGION_NUM] =
+{
+  {BYTES_PER_SCREEN, {3, 3}, 3},
+  {BYTES_PER_QUAD, {QUAD_NUM, QUAD_NUM}, WGT_QUAD_MAX},
+  {BYTES_PER_SCREEN, {0, 0}, IDLE_PAGE_NUM},
+  {BYTES_PER_SCREEN, {0, 0}, 3},
+  {BYTES_PER_SCREEN, {1, 1}, NOTIF_MAX_PAGES},
+  {TRACE_SLOT_SIZE, {0, TRACE_MIN_SLOTS}, 0xFFFF}
+};
+
+static char const RegionName[SRAM_REGION_NUM][6] = {"Mode", "Wgt", "Page", "Back", "Notif", "Trace"};
+
+static Region_t Map[SRAM_REGION_NUM];
+
+void InitSramMap(void)
+{
+  unsigned char Big = GetBoardConfiguration() >= 2;
+  unsigned int Free = Big ? SRAM_SIZE_256K : SRAM_SIZE_64K;
+  unsigned int Addr = 0;
+  unsigned char i;
+
+  /* minimum first so the small part still gets every region */
+  for (i = 0; i < SRAM_REGION_NUM; ++i)
+  {
+    Map[i].Units = Rule[i].Min[Big];
+    Free -= Rule[i].Min[Big] * Rule[i].Unit;
+  }
+
+  for (i = 0; i < SRAM_REGION_NUM; ++i)
+  {
+    unsigned int More = Free / Rule[i].Unit;
+    if (More > Rule[i].Max - Rule[i].Min[Big]) More = Rule[i].Max - Rule[i].Min[Big];
+
+    Map[i].Units += More;
+    Free -= More * Rule[i].Unit;
+  }
+
+  for (i = 0; i < SRAM_REGION_NUM; ++i)
+  {
+    Map[i].Addr = Addr;
+    Addr += Map[i].Units * Rule[i].Unit;
+  }
+}
+
+unsigned int SramRegionAddr(unsigned char Region)
+{
+  return Map[Region].Addr;
+}
+
+unsigned int SramRegionSize(unsigned char Region)
+{
+  return Map[Region].Units * Rule[Region].Unit;
+}
+
+unsigned int SramRegionUnits(unsigned char Region)
+{
+  return Map[Region].Units;
+}
+
+void ShowSramMap(void)
+{
+  unsigned char i;
+
+  for (i = 0; i < SRAM_REGION_NUM; ++i)
+  {
+    PrintF("%s:%04X %u x%u", RegionName[i], Map[i].Addr, Map[i].Units, Rule[i].Unit);
+  }
+}
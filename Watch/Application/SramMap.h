@@ -0,0 +1,64 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file SramMap.h
+ *
+ * Address map of the external serial ram. The regions are sized when the
+ * watch starts from the size of the fitted part (8 Kbyte or 32 Kbyte): the
+ * mode screens and the minimum of every region first (on the bigger part
+ * that includes TRACE_MIN_SLOTS of message trace), then widget quads,
+ * composed idle pages, back screens, notification pages and the message
+ * trace get what is left, in that order.
+ */
+/******************************************************************************/
+
+#ifndef SRAM_MAP_H
+#define SRAM_MAP_H
+
+/*! idle (old ui), application and music screens */
+#define SRAM_REGION_MODE          0
+/*! 288 byte widget quads */
+#define SRAM_REGION_WIDGET        1
+/*! widget quads of each idle page composed into a screen; pages without
+ * one are composed on the way to the lcd */
+#define SRAM_REGION_PAGE          2
+/*! second screen of the modes in SRAM_REGION_MODE (same order) for drawing
+ * while the first one is shown; a mode without one draws where it shows */
+#define SRAM_REGION_BACK          3
+/*! ring of notification screens */
+#define SRAM_REGION_NOTIF         4
+/*! notification screens the ring grows to on the bigger part */
+#define NOTIF_MAX_PAGES           16
+/*! message trace slots */
+#define SRAM_REGION_TRACE         5
+#define SRAM_REGION_NUM           6
+
+/*! Lay out the regions for the fitted part (board configuration must be known) */
+void InitSramMap(void);
+
+unsigned int SramRegionAddr(unsigned char Region);
+
+/*! \return size of Region in bytes (a multiple of its unit) */
+unsigned int SramRegionSize(unsigned char Region);
+
+/*! \return number of units (screens, quads, slots) in Region */
+unsigned int SramRegionUnits(unsigned char Region);
+
+/*! Print the address map */
+void ShowSramMap(void);
+
+#endif /* SRAM_MAP_H */
@@ -19,7 +19,9 @@
 *
 */
 /******************************************************************************/
+#include <string.h>
 #include "FreeRTOS.h"
+#include "task.h"
 
 #include "portmacro.h"
 
@@ -56,3 +58,241 @@ void IncrementRxCrcFailureCount(void)
 {
   gBtStats.RxCrcFailureCount++;
 }
+
+void ShowAppStats(void)
+{
+  PrintF("Pool:%u QOvfl:%u", gAppStats.BufferPoolFailure, gAppStats.QueueOverflow);
+  PrintF("Uart:%u Fll:%u", gAppStats.DebugUartOverflow, gAppStats.FllFailure);
+  PrintF("Repaint Saved:%u", gAppStats.RepaintsSaved);
+  PrintF("Quad Load Saved:%u", gAppStats.QuadLoadsSaved);
+  PrintF("Quads Kept:%u", gAppStats.QuadsKept);
+  PrintF("DmaWait:%u Freed:%u", gAppStats.DmaWaits, gAppStats.DmaTicksFreed);
+  PrintF("Cache Hit:%u Miss:%u", gAppStats.SramCacheHits, gAppStats.SramCacheMisses);
+}
+
+/* same order as HEAP_SITE_ in FreeRTOSConfig.h */
+static char const HeapSiteName[configHEAP_SITE_NUM][5] =
+{
+  "Oth", "Msg", "Drw", "Wgt", "LcdR", "Sram", "LcdB", "Tmr", "Call", "Cdt", "Log", "Dbg"
+};
+
+void ShowHeapStats(void)
+{
+  xHeapStats Stats;
+  unsigned short Allocs;
+  unsigned short Fails;
+  unsigned char i;
+
+  vPortGetHeapStats(&Stats);
+
+  PrintF("Free:%u Min:%u", Stats.xFreeBytes, Stats.xMinimumEverFreeBytes);
+  PrintF("Max:%u Blks:%u", Stats.xLargestFreeBlock, Stats.usFreeBlocks);
+  PrintF("Alloc:%u Fail:%u", Stats.usAllocations, Stats.usFailures);
+  PrintF("Live:%u", Stats.usAllocations - Stats.usFrees);
+
+  /* free blocks below each size */
+  for (i = 0; i < portHEAP_HISTOGRAM_SIZE; i++)
+  {
+    if (i < portHEAP_HISTOGRAM_SIZE - 1)
+      PrintE(" <%u:%u", portHEAP_HISTOGRAM_BASE << i, Stats.usHistogram[i]);
+    else PrintE(" >:%u", Stats.usHistogram[i]);
+  }
+  PrintR();
+
+  for (i = 0; i < configHEAP_SITE_NUM; i++)
+  {
+    vPortGetHeapSiteStats(i, &Allocs, &Fails);
+    if (Allocs || Fails) PrintF("%s:%u(%u)", HeapSiteName[i], Allocs, Fails);
+  }
+}
+
+#if MESSAGE_TIMING
+
+#define NO_TIMING_SLOT          (0xFF)
+#define TIMING_TASK_NUM         2
+
+typedef struct
+{
+  unsigned int Sent;
+  unsigned int Received;
+  unsigned int Probe; // sequence number of the followed message
+  portTickType Tick;  // when it was queued
+  unsigned char Active;
+} tTimingLane;
+
+static tTimingLane TimingLane[TIMING_LANE_NUM];
+
+/* message type of each histogram slot, 0 for free (type 0 is not a message) */
+static unsigned char TimedType[TIMING_TYPE_NUM];
+static unsigned int TimedUses[TIMING_TYPE_NUM];
+static unsigned char WaitHist[TIMING_TYPE_NUM][TIMING_BUCKET_NUM];
+static unsigned char ServiceHist[TIMING_TYPE_NUM][TIMING_BUCKET_NUM];
+
+static portTickType ServiceStart[TIMING_TASK_NUM];
+static unsigned char ServiceSlot[TIMING_TASK_NUM] = {NO_TIMING_SLOT, NO_TIMING_SLOT};
+
+/* serial ram bus use of each message type */
+static unsigned int BusMsgs[TIMING_TYPE_NUM];
+static unsigned long BusBytes[TIMING_TYPE_NUM];
+static unsigned int BusFrames[TIMING_TYPE_NUM];
+
+static unsigned long BytesStart[TIMING_TASK_NUM];
+static unsigned int FramesStart[TIMING_TASK_NUM];
+
+static unsigned char TimingSlot(unsigned char Type);
+static void AddTime(unsigned char *pHist, portTickType Ticks);
+
+void MessageQueued(unsigned char Lane, unsigned char Front)
+{
+  tTimingLane *pLane = &TimingLane[Lane];
+
+  portENTER_CRITICAL();
+  pLane->Sent ++;
+
+  /* a message put in front moves the followed one back */
+  if (Front) pLane->Active = FALSE;
+  else if (!pLane->Active)
+  {
+    pLane->Probe = pLane->Sent;
+    pLane->Tick = xTaskGetTickCount();
+    pLane->Active = TRUE;
+  }
+  portEXIT_CRITICAL();
+}
+
+void MessageReceived(unsigned char Type, unsigned char Lane, unsigned char Task)
+{
+  tTimingLane *pLane = &TimingLane[Lane];
+  portTickType Now = xTaskGetTickCount();
+  unsigned char Slot = TimingSlot(Type);
+
+  portENTER_CRITICAL();
+  pLane->Received ++;
+
+  if (pLane->Active && (int)(pLane->Received - pLane->Probe) >= 0)
+  {
+    /* lost track if it went past the followed message */
+    if (pLane->Received == pLane->Probe && Slot != NO_TIMING_SLOT)
+      AddTime(WaitHist[Slot], Now - pLane->Tick);
+
+    pLane->Active = FALSE;
+  }
+  portEXIT_CRITICAL();
+
+  ServiceStart[Task] = Now;
+  ServiceSlot[Task] = Slot;
+  BytesStart[Task] = gAppStats.SramBytes;
+  FramesStart[Task] = gAppStats.SramFrames;
+}
+
+void MessageServiced(unsigned char Task)
+{
+  unsigned char Slot = ServiceSlot[Task];
+  if (Slot == NO_TIMING_SLOT) return;
+
+  AddTime(ServiceHist[Slot], xTaskGetTickCount() - ServiceStart[Task]);
+  ServiceSlot[Task] = NO_TIMING_SLOT;
+
+  /* includes what the other task did on the bus meanwhile */
+  BusMsgs[Slot] ++;
+  BusBytes[Slot] += gAppStats.SramBytes - BytesStart[Task];
+  BusFrames[Slot] += gAppStats.SramFrames - FramesStart[Task];
+}
+
+void ShowMessageTiming(void)
+{
+  unsigned char i;
+  unsigned char k;
+
+  PrintF("- Timing:%u Tick:%u", TIMING_BUCKET_NUM, configTICK_RATE_HZ);
+
+  for (i = 0; i < TIMING_TYPE_NUM && TimedType[i]; ++i)
+  {
+    PrintE("%02X %u W:", TimedType[i], TimedUses[i]);
+    for (k = 0; k < TIMING_BUCKET_NUM; ++k) PrintH(WaitHist[i][k]);
+    PrintW("S:");
+    PrintQ(ServiceHist[i], TIMING_BUCKET_NUM);
+  }
+}
+
+void ShowSramBus(void)
+{
+  unsigned char i;
+
+  PrintF("Bus:%uK Frm:%u Dma:%u", (unsigned int)(gAppStats.SramBytes >> 10),
+         gAppStats.SramFrames, gAppStats.SramTransfers);
+  PrintS("Type Msgs Bytes/Frames per msg");
+
+  for (i = 0; i < TIMING_TYPE_NUM && TimedType[i]; ++i)
+  {
+    if (BusMsgs[i] == 0) continue;
+
+    PrintF("%02X %u %u/%u", TimedType[i], BusMsgs[i],
+      (unsigned int)(BusBytes[i] / BusMsgs[i]), BusFrames[i] / BusMsgs[i]);
+
+    BusMsgs[i] = 0;
+    BusBytes[i] = 0;
+    BusFrames[i] = 0;
+  }
+}
+
+static unsigned char TimingSlot(unsigned char Type)
+{
+  unsigned char i;
+  unsigned char Least = 0;
+
+  portENTER_CRITICAL();
+  for (i = 0; i < TIMING_TYPE_NUM && TimedType[i] && TimedType[i] != Type; ++i)
+  {
+    if (TimedUses[i] < TimedUses[Least]) Least = i;
+  }
+
+  if (i == TIMING_TYPE_NUM)
+  {
+    /* take over the least used slot; its count carries on to the new type */
+    i = Least;
+    memset(WaitHist[i], 0, TIMING_BUCKET_NUM);
+    memset(ServiceHist[i], 0, TIMING_BUCKET_NUM);
+    BusMsgs[i] = 0;
+    BusBytes[i] = 0;
+    BusFrames[i] = 0;
+
+    /* the other task may still be servicing the old type */
+    for (Least = 0; Least < TIMING_TASK_NUM; ++Least)
+    {
+      if (ServiceSlot[Least] == i) ServiceSlot[Least] = NO_TIMING_SLOT;
+    }
+  }
+
+  TimedType[i] = Type;
+
+  if (TimedUses[i] == 0xFFFF)
+  {
+    for (Least = 0; Least < TIMING_TYPE_NUM; ++Least) TimedUses[Least] >>= 1;
+  }
+  TimedUses[i] ++;
+  portEXIT_CRITICAL();
+
+  return i;
+}
+
+/* counts are halved when one of them is full so the shape is kept */
+static void AddTime(unsigned char *pHist, portTickType Ticks)
+{
+  unsigned char Bucket = 0;
+  unsigned char i;
+
+  while (Ticks && Bucket < TIMING_BUCKET_NUM - 1)
+  {
+    Ticks >>= 1;
+    Bucket ++;
+  }
+
+  if (pHist[Bucket] == 0xFF)
+  {
+    for (i = 0; i < TIMING_BUCKET_NUM; ++i) pHist[i] >>= 1;
+  }
+  pHist[Bucket] ++;
+}
+
+#endif /* MESSAGE_TIMING */
@@ -55,6 +55,28 @@ typedef struct
  *
  * \param BufferPoolFailure indicates that a buffer was not available when a task
  * requested it.
+ *
+ * \param RepaintsSaved counts display updates dropped because an equivalent
+ * one was queued right behind them
+ *
+ * \param DmaWaits counts long serial ram and lcd transfers the display task
+ * blocked on instead of spinning
+ *
+ * \param DmaTicksFreed is the time (ticks) given to other tasks or LPM by
+ * those waits
+ *
+ * \param SramCacheHits and SramCacheMisses count draws to a serial ram line
+ * that was or was not in the line cache
+ *
+ * \param SramBytes counts bytes clocked to and from the serial ram (command
+ * and address included), SramFrames the chip select frames and
+ * SramTransfers the DMA transfers they took
+ *
+ * \param QuadLoadsSaved counts widget placeholder templates that have not
+ * been written to the serial ram because their quad was not shown yet
+ *
+ * \param QuadsKept counts widget quads given back to a widget that returned
+ * to the list with the quad still drawn
  */
 typedef struct
 {
@@ -62,6 +84,16 @@ typedef struct
   unsigned char BufferPoolFailure;
   unsigned char QueueOverflow;
   unsigned char FllFailure;
+  unsigned int RepaintsSaved;
+  unsigned int DmaWaits;
+  unsigned int DmaTicksFreed;
+  unsigned int SramCacheHits;
+  unsigned int SramCacheMisses;
+  unsigned long SramBytes;
+  unsigned int SramFrames;
+  unsigned int SramTransfers;
+  unsigned int QuadLoadsSaved;
+  unsigned int QuadsKept;
   
 } tApplicationStatistics;
 
@@ -81,4 +113,54 @@ void IncrementUpTime(void);
  */
 void IncrementRxCrcFailureCount(void);
 
+/*! Print the application statistics */
+void ShowAppStats(void);
+
+/*! Print free heap, lifetime minimum, largest free block, a histogram of the
+ * free block sizes and the allocations (failures) of each call site */
+void ShowHeapStats(void);
+
+/*! Message timing
+ *
+ * One message per lane (display, wrapper, urgent display) at a time is
+ * followed from its queue to its handler for the wait time. The service
+ * time is taken from ShowMessageInfo to CheckStackAndQueueUsage. Both go
+ * into log2 histograms (bucket n holds 2^(n-1)..2^n-1 ticks) of up to
+ * TIMING_TYPE_NUM message types. When all are taken a new type replaces the
+ * least used one and carries on its use count, so a rare type only ever
+ * takes the least used slot. The serial ram bus use during the service time
+ * is added up for the same types.
+ */
+#define TIMING_LANE_NUM         3
+#define TIMING_TYPE_NUM         8
+#define TIMING_BUCKET_NUM       12
+
+#if MESSAGE_TIMING
+
+/*! a message was put into a lane (Front if at the front of the queue) */
+void MessageQueued(unsigned char Lane, unsigned char Front);
+
+/*! a message was taken out of a lane by the task of queue Task */
+void MessageReceived(unsigned char Type, unsigned char Lane, unsigned char Task);
+
+/*! the task of queue Task is done with its message */
+void MessageServiced(unsigned char Task);
+
+/*! Print the wait and service histograms of each message type, one line
+ * per type: "type uses W:bucket.. S:bucket.." in hex; Host/Tools/TimingDecode
+ * turns them into p50/p99 */
+void ShowMessageTiming(void);
+
+/*! Print the serial ram bus totals and the bytes and chip select frames
+ * per message of each message type since the last call */
+void ShowSramBus(void);
+
+#else
+
+#define MessageQueued(_Lane, _Front)
+#define MessageReceived(_Type, _Lane, _Task)
+#define MessageServiced(_Task)
+
+#endif
+
 #endif /* STATISTICS_H */
@@ -26,6 +26,14 @@
 #include "hal_board_type.h"
 #include "hal_boot.h"
 #include "Log.h"
+#include "BufferPool.h"
+#include "Statistics.h"
+#include "Trace.h"
+#include "DrawHandler.h"
+#include "LcdDriver.h"
+#include "BitmapData.h"
+#include "SerialRam.h"
+#include "SramMap.h"
 
 /* don't forget null character */
 #define MAX_CMD_LEN           8
@@ -52,6 +60,21 @@ static tCommand const COMMAND_TABLE[] =
   {"reset", ResetHandler},
   {"ship", EnableShippingMode},
   {"log", ShowStateLog},
+  {"pool", ShowBufferPool},
+  {"lane", ShowLaneInfo},
+  {"stats", ShowAppStats},
+  {"heap", ShowHeapStats},
+  {"sram", ShowSramMap},
+  {"notif", ShowNotifRing},
+#if MESSAGE_TIMING
+  {"timing", ShowMessageTiming},
+  {"bus", ShowSramBus},
+#endif
+#if TRACE_CAPTURE
+  {"trace", ToggleTrace},
+  {"tdump", DumpTrace},
+  {"treplay", ReplayTrace},
+#endif
   {{0x01,0x10,0x03,'?','?','?', 0x30}, EnterBootloader} // Metaboot
 };
 #define NUMBER_OF_COMMANDS (sizeof(COMMAND_TABLE)/sizeof(tCommand))
@@ -0,0 +1,384 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Trace.c
+*
+* RouteMsg can be called from any task so a message is only copied into a
+* small staging ring in a critical section. The display task writes the
+* staged slots to the serial ram between messages (the serial ram is only
+* driven by the display task). Slots that do not fit in the staging ring are
+* counted as dropped.
+*
+* Replay routes one slot at a time while the display queue is short, so the
+* display task runs at full speed without overflowing its queue. Only
+* messages from the wrapper task (the phone) that are handled by the display
+* task and were not truncated are replayed. The recorded ticks are kept in
+* the dump for replaying at the recorded speed from a host.
+*
+* The heap operations are recorded with the messages, after the layout of
+* the heap when recording starts. The layout is staged with the scheduler
+* suspended so no operation falls between it and the first one recorded.
+* A repaint alone allocates and frees several buffers, so operations are
+* added to the newest staged slot while it has room; a slot being written
+* to the serial ram is copied in a critical section for that.
+*/
+/******************************************************************************/
+
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "hal_board_type.h"
+#include "hal_clock_control.h"
+#include "hal_serial_ram.h"
+#include "Messages.h"
+#include "LcdDisplay.h"
+#include "DebugUart.h"
+#include "SramMap.h"
+#include "Trace.h"
+
+#if TRACE_CAPTURE
+
+#define TRACE_SRAM_START        (SramRegionAddr(SRAM_REGION_TRACE))
+#define TRACE_SRAM_SLOTS        (SramRegionUnits(SRAM_REGION_TRACE))
+
+/* must be a power of 2 */
+#define TRACE_STAGE_SLOTS       8
+
+/* replay while fewer messages than this are waiting in the display queue */
+#define TRACE_REPLAY_DEPTH      4
+
+/* set by CreateDisplayTask */
+extern xTaskHandle DisplayTaskHandle;
+
+#define SLOT_TICK               0
+#define SLOT_TYPE               2
+#define SLOT_OPTIONS            3
+#define SLOT_LENGTH             4
+#define SLOT_SOURCE             5
+
+/* the only tasks besides the display task are the library's (wrapper) tasks */
+#define SOURCE_ISR              'I'
+#define SOURCE_DISPLAY          'D'
+#define SOURCE_WRAPPER          'W'
+#define SOURCE_HEAP             'H'
+
+#define HEAP_OPS                'O'
+#define HEAP_OP_LEN             6
+#define HEAP_LAYOUT             'L'
+/* block sizes are even */
+#define HEAP_ALLOCATED          0x0001
+
+#define TRACE_OFF               0
+#define TRACE_RECORD            1
+#define TRACE_REPLAY            2
+
+static unsigned char State = TRACE_OFF;
+
+static unsigned char Stage[TRACE_STAGE_SLOTS][TRACE_SLOT_SIZE];
+static unsigned char StageIn = 0;
+static unsigned char StageOut = 0;
+static unsigned int Dropped = 0;
+
+#if configUSE_HEAP_TRACE_HOOK
+static unsigned char Layout[TRACE_PAYLOAD_LEN];
+static unsigned char LayoutLen;
+static unsigned char LayoutFirst;
+static unsigned int LayoutBlocks;
+#endif
+
+static unsigned int SramHead = 0;
+static unsigned int SlotNum = 0;
+
+static unsigned int ReplaySlot;
+static unsigned int ReplayLeft;
+static unsigned int Replayed;
+
+/* errata - DMA variables cannot be function scope */
+static unsigned char SramBuf[SRAM_HEADER_LEN + TRACE_SLOT_SIZE];
+static unsigned char ReadBuf[SRAM_HEADER_LEN + 1 + TRACE_SLOT_SIZE];
+
+extern xSemaphoreHandle SramMutex;
+extern xQueueHandle QueueHandles[];
+
+static unsigned char TaskSource(void);
+static void StageSlot(unsigned char Type, unsigned char Options, unsigned char Length,
+                      unsigned char Source, void const *pData, unsigned char Len);
+static void StageLayout(void);
+static void WriteStage(void);
+static unsigned char *ReadSlot(unsigned int Slot);
+static unsigned int FirstSlot(void);
+static void ReplayNext(void);
+
+void TraceMsg(tMessage *pMsg)
+{
+  if (State != TRACE_RECORD) return;
+
+  StageSlot(pMsg->Type, pMsg->Options, pMsg->Length, TaskSource(), pMsg->pBuffer,
+    pMsg->Length < TRACE_PAYLOAD_LEN ? pMsg->Length : TRACE_PAYLOAD_LEN);
+}
+
+#if configUSE_HEAP_TRACE_HOOK
+void vApplicationHeapTraceHook(unsigned char Op, unsigned char Site, size_t Offset, size_t Size)
+{
+  if (State != TRACE_RECORD) return;
+
+  unsigned char Data[HEAP_OP_LEN] =
+    {Op, Site, (unsigned char)Offset, (unsigned char)(Offset >> 8),
+     (unsigned char)Size, (unsigned char)(Size >> 8)};
+
+  portENTER_CRITICAL();
+
+  unsigned char *pSlot = Stage[(StageIn - 1) & (TRACE_STAGE_SLOTS - 1)];
+
+  if (StageIn != StageOut && pSlot[SLOT_SOURCE] == SOURCE_HEAP && pSlot[SLOT_TYPE] == HEAP_OPS &&
+      pSlot[SLOT_LENGTH] + HEAP_OP_LEN <= TRACE_PAYLOAD_LEN)
+  {
+    memcpy(pSlot + TRACE_SLOT_HEADER_LEN + pSlot[SLOT_LENGTH], Data, HEAP_OP_LEN);
+    pSlot[SLOT_LENGTH] += HEAP_OP_LEN;
+    pSlot[SLOT_OPTIONS] ++;
+  }
+  else StageSlot(HEAP_OPS, 1, HEAP_OP_LEN, SOURCE_HEAP, Data, HEAP_OP_LEN);
+
+  portEXIT_CRITICAL();
+}
+#endif
+
+void TraceService(void)
+{
+  WriteStage();
+  if (State == TRACE_REPLAY) ReplayNext();
+}
+
+void ToggleTrace(void)
+{
+  if (State == TRACE_RECORD)
+  {
+    State = TRACE_OFF;
+    WriteStage();
+  }
+  else if (TRACE_SRAM_SLOTS == 0) PrintS("# Trace: no spare SRAM");
+  else
+  {
+    SramHead = 0;
+    SlotNum = 0;
+    Dropped = 0;
+
+    vTaskSuspendAll();
+    StageLayout();
+    State = TRACE_RECORD;
+    xTaskResumeAll();
+  }
+
+  PrintF("- Trace:%s %u Drop:%u", State == TRACE_RECORD ? "On" : "Off", SlotNum, Dropped);
+}
+
+void DumpTrace(void)
+{
+  if (State == TRACE_REPLAY) return;
+
+  WriteStage();
+
+  unsigned int Slot = FirstSlot();
+  unsigned int i;
+
+  PrintF("- Trace:%u Drop:%u", SlotNum, Dropped);
+
+  for (i = 0; i < SlotNum; ++i)
+  {
+    unsigned char *pSlot = ReadSlot(Slot);
+
+    PrintE("%u %c %02X %02X %u:", pSlot[SLOT_TICK] | pSlot[SLOT_TICK + 1] << 8,
+      pSlot[SLOT_SOURCE], pSlot[SLOT_TYPE], pSlot[SLOT_OPTIONS], pSlot[SLOT_LENGTH]);
+    PrintQ(pSlot + TRACE_SLOT_HEADER_LEN,
+      pSlot[SLOT_LENGTH] < TRACE_PAYLOAD_LEN ? pSlot[SLOT_LENGTH] : TRACE_PAYLOAD_LEN);
+
+    if (++Slot == TRACE_SRAM_SLOTS) Slot = 0;
+  }
+}
+
+void ReplayTrace(void)
+{
+  if (State == TRACE_REPLAY) return;
+
+  /* replaying would be recorded over the capture */
+  State = TRACE_OFF;
+  WriteStage();
+
+  ReplaySlot = FirstSlot();
+  ReplayLeft = SlotNum;
+  Replayed = 0;
+  State = TRACE_REPLAY;
+
+  PrintF("- Replay:%u", SlotNum);
+  ReplayNext();
+}
+
+static unsigned char TaskSource(void)
+{
+  if (!(__get_interrupt_state() & GIE)) return SOURCE_ISR;
+  return xTaskGetCurrentTaskHandle() == DisplayTaskHandle ? SOURCE_DISPLAY : SOURCE_WRAPPER;
+}
+
+static void StageSlot(unsigned char Type, unsigned char Options, unsigned char Length,
+                      unsigned char Source, void const *pData, unsigned char Len)
+{
+  portTickType Tick = xTaskGetTickCount();
+
+  portENTER_CRITICAL();
+
+  if ((unsigned char)(StageIn - StageOut) < TRACE_STAGE_SLOTS)
+  {
+    unsigned char *pSlot = Stage[StageIn & (TRACE_STAGE_SLOTS - 1)];
+
+    pSlot[SLOT_TICK] = (unsigned char)Tick;
+    pSlot[SLOT_TICK + 1] = (unsigned char)(Tick >> 8);
+    pSlot[SLOT_TYPE] = Type;
+    pSlot[SLOT_OPTIONS] = Options;
+    pSlot[SLOT_LENGTH] = Length;
+    pSlot[SLOT_SOURCE] = Source;
+    if (Len) memcpy(pSlot + TRACE_SLOT_HEADER_LEN, pData, Len);
+    StageIn ++;
+  }
+  else Dropped ++;
+
+  portEXIT_CRITICAL();
+}
+
+#if configUSE_HEAP_TRACE_HOOK
+static void FlushLayout(void)
+{
+  if (LayoutLen) StageSlot(HEAP_LAYOUT, LayoutFirst, LayoutLen, SOURCE_HEAP, Layout, LayoutLen);
+  LayoutLen = 0;
+}
+
+static void LayoutBlock(size_t Offset, size_t Size, unsigned char Allocated)
+{
+  if (!LayoutBlocks++) LayoutFirst = Offset;
+  if (Allocated) Size |= HEAP_ALLOCATED;
+
+  Layout[LayoutLen++] = (unsigned char)Size;
+  Layout[LayoutLen++] = (unsigned char)(Size >> 8);
+  if (LayoutLen == sizeof(Layout)) FlushLayout();
+}
+#endif
+
+/* the sizes of the heap blocks in address order (staging more slots than it
+ * holds drops them, and with them the capture) */
+static void StageLayout(void)
+{
+#if configUSE_HEAP_TRACE_HOOK
+  LayoutLen = 0;
+  LayoutBlocks = 0;
+  vPortWalkHeap(LayoutBlock);
+  FlushLayout();
+#endif
+}
+
+static void WriteStage(void)
+{
+  /* nothing can be staged without a trace region, but never write outside it */
+  if (TRACE_SRAM_SLOTS == 0)
+  {
+    StageOut = StageIn;
+    return;
+  }
+
+  while (StageOut != StageIn)
+  {
+    unsigned int Addr = SramHead * TRACE_SLOT_SIZE + TRACE_SRAM_START;
+
+    SramBuf[0] = SPI_WRITE;
+    SramBuf[1] = Addr >> 8;
+    SramBuf[2] = Addr;
+    /* the slot can be reused (or no longer added to) once it is copied */
+    portENTER_CRITICAL();
+    memcpy(SramBuf + SRAM_HEADER_LEN, Stage[StageOut & (TRACE_STAGE_SLOTS - 1)], TRACE_SLOT_SIZE);
+    StageOut ++;
+    portEXIT_CRITICAL();
+
+    xSemaphoreTake(SramMutex, portMAX_DELAY);
+    SramWrite((unsigned long)SramBuf, TRACE_SLOT_SIZE, DMA_COPY);
+    xSemaphoreGive(SramMutex);
+
+    if (++SramHead == TRACE_SRAM_SLOTS) SramHead = 0;
+    if (SlotNum < TRACE_SRAM_SLOTS) SlotNum ++;
+  }
+}
+
+static unsigned char *ReadSlot(unsigned int Slot)
+{
+  unsigned int Addr = Slot * TRACE_SLOT_SIZE + TRACE_SRAM_START;
+
+  SramBuf[0] = SPI_READ;
+  SramBuf[1] = Addr >> 8;
+  SramBuf[2] = Addr;
+
+  xSemaphoreTake(SramMutex, portMAX_DELAY);
+  EnableSmClkUser(SERIAL_RAM_USER);
+  SramRead(SramBuf, ReadBuf, TRACE_SLOT_SIZE);
+  DisableSmClkUser(SERIAL_RAM_USER);
+  xSemaphoreGive(SramMutex);
+
+  return ReadBuf + SRAM_HEADER_LEN + 1;
+}
+
+/* oldest slot once the ring has wrapped */
+static unsigned int FirstSlot(void)
+{
+  return SlotNum < TRACE_SRAM_SLOTS ? 0 : SramHead;
+}
+
+static void ReplayNext(void)
+{
+  while (ReplayLeft &&
+         uxQueueMessagesWaiting(QueueHandles[DISPLAY_QINDEX]) < TRACE_REPLAY_DEPTH)
+  {
+    unsigned char *pSlot = ReadSlot(ReplaySlot);
+
+    if (++ReplaySlot == TRACE_SRAM_SLOTS) ReplaySlot = 0;
+    ReplayLeft --;
+
+    if (pSlot[SLOT_SOURCE] != SOURCE_WRAPPER ||
+        MsgInfo[pSlot[SLOT_TYPE]].MsgQueue != DISPLAY_QINDEX ||
+        pSlot[SLOT_LENGTH] > TRACE_PAYLOAD_LEN) continue;
+
+    tMessage Msg = {pSlot[SLOT_LENGTH], pSlot[SLOT_TYPE], pSlot[SLOT_OPTIONS], NULL};
+
+    if (Msg.Length)
+    {
+      if (!CreateMessage(&Msg))
+      {
+        ReplayLeft = 0;
+        break;
+      }
+      memcpy(Msg.pBuffer, pSlot + TRACE_SLOT_HEADER_LEN, Msg.Length);
+    }
+
+    RouteMsg(&Msg);
+    Replayed ++;
+  }
+
+  if (!ReplayLeft)
+  {
+    State = TRACE_OFF;
+    PrintF("- Replayed:%u", Replayed);
+  }
+}
+
+#endif /* TRACE_CAPTURE */
@@ -0,0 +1,77 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Trace.h
+ *
+ * Message trace capture. While recording, every message that goes through
+ * RouteMsg is copied into a fixed size slot and written to a ring in the
+ * trace region of the serial ram (SramMap.h). The capture can be dumped over the
+ * debug uart ("tdump") or routed again to the display task ("treplay") to
+ * repeat phone traffic as a benchmark.
+ *
+ * A slot is: tick (2, LSB first), type, options, length, source ('D' from the
+ * display task, 'W' from the wrapper (library) tasks, 'I' from an isr) and
+ * the first TRACE_PAYLOAD_LEN bytes of the payload. Length is the original
+ * length.
+ *
+ * The heap operations (heap_4.c) are recorded too, source 'H' and type 'O',
+ * up to four a slot (the tick of the first), the number in the options.
+ * An operation is: 'A' allocation, 'F' free or 'X' failed allocation, the
+ * call site (HEAP_SITE_, 0 for a free), the offset of the memory in the heap
+ * (2, LSB first) and the size of the block without its header (2, the
+ * requested size of a failure). Recording starts with type 'L' slots: the
+ * sizes of all the blocks in address order (2 each, bit 0 set for an
+ * allocated block: the sizes are even), the offset of the first one (the
+ * header size) in the options. Tools/HeapReplay replays them on the host.
+ */
+/******************************************************************************/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#define TRACE_SLOT_SIZE         32
+#define TRACE_SLOT_HEADER_LEN   6
+#define TRACE_PAYLOAD_LEN       (TRACE_SLOT_SIZE - TRACE_SLOT_HEADER_LEN)
+
+/*! slots kept for the trace on the 256 Kbit part before notification
+ * pages are added (the 8 Kbyte part only gets what is left over) */
+#if TRACE_CAPTURE
+#define TRACE_MIN_SLOTS         64
+#else
+#define TRACE_MIN_SLOTS         0
+#endif
+
+/*! Copy a message into the staging buffer if recording is on
+ * (called by RouteMsg)
+ */
+void TraceMsg(tMessage *pMsg);
+
+/*! Write staged slots to the serial ram and route the next replayed
+ * message (called by the display task after each message)
+ */
+void TraceService(void);
+
+/*! Start or stop recording; starting clears the previous capture */
+void ToggleTrace(void);
+
+/*! Print the capture one slot per line, oldest first */
+void DumpTrace(void);
+
+/*! Route the recorded phone messages for the display task again */
+void ReplayTrace(void);
+
+#endif /* TRACE_H */
@@ -28,17 +28,19 @@
 #include "Property.h"
 #include "Widget.h"
 #include "ClockWidget.h"
+#include "hal_serial_ram.h"
 #include "SerialRam.h"
+#include "SramMap.h"
 #include "hal_rtc.h"
+#include "Statistics.h"
 
 #define MAX_WIDGET_NUM          (16)
 #define QUAD_NO_MASK            (0x03)
 #define IDLE_PAGE_MASK          (0x30)
 #define IDLE_PAGE_SHFT          (4)
 
-#define WGT_BUF_START_ADDR      (0x80) //(1024x8-1152x7=128 (0x1B00) // 96x12x(4 + 2) = 6912
+#define WGT_BUF_START_ADDR      (SramRegionAddr(SRAM_REGION_WIDGET))
 
-#define BUFFER_TAG_BITS         (16)
 #define WGTLST_PART_INDX_MASK   (0x3)
 #define WGTLST_PARTS_MASK       (0xC)
 #define WGTLST_PART_INDX_SHFT   (0)
@@ -82,6 +84,17 @@ typedef struct
 static Widget_t Widget[MAX_WIDGET_NUM + MAX_WIDGET_NUM];
 static Widget_t *pCurrWidgetList = &Widget[MAX_WIDGET_NUM]; // point to left/right half of double sized Widget[]
 
+/* slots of pCurrWidgetList found without a scan; IndexWidgets builds them
+ * again after every change of the list */
+#define NO_SLOT           (0xFF)
+#define ID_HASH_SIZE      (MAX_WIDGET_NUM * 2) // power of 2, never full
+#define ID_HASH(_x)       (((_x) ^ ((_x) >> 5)) & (ID_HASH_SIZE - 1))
+#define ID_NEXT(_h)       (((_h) + 1) & (ID_HASH_SIZE - 1))
+/* slot of each widget but the clocks by id (open addressing) */
+static unsigned char IdSlot[ID_HASH_SIZE];
+/* slot << 2 | quad of the widget shown in each quad of each idle page */
+static unsigned char PageQuad[IDLE_PAGE_NUM][QUAD_NUM];
+
 typedef struct
 {
   unsigned char QuadNum;
@@ -90,7 +103,44 @@ typedef struct
 
 Layout_t const Layout[] = {{1, 0}, {2, 1}, {2, 2}, {4, 1}};
 
-static unsigned int BufTag = 0;
+/* one bit per quad of the widget region */
+#define TAG_WORDS         ((WGT_QUAD_MAX + 15) >> 4)
+#define TAG_BIT(_t)       (1U << ((_t) & 0x0F))
+#define IS_TAG(_m, _t)    ((_m)[(_t) >> 4] & TAG_BIT(_t))
+#define SET_TAG(_m, _t)   ((_m)[(_t) >> 4] |= TAG_BIT(_t))
+#define CLR_TAG(_m, _t)   ((_m)[(_t) >> 4] &= ~TAG_BIT(_t))
+
+/* quads assigned to a widget in the list */
+static unsigned int BufTag[TAG_WORDS];
+static unsigned char UsedNum = 0;
+/* quads whose placeholder is not in the serial ram yet: "Loading..." while
+ * the BufTag bit is set, "+" once it is clear */
+static unsigned int PendTag[TAG_WORDS];
+/* free quads still holding a widget that left the list, oldest first. The
+ * widget gets its quad back if it returns; the oldest one is reused when no
+ * clean quad is left */
+static unsigned char Kept[WGT_QUAD_MAX];
+static unsigned char KeptNum = 0;
+static unsigned int KeptTag[TAG_WORDS];
+/* widget id and (layout type << 2 | quad) a quad was assigned for */
+static unsigned char QuadOwner[WGT_QUAD_MAX];
+static unsigned char QuadPart[WGT_QUAD_MAX];
+/* template bytes not written since the start of the SetWidgetList */
+static unsigned int BytesSaved = 0;
+
+#define QUAD_LOAD_BYTES   (BYTES_PER_QUAD + SRAM_HEADER_LEN)
+
+/* the quads of each idle page composed into a screen (SRAM_REGION_PAGE)
+ * with one bit for each row that has changed since */
+#define PAGE_ADDR(_p)     (SramRegionAddr(SRAM_REGION_PAGE) + (_p) * BYTES_PER_SCREEN)
+#define ROW_MASK_BYTES    (LCD_ROW_NUM / 8)
+static unsigned char DirtyRows[IDLE_PAGE_NUM][ROW_MASK_BYTES];
+/* PROP_WIDGET_GRID the pages were composed with */
+static unsigned char ComposedGrid = 0;
+
+#define COMPOSE_LINES     8
+#define QUAD_READ_SIZE    (SRAM_READ_OVERHEAD + COMPOSE_LINES * BYTES_PER_QUAD_LINE)
+#define COMPOSE_BUF_SIZE  (QUAD_READ_SIZE * 2 + SRAM_HEADER_LEN + COMPOSE_LINES * BYTES_PER_LINE)
 ///* low 4 bits: Clock widget ID; high 4 bits: to be updated if set */
 //static unsigned char ClkWgtUpd[CLOCK_WIDGET_ID_RANGE + 1];
 
@@ -115,15 +165,29 @@ typedef struct
 
 static void AssignWidgetBuffer(Widget_t *pWidget);
 static void FreeWidgetBuffer(Widget_t *pWidget);
-static unsigned int GetAddr(WidgetHeader_t *pData);
+static unsigned int GetAddr(WidgetHeader_t *pData, unsigned int Length);
 static void GetQuadAddr(QuadAddr_t *pAddr);
 static unsigned char GetWidgetChange(unsigned char CurId, unsigned char CurOpt, unsigned char MsgId, unsigned char MsgOpt);
-static void AllocateBuffer(unsigned char *pBuf);
+static void AllocateBuffer(Widget_t *pWidget, unsigned char Quad);
+static unsigned char CleanQuad(void);
+static unsigned char TakeKept(unsigned char Index);
+static unsigned char EmptyQuad(void);
+static void ResetQuads(void);
+static void SetPlaceholder(unsigned char Tag);
+static void LoadPlaceholder(unsigned char Tag);
 
 static void WriteWidget(unsigned char Index);
 static unsigned char WidgetIndex(unsigned char Id);
+static unsigned char WidgetSlot(unsigned char Id);
+static unsigned char WidgetLayout(unsigned char Id);
+static void IndexWidgets(void);
 static void DrawHanzi(Draw_t *Info, unsigned char Index);
 
+static void FinishQuadLine(unsigned char *pData, unsigned char Row, unsigned char k,
+                           unsigned char QuadLayout, unsigned char Grid);
+static void ComposePage(QuadAddr_t *pAddr);
+static void MarkQuadRows(unsigned char Index, unsigned char Quad, unsigned char Line, unsigned char Lines);
+
 static void ConvertFaceId(WidgetList_t *pWidget);
 static unsigned char OnCurrentPage(unsigned char Layout);
 
@@ -135,10 +199,14 @@ void SetWidgetList(tMessage *pMsg)
 
   xSemaphoreTake(SramMutex, portMAX_DELAY);
 
+  /* quads can move, change or be inverted on any page */
+  memset(DirtyRows, 0xFF, sizeof(DirtyRows));
+
   WidgetList_t *pMsgWgtLst = (WidgetList_t *)pMsg->pBuffer;
   unsigned char WidgetNum = pMsg->Length / WIDGET_HEADER_LEN;
 
   unsigned char i = 0;
+  if (WGTLST_INDEX(pMsg->Options) == 0) BytesSaved = 0;
   PrintF(">SetWLst I:%d %s %d %s %d", WGTLST_INDEX(pMsg->Options), "T:", WGTLST_TOTAL(pMsg->Options), "Num:", WidgetNum);
   for(; i<WidgetNum; ++i) {PrintH(pMsgWgtLst[i].Id); PrintH(pMsgWgtLst[i].Layout);} PrintR();
 
@@ -157,7 +225,7 @@ void SetWidgetList(tMessage *pMsg)
       pCurrWidget = pCurrWidgetList;
       pNextWidget = &Widget[0] + (&Widget[MAX_WIDGET_NUM] - pCurrWidgetList);
       ClearWidgetList();
-      BufTag = 0;
+      ResetQuads();
     }
   }
 
@@ -262,12 +330,12 @@ void SetWidgetList(tMessage *pMsg)
       unsigned QuadNum = Layout[LAYOUT_TYPE(pCurrWidgetList[i].Layout)].QuadNum;
       for (k = 0; k < QuadNum; ++k)
       {
-        if (pCurrWidgetList[i].Buffers[k] == BUFFER_TAG_BITS)
-          AllocateBuffer(&pCurrWidgetList[i].Buffers[k]);
+        if (pCurrWidgetList[i].Buffers[k] == NO_QUAD)
+          AllocateBuffer(&pCurrWidgetList[i], k);
       }
     }
 
-    PrintF("Tg:%04X", BufTag);
+    PrintF("Tg:%u/%u Kp:%u Sv:%u", UsedNum, SramRegionUnits(SRAM_REGION_WIDGET), KeptNum, BytesSaved);
 
     if (ClockId != INVALID_ID)
     {
@@ -276,6 +344,8 @@ void SetWidgetList(tMessage *pMsg)
       ClockId = INVALID_ID;
     }
   }
+
+  IndexWidgets();
   xSemaphoreGive(SramMutex);
 }
 
@@ -314,44 +384,150 @@ static void AssignWidgetBuffer(Widget_t *pWidget)
   unsigned char QuadNum = Layout[LAYOUT_TYPE(pWidget->Layout)].QuadNum;
   unsigned char i;
 
-  for (i = 0; i < QuadNum; ++i) AllocateBuffer(&pWidget->Buffers[i]);
+  for (i = 0; i < QuadNum; ++i) AllocateBuffer(pWidget, i);
 }
 
-static void AllocateBuffer(unsigned char *pBuf)
+static void AllocateBuffer(Widget_t *pWidget, unsigned char Quad)
 {
+  unsigned char Part = LAYOUT_TYPE(pWidget->Layout) << 2 | Quad;
   unsigned char Tag;
-  for (Tag = 0; Tag < BUFFER_TAG_BITS; ++Tag) // go through 16 bufs
+  unsigned char i;
+
+  /* the widget's own quad from an earlier list is still drawn */
+  for (i = 0; i < KeptNum; ++i)
   {
-    if ((BufTag & (1 << Tag)) == 0) // found empty buffer
-    {
-      *pBuf = Tag;
-      BufTag |= 1 << Tag;
+    if (QuadOwner[Kept[i]] == pWidget->Id && QuadPart[Kept[i]] == Part) break;
+  }
 
-      // add "Loading..." template
-      LoadBuffer(Tag, pWidgetTemplate[TMPL_WGT_LOADING]);
-      break;
-    }
+  if (i < KeptNum)
+  {
+    Tag = TakeKept(i);
+    gAppStats.QuadsKept ++;
+  }
+  else
+  {
+    Tag = CleanQuad();
+    if (Tag == NO_QUAD && KeptNum) Tag = TakeKept(0);
+
+    // "Loading..." template is written when the quad is first shown
+    if (Tag != NO_QUAD) SetPlaceholder(Tag);
   }
 
-  if (Tag == BUFFER_TAG_BITS) *pBuf = BUFFER_TAG_BITS;
+  pWidget->Buffers[Quad] = Tag;
+  if (Tag == NO_QUAD) return;
+
+  SET_TAG(BufTag, Tag);
+  UsedNum ++;
+  QuadOwner[Tag] = pWidget->Id;
+  QuadPart[Tag] = Part;
+}
+
+/* \return first quad neither assigned nor kept, or NO_QUAD */
+static unsigned char CleanQuad(void)
+{
+  unsigned char QuadNum = SramRegionUnits(SRAM_REGION_WIDGET);
+  unsigned char Tag;
+  unsigned char w;
+
+  for (w = 0; w < TAG_WORDS; ++w)
+  {
+    unsigned int Used = BufTag[w] | KeptTag[w];
+    if (Used == 0xFFFF) continue; // all 16 taken
+
+    Tag = w << 4;
+    while ((Used & 0x0F) == 0x0F) {Used >>= 4; Tag += 4;}
+    while (Used & 1) {Used >>= 1; Tag ++;}
+
+    return Tag < QuadNum ? Tag : NO_QUAD;
+  }
+
+  return NO_QUAD;
+}
+
+/* take Kept[Index] out of the kept quads */
+static unsigned char TakeKept(unsigned char Index)
+{
+  unsigned char Tag = Kept[Index];
+
+  KeptNum --;
+  memmove(&Kept[Index], &Kept[Index + 1], KeptNum - Index);
+  CLR_TAG(KeptTag, Tag);
+
+  return Tag;
+}
+
+/* \return a free quad for the "+" template, or NO_QUAD if all are assigned */
+static unsigned char EmptyQuad(void)
+{
+  unsigned char Tag = CleanQuad();
+
+  if (Tag == NO_QUAD && KeptNum)
+  {
+    Tag = TakeKept(0);
+    SetPlaceholder(Tag);
+  }
+  return Tag;
 }
 
 static void FreeWidgetBuffer(Widget_t *pWidget)
 {
   unsigned char QuadNum = Layout[LAYOUT_TYPE(pWidget->Layout)].QuadNum;
+  unsigned char Tag;
   unsigned char i;
 
   for (i = 0; i < QuadNum; ++i)
   {
-    BufTag &= ~(1 << pWidget->Buffers[i]);
-    // add "+" template to empty buffer
-    LoadBuffer(pWidget->Buffers[i], pWidgetTemplate[TMPL_WGT_EMPTY]);
+    Tag = pWidget->Buffers[i];
+    if (Tag == NO_QUAD) continue;
+
+    CLR_TAG(BufTag, Tag);
+    UsedNum --;
+
+    // a quad never drawn gets the "+" template when it is first shown
+    if (IS_TAG(PendTag, Tag)) continue;
+
+    Kept[KeptNum ++] = Tag;
+    SET_TAG(KeptTag, Tag);
+  }
+
+  PrintF("-Tg:%u Kp:%u", UsedNum, KeptNum);
+}
+
+/* every quad free and waiting for the "+" template */
+static void ResetQuads(void)
+{
+  unsigned char QuadNum = SramRegionUnits(SRAM_REGION_WIDGET);
+  unsigned char Tag;
+
+  memset(BufTag, 0, sizeof(BufTag));
+  memset(KeptTag, 0, sizeof(KeptTag));
+  UsedNum = 0;
+  KeptNum = 0;
+
+  for (Tag = 0; Tag < QuadNum; ++Tag)
+  {
+    if (!IS_TAG(PendTag, Tag)) SetPlaceholder(Tag);
   }
+}
+
+static void SetPlaceholder(unsigned char Tag)
+{
+  /* every placeholder used to be written here, whether shown or not */
+  BytesSaved += QUAD_LOAD_BYTES;
+  SET_TAG(PendTag, Tag);
+  gAppStats.QuadLoadsSaved ++;
+}
+
+static void LoadPlaceholder(unsigned char Tag)
+{
+  if (Tag == NO_QUAD || !IS_TAG(PendTag, Tag)) return;
 
-  PrintF("-Tg:%04X", BufTag);
+  LoadBuffer(Tag, pWidgetTemplate[IS_TAG(BufTag, Tag) ? TMPL_WGT_LOADING : TMPL_WGT_EMPTY]);
+  CLR_TAG(PendTag, Tag);
+  gAppStats.QuadLoadsSaved --;
 }
 
-static void ClearWidgetList(void)
+void ClearWidgetList(void)
 {
   unsigned char i;
   for (i = 0; i < MAX_WIDGET_NUM + MAX_WIDGET_NUM; ++i)
@@ -366,11 +542,11 @@ unsigned char CreateDrawBuffer(unsigned char Id)
   if (Id > CLOCK_WIDGET_ID_RANGE && pWgtBuf ||
     (Id <= CLOCK_WIDGET_ID_RANGE && pClkBuf)) return TRUE;
 
-  unsigned char Type = LAYOUT_TYPE(pCurrWidgetList[WidgetIndex(Id)].Layout);
+  unsigned char Type = LAYOUT_TYPE(WidgetLayout(Id));
   unsigned int Size = Layout[Type].QuadNum * BYTES_PER_QUAD + SRAM_HEADER_LEN;
   if (Type == LAYOUT_VERT_SCREEN) Size += BYTES_PER_QUAD;
 
-  unsigned char *pBuffer = (unsigned char *)pvPortMalloc(Size);
+  unsigned char *pBuffer = (unsigned char *)pvPortMallocFrom(Size, HEAP_SITE_WIDGET);
   memset(pBuffer, 0, Size);
   if (Id > CLOCK_WIDGET_ID_RANGE) pWgtBuf = pBuffer;
   else pClkBuf = pBuffer;
@@ -391,17 +567,74 @@ void DrawWidgetToSram(unsigned char Id)
   pWgtBuf = NULL;
 }
 
+/* \return slot of widget Id, or of the clock Id (clock id) on the current
+ * page; NO_SLOT if there is none */
 static unsigned char WidgetIndex(unsigned char Id)
 {
-  unsigned char i = 0;
+  unsigned char *pQuad;
+  unsigned char Slot;
+  unsigned char i;
+
+  if (Id > CLOCK_WIDGET_ID_RANGE) return WidgetSlot(Id);
 
-  for (; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
+  pQuad = PageQuad[CurrentIdleScreen()];
+  for (i = 0; i < QUAD_NUM; ++i)
+  {
+    if (pQuad[i] == NO_SLOT) continue;
+
+    Slot = pQuad[i] >> 2;
+    if (IS_CLOCK_WIDGET(pCurrWidgetList[Slot].Layout) &&
+        CLOCK_ID(pCurrWidgetList[Slot].Id) == Id) return Slot;
+  }
+  return NO_SLOT;
+}
+
+/* \return slot of the widget (not a clock) Id, or NO_SLOT */
+static unsigned char WidgetSlot(unsigned char Id)
+{
+  unsigned char h;
+
+  for (h = ID_HASH(Id); IdSlot[h] != NO_SLOT; h = ID_NEXT(h))
   {
-    if (Id <= CLOCK_WIDGET_ID_RANGE && CLOCK_ID(pCurrWidgetList[i].Id) == Id ||
-     (Id > CLOCK_WIDGET_ID_RANGE && pCurrWidgetList[i].Id == Id &&
-     !IS_CLOCK_WIDGET(pCurrWidgetList[i].Layout))) break;
+    if (pCurrWidgetList[IdSlot[h]].Id == Id) return IdSlot[h];
+  }
+  return NO_SLOT;
+}
+
+/* \return layout of widget Id, quad screen if it is not in the list */
+static unsigned char WidgetLayout(unsigned char Id)
+{
+  unsigned char Slot = WidgetIndex(Id);
+  return Slot == NO_SLOT ? 0 : pCurrWidgetList[Slot].Layout;
+}
+
+static void IndexWidgets(void)
+{
+  unsigned char i, k, h;
+
+  memset(IdSlot, NO_SLOT, sizeof(IdSlot));
+  memset(PageQuad, NO_SLOT, sizeof(PageQuad));
+
+  for (i = 0; i < MAX_WIDGET_NUM && pCurrWidgetList[i].Id != INVALID_ID; ++i)
+  {
+    unsigned char WgtLayout = pCurrWidgetList[i].Layout;
+    unsigned char Type = LAYOUT_TYPE(WgtLayout);
+    unsigned char Quad = WgtLayout & QUAD_NO_MASK;
+    unsigned char *pQuad = PageQuad[(WgtLayout & IDLE_PAGE_MASK) >> IDLE_PAGE_SHFT];
+
+    if (!IS_CLOCK_WIDGET(WgtLayout))
+    {
+      for (h = ID_HASH(pCurrWidgetList[i].Id); IdSlot[h] != NO_SLOT; h = ID_NEXT(h));
+      IdSlot[h] = i;
+    }
+
+    // a later widget in the same quad is the one shown
+    for (k = 0; k < Layout[Type].QuadNum && Quad < QUAD_NUM; ++k)
+    {
+      pQuad[Quad] = i << 2 | k;
+      Quad += Layout[Type].Step;
+    }
   }
-  return i;
 }
 
 static void WriteWidget(unsigned char Index)
@@ -414,12 +647,22 @@ static void WriteWidget(unsigned char Index)
 
   for (i = 0; i < Layout[LayoutType].QuadNum; ++i)
   {
-    unsigned int Addr = pCurrWidgetList[Index].Buffers[i] * BYTES_PER_QUAD + WGT_BUF_START_ADDR;
+    unsigned char Tag = pCurrWidgetList[Index].Buffers[i];
+    unsigned int Addr = Tag * BYTES_PER_QUAD + WGT_BUF_START_ADDR;
+
+    if (Tag == NO_QUAD)
+    { // no room for this quad
+      pBuf += LayoutType == LAYOUT_VERT_SCREEN ? BYTES_PER_QUAD * 2 : BYTES_PER_QUAD;
+      continue;
+    }
+
+    CLR_TAG(PendTag, Tag); // whole quad written
+    MarkQuadRows(Index, i, 0, QUAD_ROW_NUM);
     pBuf[0] = SPI_WRITE;
     pBuf[1] = Addr >> 8;
     pBuf[2] = Addr;
     
-    Write((unsigned long)pBuf, BYTES_PER_QUAD, DMA_COPY);
+    SramWrite((unsigned long)pBuf, BYTES_PER_QUAD, DMA_COPY);
 
     pBuf += BYTES_PER_QUAD;
     if (LayoutType == LAYOUT_VERT_SCREEN) pBuf += BYTES_PER_QUAD;
@@ -440,7 +683,7 @@ void DrawBitmapToIdle(Draw_t *Info, unsigned char WidthInBytes, unsigned char co
            Info->X / HALF_SCREEN_COLS * BYTES_PER_QUAD +
            ((Info->X % HALF_SCREEN_COLS) >> 3);
 
-  unsigned char Type = LAYOUT_TYPE(pCurrWidgetList[WidgetIndex(Info->WidgetId)].Layout);
+  unsigned char Type = LAYOUT_TYPE(WidgetLayout(Info->WidgetId));
   unsigned char DrawOp = Info->Opt & DRAW_OPT_MASK;
   unsigned char ColBit = BIT0 << (Info->X & 0x07); // dst
   unsigned char MaskBit = BIT0; // src
@@ -497,29 +740,24 @@ void DrawBitmapToIdle(Draw_t *Info, unsigned char WidthInBytes, unsigned char co
 
 void DrawTemplateToIdle(Draw_t *Info)
 {
-#if __IAR_SYSTEMS_ICC__
-  const unsigned char __data20 *pTemp;
-#else
-  const unsigned char *pTemp;
-#endif
-
+  TemplateReader_t Reader;
   unsigned char *pByte = Info->WidgetId > CLOCK_WIDGET_ID_RANGE ? pWgtBuf : pClkBuf + SRAM_HEADER_LEN;
   unsigned char TempId = Info->Id & TMPL_ID_MASK;
 
-  pTemp =  ((Info->Opt & 0x0F) == TMPL_TYPE_4Q) ? pTemplate[TempId] : pTemplate2Q[TempId];
+  StartTemplate(&Reader, ((Info->Opt & 0x0F) == TMPL_TYPE_4Q) ? pTemplate[TempId] : pTemplate2Q[TempId]);
   unsigned char RowNum = ((Info->Opt & 0x0F) == TMPL_TYPE_4Q) ? LCD_ROW_NUM : HALF_SCREEN_ROWS;
 
-  unsigned char i, k;
+  unsigned char i;
 
   for (i = 0; i < RowNum; ++i)
   {
     if (i == HALF_SCREEN_ROWS) pByte += BYTES_PER_QUAD;
 
-    for (k = 0; k < BYTES_PER_QUAD_LINE; ++k) pByte[k] = pTemp[k];
-    for (k = 0; k < BYTES_PER_QUAD_LINE; ++k) pByte[k + BYTES_PER_QUAD] = pTemp[k + BYTES_PER_QUAD_LINE];
+    /* left half of the line goes to one quad, right half to the next */
+    ReadTemplate(&Reader, pByte, BYTES_PER_QUAD_LINE);
+    ReadTemplate(&Reader, pByte + BYTES_PER_QUAD, BYTES_PER_QUAD_LINE);
 
     pByte += BYTES_PER_QUAD_LINE;
-    pTemp += BYTES_PER_LINE;
   }
 }
 
@@ -578,65 +816,59 @@ static void DrawHanzi(Draw_t *Info, unsigned char Index)
 
 void WriteWidgetBuffer(tMessage *pMsg)
 {
-  unsigned int Addr = GetAddr((WidgetHeader_t *)pMsg->pBuffer);
+  unsigned int Addr = GetAddr((WidgetHeader_t *)pMsg->pBuffer, pMsg->Length - WIDGET_HEADER_LEN);
+  if (Addr == 0) return; // no quad for the row
+
   unsigned char *pBuf = pMsg->pBuffer + WIDGET_HEADER_LEN - SRAM_HEADER_LEN;
 //  PrintF("Id:%u R:%u %04X", pBuf[1], pBuf[2], Addr);
   pBuf[0] = SPI_WRITE;
   pBuf[1] = Addr >> 8;
   pBuf[2] = Addr;
 
-  Write((unsigned long)pBuf, pMsg->Length - WIDGET_HEADER_LEN, DMA_COPY);
+  SramWrite((unsigned long)pBuf, pMsg->Length - WIDGET_HEADER_LEN, DMA_COPY);
 //  PrintQ(pBuf + 3, pMsg->Length - WIDGET_HEADER_LEN);
 }
 
-static unsigned int GetAddr(WidgetHeader_t *pData)
+static unsigned int GetAddr(WidgetHeader_t *pData, unsigned int Length)
 {
-  static unsigned char i = 0;
+  unsigned char i = WidgetSlot(pData->Id);
   unsigned int Addr = 0;
 
-  if (pData->Id != pCurrWidgetList[i].Id)
+  if (i == NO_SLOT)
   {
-    for (i = 0; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
-    {
-      if (pData->Id == pCurrWidgetList[i].Id &&
-          !IS_CLOCK_WIDGET(pCurrWidgetList[i].Layout)) break;
-    }
-
-    if (pCurrWidgetList[i].Id == INVALID_ID || i == MAX_WIDGET_NUM)
-    {
-      PrintS("# wgt addr not found");
-      i = 0;
-      return Addr;
-    }
+    PrintS("# wgt addr not found");
+    return Addr;
   }
   
   //find right buffer according to row
-  Addr = pCurrWidgetList[i].Buffers[pData->Row / QUAD_ROW_NUM] * BYTES_PER_QUAD +
-         (pData->Row % QUAD_ROW_NUM) * BYTES_PER_QUAD_LINE + WGT_BUF_START_ADDR;
+  unsigned char Tag = pCurrWidgetList[i].Buffers[pData->Row / QUAD_ROW_NUM];
+  if (Tag == NO_QUAD) return Addr;
+
+  /* only some rows come in: the rest of the quad keeps "Loading..." */
+  LoadPlaceholder(Tag);
+  Addr = Tag * BYTES_PER_QUAD + (pData->Row % QUAD_ROW_NUM) * BYTES_PER_QUAD_LINE + WGT_BUF_START_ADDR;
+  MarkQuadRows(i, pData->Row / QUAD_ROW_NUM, pData->Row % QUAD_ROW_NUM,
+               (Length + BYTES_PER_QUAD_LINE - 1) / BYTES_PER_QUAD_LINE);
 
   return Addr;
 }
 
 static void GetQuadAddr(QuadAddr_t *pAddr)
 {
-  unsigned char i = 0;
-  for (; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
+  unsigned char *pQuad = PageQuad[pAddr->Page];
+  unsigned char Quad;
+
+  for (Quad = 0; Quad < QUAD_NUM; ++Quad)
   {
-    if ((pCurrWidgetList[i].Layout & IDLE_PAGE_MASK) >> IDLE_PAGE_SHFT == pAddr->Page)
-    {
-      unsigned char Type = LAYOUT_TYPE(pCurrWidgetList[i].Layout);
-      unsigned char Quad = pCurrWidgetList[i].Layout & QUAD_NO_MASK;
-      unsigned char k = 0;
-      //PrintS("W:"); PrintH(pCurrWidgetList[i].Id);
+    if (pQuad[Quad] == NO_SLOT) continue;
 
-      while (k < Layout[Type].QuadNum)
-      {
-        pAddr->Addr[Quad] = pCurrWidgetList[i].Buffers[k] * BYTES_PER_QUAD + WGT_BUF_START_ADDR;
-        pAddr->Layout[Quad] = pCurrWidgetList[i].Layout; //(pCurrWidgetList[i].Layout & LAYOUT_MASK) >> LAYOUT_SHFT;
-        Quad += Layout[Type].Step;
-        k ++;
-      }
-    }
+    Widget_t *pWidget = &pCurrWidgetList[pQuad[Quad] >> 2];
+    unsigned char Tag = pWidget->Buffers[pQuad[Quad] & QUAD_NO_MASK];
+    if (Tag == NO_QUAD) continue; // shown as an empty quad
+
+    LoadPlaceholder(Tag);
+    pAddr->Addr[Quad] = Tag * BYTES_PER_QUAD + WGT_BUF_START_ADDR;
+    pAddr->Layout[Quad] = pWidget->Layout;
   }
 }
 
@@ -650,8 +882,13 @@ void DrawWidgetToLcd(unsigned char Page)
 
   GetQuadAddr(&QuadAddr);
   
-  unsigned char i = 0;
-  while (BufTag & (1 << i)) i ++; // find out first empty buffer
+  unsigned char i = EmptyQuad();
+  if (i == NO_QUAD)
+  {
+    PrintS("# NoEmptyQuad");
+    i = 0;
+  }
+  LoadPlaceholder(i);
   unsigned int Addr = i * BYTES_PER_QUAD + WGT_BUF_START_ADDR;
   
   for (i = 0; i < QUAD_NUM; ++i)
@@ -659,8 +896,18 @@ void DrawWidgetToLcd(unsigned char Page)
    if (QuadAddr.Addr[i] == 0) QuadAddr.Addr[i] = Addr;
   }
 
+  if (Page < SramRegionUnits(SRAM_REGION_PAGE))
+  {
+    ComposePage(&QuadAddr);
+    SramToLcd(PAGE_ADDR(Page), 0, LCD_ROW_NUM);
+    return;
+  }
+
   unsigned char SramBuf[SRAM_HEADER_LEN];
-  LcdReadBuffer_t *LcdBuf = (LcdReadBuffer_t *)pvPortMalloc(LCD_READ_BUFFER_SIZE);
+  /* one line is read while the other goes to the lcd */
+  LcdReadBuffer_t *pBuf = (LcdReadBuffer_t *)pvPortMallocFrom(LCD_READ_BUFFER_SIZE * 2, HEAP_SITE_LCD_READ);
+  LcdReadBuffer_t *LcdBuf = pBuf;
+  unsigned char Grid = GetProperty(PROP_WIDGET_GRID);
   unsigned char Row = 0;
   i = 0; // 0 for upper Quads, 1 for lower Quads
 
@@ -675,76 +922,178 @@ void DrawWidgetToLcd(unsigned char Page)
       SramBuf[1] = Addr >> 8;
       SramBuf[2] = Addr;
 
-      Read(SramBuf, (unsigned char *)LcdBuf + BYTES_PER_QUAD_LINE * k, BYTES_PER_QUAD_LINE);
+      SramRead(SramBuf, (unsigned char *)LcdBuf + BYTES_PER_QUAD_LINE * k, BYTES_PER_QUAD_LINE);
+      FinishQuadLine(LcdBuf->Line.Data, Row, k, QuadAddr.Layout[i+k], Grid);
+    }  while (k--);
+
+    LcdBuf->Line.Row = Row ++; // Lcd row number starts from 1
 
-      unsigned char c; // Column byte number
-      
-      if (QuadAddr.Layout[i+k] & INVERT_BIT)
-      { // Invert pixel
-        for (c = 0; c < BYTES_PER_QUAD_LINE; ++c)
-          LcdBuf->Line.Data[c + BYTES_PER_QUAD_LINE * k] = ~LcdBuf->Line.Data[c + BYTES_PER_QUAD_LINE * k];
-      }
+    StartWriteToLcd(&LcdBuf->Line, 1);
+    LcdBuf = (LcdBuf == pBuf) ? pBuf + 1 : pBuf;
+    if (Row == HALF_SCREEN_ROWS) i += 2;
+  }
+
+  WaitForLcd();
+  vPortFree(pBuf);
+}
+
+/* invert the left (k = 0) or right half of a screen line and draw the grid
+ * over it, as the quad shown there needs */
+static void FinishQuadLine(unsigned char *pData, unsigned char Row, unsigned char k,
+                           unsigned char QuadLayout, unsigned char Grid)
+{
+  unsigned char c; // Column byte number
+
+  if (QuadLayout & INVERT_BIT)
+  { // Invert pixel
+    for (c = 0; c < BYTES_PER_QUAD_LINE; ++c)
+      pData[c + BYTES_PER_QUAD_LINE * k] = ~pData[c + BYTES_PER_QUAD_LINE * k];
+  }
+
+  if (!Grid) return;
+
+  unsigned char LayoutType = LAYOUT_TYPE(QuadLayout);
+
+  if (Row % BOARDER_PATTERN_COL == 1 || Row % BOARDER_PATTERN_COL == 2)
+  {// black dots
+    // Rule 2: left and right side vertical boarders
+//    if (k) pData[BYTES_PER_LINE - 1] |= 0x80; // right side boarder
+//    else  pData[0] |= 0x01; // left side boarder
+
+   // Rule 3 inner vertical boarders
+   if (LayoutType == 0 || LayoutType == 2)
+   {
+    if (k) pData[BYTES_PER_QUAD_LINE] |= 0x01; // right inner boarder
+    else  pData[BYTES_PER_QUAD_LINE - 1] |= 0x80; // left inner boarder
+   }
+  }
+  else
+  {// white dots
+    // Rule 2: left and right side vertical boarders
+//    if (k) pData[BYTES_PER_LINE - 1] &= 0x7F; // right side boarder
+//    else  pData[0] &= 0xFE; // left side boarder
+
+   // Rule 3 inner vertical boarders
+   if (LayoutType == 0 || LayoutType == 2)
+   {
+    if (k) pData[BYTES_PER_QUAD_LINE] &= 0xFE; // right inner boarder
+    else  pData[BYTES_PER_QUAD_LINE - 1] &= 0x7F; // left inner boarder
+   }
+  }
+
+  // Rule 4: inner horizontal boarders
+  if (LayoutType == 0 || LayoutType == 1)
+  {
+    if (Row == HALF_SCREEN_ROWS - 1 || Row == HALF_SCREEN_ROWS)
+    {
+      for (c = 0; c < BYTES_PER_QUAD_LINE; ++c)
+        pData[c + BYTES_PER_QUAD_LINE * k] = BOARDER_PATTERN_ROW;
+    }
+  }
+}
+
+/* bring the dirty rows of the composed page up to date, up to COMPOSE_LINES
+ * rows of one half at a time */
+static void ComposePage(QuadAddr_t *pAddr)
+{
+  unsigned char *pRows = DirtyRows[pAddr->Page];
+  unsigned char Grid = GetProperty(PROP_WIDGET_GRID);
+  unsigned char Row;
+
+  if (Grid != ComposedGrid)
+  {
+    memset(DirtyRows, 0xFF, sizeof(DirtyRows));
+    ComposedGrid = Grid;
+  }
+
+  for (Row = 0; Row < ROW_MASK_BYTES && pRows[Row] == 0; ++Row);
+  if (Row == ROW_MASK_BYTES) return;
+
+  /* lines of the left and right quads (read overhead first), then the
+   * composed lines after the write header */
+  unsigned char *pBuf = (unsigned char *)pvPortMallocFrom(COMPOSE_BUF_SIZE, HEAP_SITE_LCD_READ);
+  if (pBuf == NULL) return;
+
+  unsigned char *pOut = pBuf + QUAD_READ_SIZE * 2;
+  unsigned char SramBuf[SRAM_HEADER_LEN];
+  unsigned int Addr;
+
+  for (Row = 0; Row < LCD_ROW_NUM;)
+  {
+    unsigned char Lines = 0;
+
+    /* a run stops at the middle, where the quads change */
+    while (Row + Lines < LCD_ROW_NUM && Lines < COMPOSE_LINES &&
+           (Lines == 0 || Row + Lines != HALF_SCREEN_ROWS) &&
+           (pRows[(Row + Lines) >> 3] & (1 << ((Row + Lines) & 0x07)))) Lines ++;
+
+    if (Lines == 0)
+    {
+      Row ++;
+      continue;
+    }
 
-      if (GetProperty(PROP_WIDGET_GRID))
+    unsigned char Quad = Row < HALF_SCREEN_ROWS ? 0 : 2;
+    unsigned char k, j;
+
+    for (k = 0; k < 2; ++k)
+    {
+      Addr = pAddr->Addr[Quad + k] + (Row % HALF_SCREEN_ROWS) * BYTES_PER_QUAD_LINE;
+      SramBuf[0] = SPI_READ;
+      SramBuf[1] = Addr >> 8;
+      SramBuf[2] = Addr;
+      SramRead(SramBuf, pBuf + QUAD_READ_SIZE * k, Lines * BYTES_PER_QUAD_LINE);
+    }
+
+    for (j = 0; j < Lines; ++j)
+    {
+      unsigned char *pLine = pOut + SRAM_HEADER_LEN + j * BYTES_PER_LINE;
+
+      for (k = 0; k < 2; ++k)
       {
-        unsigned char LayoutType = LAYOUT_TYPE(QuadAddr.Layout[i+k]);
-
-        if (Row % BOARDER_PATTERN_COL == 1 || Row % BOARDER_PATTERN_COL == 2)
-        {// black dots
-          // Rule 2: left and right side vertical boarders
-//              if (k) LcdBuf.Line.Data[BYTES_PER_LINE - 1] |= 0x80; // right side boarder
-//              else  LcdBuf.Line.Data[0] |= 0x01; // left side boarder
-
-         // Rule 3 inner vertical boarders
-         if (LayoutType == 0 || LayoutType == 2)
-         {
-          if (k) LcdBuf->Line.Data[BYTES_PER_QUAD_LINE] |= 0x01; // right inner boarder
-          else  LcdBuf->Line.Data[BYTES_PER_QUAD_LINE - 1] |= 0x80; // left inner boarder
-         }
-        }
-        else
-        {// white dots
-          // Rule 2: left and right side vertical boarders
-//              if (k) LcdBuf.Line.Data[BYTES_PER_LINE - 1] &= 0x7F; // right side boarder
-//              else  LcdBuf.Line.Data[0] &= 0xFE; // left side boarder
-
-         // Rule 3 inner vertical boarders
-         if (LayoutType == 0 || LayoutType == 2)
-         {
-          if (k) LcdBuf->Line.Data[BYTES_PER_QUAD_LINE] &= 0xFE; // right inner boarder
-          else  LcdBuf->Line.Data[BYTES_PER_QUAD_LINE - 1] &= 0x7F; // left inner boarder
-         }
-        }
-
-        // Rule 4: inner horizontal boarders
-        if (LayoutType == 0 || LayoutType == 1)
-        {
-          if (Row == HALF_SCREEN_ROWS - 1 || Row == HALF_SCREEN_ROWS)
-          {
-            for (c = 0; c < BYTES_PER_QUAD_LINE; ++c)
-              LcdBuf->Line.Data[c + BYTES_PER_QUAD_LINE * k] = BOARDER_PATTERN_ROW;
-          }
-        }
+        memcpy(pLine + BYTES_PER_QUAD_LINE * k,
+               pBuf + QUAD_READ_SIZE * k + SRAM_READ_OVERHEAD + j * BYTES_PER_QUAD_LINE, BYTES_PER_QUAD_LINE);
+        FinishQuadLine(pLine, Row + j, k, pAddr->Layout[Quad + k], Grid);
       }
-    }  while (k--);
+      pRows[(Row + j) >> 3] &= ~(1 << ((Row + j) & 0x07));
+    }
 
-    LcdBuf->Line.Row = Row ++; // Lcd row number starts from 1
+    Addr = PAGE_ADDR(pAddr->Page) + Row * BYTES_PER_LINE;
+    pOut[0] = SPI_WRITE;
+    pOut[1] = Addr >> 8;
+    pOut[2] = Addr;
+    SramWrite((unsigned long)pOut, Lines * BYTES_PER_LINE, DMA_COPY);
 
-    WriteToLcd(&LcdBuf->Line, 1);
-    if (Row == HALF_SCREEN_ROWS) i += 2;
+    Row += Lines;
   }
 
-  vPortFree(LcdBuf);
+  vPortFree(pBuf);
+}
+
+/* Lines lines from Line on in quad Quad of a widget changed: the rows they
+ * are shown on have to be composed again */
+static void MarkQuadRows(unsigned char Index, unsigned char Quad, unsigned char Line, unsigned char Lines)
+{
+  unsigned char WgtLayout = pCurrWidgetList[Index].Layout;
+  unsigned char Page = (WgtLayout & IDLE_PAGE_MASK) >> IDLE_PAGE_SHFT;
+  unsigned char Slot = (WgtLayout & QUAD_NO_MASK) + Quad * Layout[LAYOUT_TYPE(WgtLayout)].Step;
+  unsigned char Row = (Slot >= 2 ? HALF_SCREEN_ROWS : 0) + Line;
+
+  for (; Lines && Line < QUAD_ROW_NUM; --Lines, ++Line, ++Row)
+    DirtyRows[Page][Row >> 3] |= 1 << (Row & 0x07);
 }
 
 void DrawStatusBarToWidget(void)
 {
+  unsigned char *pQuad = PageQuad[CurrentIdleScreen()];
   unsigned char i;
-  for (i = 0; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
+
+  for (i = 0; i < QUAD_NUM; ++i)
   {
-    if (OnCurrentPage(pCurrWidgetList[i].Layout) &&
-        LAYOUT_TYPE(pCurrWidgetList[i].Layout) == LAYOUT_FULL_SCREEN &&
-        !IS_CLOCK_WIDGET(pCurrWidgetList[i].Layout))
+    if (pQuad[i] == NO_SLOT) continue;
+
+    unsigned char WgtLayout = pCurrWidgetList[pQuad[i] >> 2].Layout;
+    if (LAYOUT_TYPE(WgtLayout) == LAYOUT_FULL_SCREEN && !IS_CLOCK_WIDGET(WgtLayout))
     {
       DrawStatusBarToLcd();
       break;
@@ -755,28 +1104,35 @@ void DrawStatusBarToWidget(void)
 void InitWidget(void)
 {
   ClearWidgetList();
+  IndexWidgets();
 
-  // load 16 buffers with empty widget template
-  unsigned char i = 0;
-  for (; i < MAX_WIDGET_NUM; ++i) LoadBuffer(i, pWidgetTemplate[TMPL_WGT_EMPTY]);
+  // empty widget template goes to a buffer when it is first shown
+  ResetQuads();
+  memset(DirtyRows, 0xFF, sizeof(DirtyRows));
 }
 
 /******************************************************************************/
 
 unsigned char UpdateClockWidget(void)
 {
+  unsigned char *pQuad = PageQuad[CurrentIdleScreen()];
   unsigned char Updated = FALSE;
-  unsigned char i = 0;
+  unsigned char i, k;
 
-  for (; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
+  for (i = 0; i < QUAD_NUM; ++i)
   {
-    if (!IS_CLOCK_WIDGET(pCurrWidgetList[i].Layout)) continue;
+    if (pQuad[i] == NO_SLOT) continue;
 
-    if (OnCurrentPage(pCurrWidgetList[i].Layout))
-    {
-      DrawClockWidget(pCurrWidgetList[i].Id);
-      Updated = TRUE;
-    }
+    Widget_t *pWidget = &pCurrWidgetList[pQuad[i] >> 2];
+    if (!IS_CLOCK_WIDGET(pWidget->Layout)) continue;
+
+    // each widget once, at the first of its quads shown: a later widget
+    // can cover the others
+    for (k = 0; k < i && (pQuad[k] == NO_SLOT || (pQuad[k] >> 2) != (pQuad[i] >> 2)); ++k);
+    if (k < i) continue;
+
+    DrawClockWidget(pWidget->Id);
+    Updated = TRUE;
   }
   return Updated;
 }
@@ -787,19 +1143,8 @@ void DrawClockToSram(unsigned char Id)
   unsigned char i;
 
 //  PrintF("-ClkSrm:%02X", Id);
-  for (i = 0; pCurrWidgetList[i].Id != INVALID_ID && i < MAX_WIDGET_NUM; ++i)
-  {
-    if (!IS_CLOCK_WIDGET(pCurrWidgetList[i].Layout)) continue;
-    
-    if (OnCurrentPage(pCurrWidgetList[i].Layout))
-    {
-      if (CLOCK_ID(pCurrWidgetList[i].Id) == Id)
-      {
-        WriteWidget(i);
-        break;
-      }
-    }
-  }
+  i = WidgetIndex(Id);
+  if (i != NO_SLOT) WriteWidget(i);
 
 //  PrintF("-%04X clk)", pClkBuf);
   vPortFree(pClkBuf);
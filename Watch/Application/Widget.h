@@ -23,6 +23,15 @@
 #define QUAD_ROW_NUM            (HALF_SCREEN_ROWS)
 #define HALF_SCREEN_COLS        (LCD_COL_NUM >> 1)
 #define QUAD_NUM                4
+#define IDLE_PAGE_NUM           4
+/* most quads the widget region grows to: four idle pages of four quads
+ * plus room to keep widgets that left the list (the 256 Kbit part has it,
+ * the 64 Kbit part gets what is left after the mode screens) */
+#ifndef WGT_QUAD_MAX
+#define WGT_QUAD_MAX            (24)
+#endif
+/* widget quad not assigned */
+#define NO_QUAD                 (0xFF)
 #define SRAM_HEADER_LEN         3
 #define LAYOUT_NUM              4
 #define LAYOUT_MASK             (0x0C)
@@ -0,0 +1,311 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_serial_ram.c
+*
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "hal_board_type.h"
+#include "hal_clock_control.h"
+#include "hal_miscellaneous.h"
+#include "hal_rtos_timer.h"
+#include "hal_serial_ram.h"
+#include "DebugUart.h"
+#include "LcdDriver.h"
+#include "Statistics.h"
+
+/* write and read status register */
+#define SPI_RDSR                (0x05)
+#define SPI_WRSR                (0x01)
+#define SPI_INIT_DELAY_IN_MS    (10 * portTICK_RATE_MS)
+
+/* the 256Kbit part does not have a 1 in bit position 1 */
+#define DEFAULT_SR_VALUE        (0x02)
+#define FINAL_SR_VALUE          (0x43)
+#define DEFAULT_SR_VALUE_256    (0x00)
+#define FINAL_SR_VALUE_256      (0x41)
+#define SEQUENTIAL_MODE_COMMAND (0x41)
+
+/* writes at least this long (about 120 us at 8.39 MHz) block the task
+ * instead of spinning; DMA_ISR switches back to it when the transfer is
+ * done, so a block costs two task switches. Reads always spin since not
+ * every caller holds the SMCLK user that keeps the SPI clock running in LPM */
+#define SRAM_BLOCKING_LENGTH    128
+
+/* errata - DMA variables cannot be function scope */
+static unsigned char const DummyData = 0x00;
+
+static unsigned char ReadData = 0x00;
+static unsigned char DmaBusy  = 0;
+
+/* the task waiting for the current transfer blocks on DmaDone */
+static unsigned char DmaBlocking = 0;
+static xSemaphoreHandle DmaDone = NULL;
+
+static unsigned char Header[SRAM_HEADER_LEN];
+
+/* configure the MSP430 SPI peripheral */
+void InitSramSpi(void)
+{
+  if (!DmaDone)
+  {
+    vSemaphoreCreateBinary(DmaDone);
+    xSemaphoreTake(DmaDone, 0);
+  }
+
+  /* assert reset when configuring */
+  UCA0CTL1 = UCSWRST;
+
+  SRAM_SCLK_PSEL |= SRAM_SCLK_PIN;
+  SRAM_SOMI_PSEL |= SRAM_SOMI_PIN;
+  SRAM_SIMO_PSEL |= SRAM_SIMO_PIN;
+
+  /* 3 pin SPI master, MSB first, clock inactive when low, phase is 1 */
+  UCA0CTL0 |= UCMST + UCMSB + UCCKPH + UCSYNC;
+  UCA0CTL1 |= UCSSEL__SMCLK;
+
+  /* spi clock of 8.39 MHz (chip can run at 16 MHz max)*/
+  UCA0BR0 = 0x02;
+  UCA0BR1 = 0x00;
+
+  /* release reset and wait for SPI to initialize */
+  UCA0CTL1 &= ~UCSWRST;
+  vTaskDelay(SPI_INIT_DELAY_IN_MS);
+  /*
+   * Read the status register
+   */
+  SRAM_CSN_ASSERT();
+  while (!(UCA0IFG & UCTXIFG));
+
+  /* writing automatically clears flag */
+  UCA0TXBUF = SPI_RDSR;
+  while (!(UCA0IFG&UCTXIFG));
+  UCA0TXBUF = DummyData;
+  while (!(UCA0IFG&UCTXIFG));
+  WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
+  ReadData = UCA0RXBUF;
+
+  unsigned char FinalSrValue = DEFAULT_SR_VALUE;
+  unsigned char DefaultSrValue = FINAL_SR_VALUE;
+
+  if (GetBoardConfiguration() >= 2)
+  {
+    DefaultSrValue = DEFAULT_SR_VALUE_256;
+    FinalSrValue = FINAL_SR_VALUE_256;
+  }
+
+  /* make sure correct value is read from the part */
+  if (ReadData != DefaultSrValue && ReadData != FinalSrValue) PrintS("# SRAM Init1");
+  SRAM_CSN_DEASSERT();
+
+  /* put the part into sequential mode */
+  SRAM_CSN_ASSERT();
+  UCA0TXBUF = SPI_WRSR;
+  while (!(UCA0IFG&UCTXIFG));
+  UCA0TXBUF = SEQUENTIAL_MODE_COMMAND;
+  while (!(UCA0IFG&UCTXIFG));
+  WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
+  SRAM_CSN_DEASSERT();
+
+  SRAM_CSN_ASSERT();
+  UCA0TXBUF = SPI_RDSR;
+  while (!(UCA0IFG&UCTXIFG));
+
+  UCA0TXBUF = DummyData;
+  while (!(UCA0IFG&UCTXIFG));
+  WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE();
+  ReadData = UCA0RXBUF;
+
+  /* make sure correct value is read from the part */
+  if (ReadData != FinalSrValue) PrintS("# SRAM Init2");
+  SRAM_CSN_DEASSERT();
+}
+
+static void StartWait(unsigned int Length)
+{
+  DmaBusy = 1;
+  DmaBlocking = Length >= SRAM_BLOCKING_LENGTH && DmaDone && (__get_interrupt_state() & GIE);
+}
+
+static void WaitForDma(void)
+{
+  if (DmaBlocking)
+  {
+    portTickType Start = xTaskGetTickCount();
+
+    xSemaphoreTake(DmaDone, portMAX_DELAY);
+    DmaBlocking = 0;
+
+    gAppStats.DmaWaits ++;
+    gAppStats.DmaTicksFreed += xTaskGetTickCount() - Start;
+  }
+  else while (DmaBusy);
+}
+
+void SramRead(unsigned char *pWriteData, unsigned char *pReadData, unsigned int Length)
+{
+  StartWait(0);
+  SRAM_CSN_ASSERT();
+
+  /*
+   * SPI has to write bytes to receive bytes so
+   *
+   * two DMA channels are used
+   *
+   * read requires 4 leading bytes because the shift in of the read data
+   * lags the transmit data by one byte
+   */
+
+  /* USCIA0 TXIFG is the DMA trigger for DMA0 and RXIFG is the DMA trigger
+   * for dma1 (DMACTL0 controls both)
+   */
+  DMACTL0 = DMA1TSEL_16 | DMA0TSEL_17;
+  __data16_write_addr((unsigned short)&DMA0SA, (unsigned long)pWriteData);
+  __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCA0TXBUF);
+  DMA0SZ = Length + SRAM_HEADER_LEN + 1;
+
+  /* don't enable interrupt for transmit dma done(channel 0)
+   * increment the source address because the message contains the address
+   * the other bytes are don't care
+   */
+  DMA0CTL = DMADT_0 + DMASRCINCR_3 + DMASBDB + DMALEVEL;
+
+  /* receive data is source for dma 1 */
+  __data16_write_addr((unsigned short)&DMA1SA, (unsigned long)&UCA0RXBUF);
+  __data16_write_addr((unsigned short)&DMA1DA, (unsigned long)pReadData);
+  DMA1SZ = Length + SRAM_HEADER_LEN + 1;
+
+  /* increment destination address */
+  DMA1CTL = DMADT_0 + DMADSTINCR_3 + DMASBDB + DMALEVEL + DMAIE;
+
+  /* start the transfer */
+  DMA1CTL |= DMAEN;
+  DMA0CTL |= DMAEN;
+  WaitForDma();
+  
+  SRAM_CSN_DEASSERT();
+
+  gAppStats.SramBytes += Length + SRAM_READ_OVERHEAD;
+  gAppStats.SramFrames ++;
+  gAppStats.SramTransfers ++;
+}
+
+/* send Count bytes to the selected serial ram with DMA */
+static void WriteDma(unsigned long const pData, unsigned int Count, unsigned char Op)
+{
+  EnableSmClkUser(SERIAL_RAM_USER);
+  StartWait(Count);
+
+  /* USCIA0 TXIFG is the DMA trigger */
+  DMACTL0 = DMA0TSEL_17;
+
+  __data16_write_addr((unsigned short)&DMA0SA, pData);
+  __data16_write_addr((unsigned short)&DMA0DA, (unsigned long)&UCA0TXBUF);
+
+  DMA0SZ = Count;
+
+  /*
+   * single transfer, source byte and dest byte,
+   * level sensitive, enable interrupt, clear interrupt flag
+   */
+  DMA0CTL = DMADT_0 + DMASBDB + DMALEVEL + DMAIE;
+
+  /*  increment source addres */
+  if (Op == DMA_COPY) DMA0CTL += DMASRCINCR_3;
+
+  /* start the transfer */
+  DMA0CTL |= DMAEN;
+  WaitForDma();
+
+  DisableSmClkUser(SERIAL_RAM_USER);
+
+  gAppStats.SramBytes += Count;
+  gAppStats.SramTransfers ++;
+}
+
+/* use DMA to write a block of data to the serial ram */
+void SramWrite(unsigned long const pData, unsigned int Length, unsigned char Op)
+{
+  SRAM_CSN_ASSERT();
+  WriteDma(pData, Length + SRAM_HEADER_LEN, Op);
+  SRAM_CSN_DEASSERT();
+  gAppStats.SramFrames ++;
+}
+
+void SramWriteNext(unsigned long const pData, unsigned int Length, unsigned char Op)
+{
+  WriteDma(pData, Length, Op);
+}
+
+void SramEndWrite(void)
+{
+  SRAM_CSN_DEASSERT();
+  gAppStats.SramFrames ++;
+}
+
+void SramSetAddr(unsigned int Addr)
+{
+  SRAM_CSN_ASSERT();
+
+  Header[0] = SPI_WRITE;
+  Header[1] = Addr >> 8;
+  Header[2] = Addr;
+
+  unsigned char i;
+
+  for (i = 0; i < 3; ++i)
+  {
+    UCA0TXBUF = Header[i];
+    while (!(UCA0IFG&UCTXIFG));
+    while (!(UCA0IFG&UCRXIFG));
+    Header[i] = UCA0RXBUF;
+  }
+  gAppStats.SramBytes += SRAM_HEADER_LEN;
+}
+
+/* Serial RAM controller uses two dma channels
+ * LCD driver task uses one dma channel
+ *
+ * Called by DMA_ISR (portext_s43.asm), which saves the task context first
+ * and so always leaves LPM. It switches tasks when this returns TRUE: a task
+ * blocked on a transfer runs as soon as it is done instead of on the next
+ * tick. In LPM3 the tick is off and only the idle task may run (it turns
+ * the tick back on), so there is no switch then.
+ */
+unsigned char DmaIsr(void)
+{
+  signed portBASE_TYPE HigherPriorityTaskWoken = pdFALSE;
+
+  /* 0 is no interrupt and remainder are channels 0-7 */
+  switch(__even_in_range(DMAIV,16))
+  {
+  case 0: break;
+  case 2:
+  case 4:
+    DmaBusy = 0;
+    if (DmaBlocking) xSemaphoreGiveFromISR(DmaDone, &HigherPriorityTaskWoken);
+    break;
+  case 6: HigherPriorityTaskWoken = LcdDmaIsr(); break;
+  default: break;
+  }
+
+  return HigherPriorityTaskWoken && QuerySchedulerState();
+}
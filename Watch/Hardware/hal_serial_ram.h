@@ -0,0 +1,80 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_serial_ram.h
+*
+* SPI and DMA access to the serial RAM (USCI A0, DMA channels 0 and 1).
+* SerialRam.c and Widget.c only go through these functions, so a simulated
+* serial RAM can be linked in place of hal_serial_ram.c.
+*
+* Every transfer starts with a 3 byte header: SPI_READ or SPI_WRITE and the
+* address (MSB first).
+*/
+/******************************************************************************/
+
+#ifndef HAL_SERIAL_RAM_H
+#define HAL_SERIAL_RAM_H
+
+#define SRAM_HEADER_LEN           3
+#define SRAM_READ_OVERHEAD        (SRAM_HEADER_LEN + 1)
+#define SPI_READ                (0x03)
+#define SPI_WRITE               (0x02)
+#define DMA_FILL                  1
+#define DMA_COPY                  0
+
+/*! Configure the SPI port and put the serial RAM into sequential mode */
+void InitSramSpi(void);
+
+/*! Write to the serial RAM with DMA
+ *
+ * Length + SRAM_HEADER_LEN bytes are sent from pData, which is normally the
+ * SPI_WRITE header followed by Length bytes. After SramSetAddr has sent the
+ * header they are all data.
+ *
+ * \param Op DMA_COPY or DMA_FILL to send the byte at pData every time
+ */
+void SramWrite(unsigned long const pData, unsigned int Length, unsigned char Op);
+
+/*! Read from the serial RAM with DMA
+ *
+ * \param pWriteData the SPI_READ header (the bytes after it are don't care)
+ * \param pReadData receives SRAM_READ_OVERHEAD don't care bytes (the read
+ * data lags the header by one byte) followed by Length bytes of data
+ */
+void SramRead(unsigned char *pWriteData, unsigned char *pReadData, unsigned int Length);
+
+/*! Select the serial RAM and send the SPI_WRITE header for Addr; the
+ * data follows with SramWrite, or in pieces with SramWriteNext */
+void SramSetAddr(unsigned int Addr);
+
+/*! Send the next Length data bytes after SramSetAddr and keep the serial
+ * RAM selected, so the write goes on at the following address
+ *
+ * \param Op DMA_COPY or DMA_FILL as for SramWrite
+ */
+void SramWriteNext(unsigned long const pData, unsigned int Length, unsigned char Op);
+
+/*! Deselect the serial RAM at the end of SramWriteNext pieces */
+void SramEndWrite(void);
+
+/*! DMA interrupt handler, called by DMA_ISR in portext_s43.asm
+ *
+ * \return TRUE to switch to a task the transfer has woken
+ */
+unsigned char DmaIsr(void);
+
+#endif /* HAL_SERIAL_RAM_H */
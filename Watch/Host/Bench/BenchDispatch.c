@@ -0,0 +1,217 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchDispatch.c
+ *
+ * Cost of finding the display task handler of a message, in host ns per
+ * message: the handler table LcdDisplay.c uses, and a switch over the same
+ * schema as it was before, compiled with and without jump tables (the
+ * MSP430 compilers turn a sparse switch into a compare chain). Both call
+ * one stub per schema row, so only the dispatch differs.
+ *
+ * Two traces of display queue types: all of them at random,
+ * and a phone screen update (96 WriteBufferMsg, an UpdateDisplayMsg and a
+ * button press).
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+
+#define TRACE_LENGTH            (4096)
+#define PASSES                  (256)
+#define ROUNDS                  (5)
+
+#define NOINLINE                __attribute__((noinline))
+#if defined(__GNUC__) && !defined(__clang__)
+#define NO_JUMP_TABLES          __attribute__((optimize("no-jump-tables")))
+#else
+#define NO_JUMP_TABLES
+#endif
+
+typedef void (*tHandler)(tMessage *pMsg);
+
+static unsigned long Handled;
+
+/* a stub for every row, named after the message */
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) \
+  static NOINLINE void Stub##_Name(tMessage *pMsg) { Handled += pMsg->Type; }
+#define MSG_RESERVED()
+
+#include "MessageInfo.h"
+
+#undef MSG_INFO
+#undef MSG_RESERVED
+
+/* as DisplayHandler in LcdDisplay.c */
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) Stub##_Name,
+#define MSG_RESERVED()  NULL,
+
+static tHandler const Table[MAXIMUM_MESSAGE_TYPES] =
+{
+#include "MessageInfo.h"
+};
+
+#undef MSG_INFO
+#undef MSG_RESERVED
+
+static NOINLINE void TableDispatch(tMessage *pMsg)
+{
+  if (Table[pMsg->Type]) Table[pMsg->Type](pMsg);
+}
+
+/* schema rows are in type order, so __COUNTER__ numbers the case labels
+ * from the base taken before each switch */
+#define MSG_INFO(_Name, _Queue, _Lane, _Log, _Handler) \
+  case __COUNTER__ - CASE_BASE: Stub##_Name(pMsg); break;
+#define MSG_RESERVED()  case __COUNTER__ - CASE_BASE: break;
+
+enum { SWITCH_BASE = __COUNTER__ + 1 };
+#define CASE_BASE       SWITCH_BASE
+
+static NOINLINE void SwitchDispatch(tMessage *pMsg)
+{
+  switch (pMsg->Type)
+  {
+#include "MessageInfo.h"
+  default: break;
+  }
+}
+
+enum { SWITCH_END = __COUNTER__ };
+#undef CASE_BASE
+
+enum { COMPARE_BASE = __COUNTER__ + 1 };
+#define CASE_BASE       COMPARE_BASE
+
+static NOINLINE NO_JUMP_TABLES void CompareDispatch(tMessage *pMsg)
+{
+  switch (pMsg->Type)
+  {
+#include "MessageInfo.h"
+  default: break;
+  }
+}
+
+#undef CASE_BASE
+#undef MSG_INFO
+#undef MSG_RESERVED
+
+static tMessage Trace[TRACE_LENGTH];
+
+static void RandomTrace(void)
+{
+  unsigned char Types[MAXIMUM_MESSAGE_TYPES];
+  unsigned int Num = 0;
+  unsigned long Seed = 1;
+  unsigned int i;
+
+  for (i = 0; i < MAXIMUM_MESSAGE_TYPES; ++i)
+  {
+    if (MsgInfo[i].MsgQueue == DISPLAY_QINDEX) Types[Num++] = i;
+  }
+
+  for (i = 0; i < TRACE_LENGTH; ++i)
+  {
+    Seed = Seed * 1103515245 + 12345;
+    Trace[i].Type = Types[(Seed >> 16) % Num];
+  }
+}
+
+static void ScreenTrace(void)
+{
+  unsigned int i;
+
+  for (i = 0; i < TRACE_LENGTH; ++i)
+  {
+    switch (i % 100)
+    {
+    case 96: Trace[i].Type = UpdateDisplayMsg; break;
+    case 97: Trace[i].Type = ButtonStateMsg; break;
+    case 98: Trace[i].Type = ChangeModeMsg; break;
+    case 99: Trace[i].Type = DevTypeMsg; break;
+    default: Trace[i].Type = WriteBufferMsg; break;
+    }
+  }
+}
+
+static double Now(void)
+{
+  struct timespec Time;
+
+  clock_gettime(CLOCK_MONOTONIC, &Time);
+  return Time.tv_sec * 1e9 + Time.tv_nsec;
+}
+
+/* best of ROUNDS, in ns a message */
+static double Measure(void (*pDispatch)(tMessage *pMsg), unsigned long *pHandled)
+{
+  double Best = 0;
+  unsigned int Round, Pass, i;
+
+  for (Round = 0; Round < ROUNDS; ++Round)
+  {
+    double Start = Now();
+
+    Handled = 0;
+    for (Pass = 0; Pass < PASSES; ++Pass)
+    {
+      for (i = 0; i < TRACE_LENGTH; ++i) pDispatch(&Trace[i]);
+    }
+
+    double Ns = (Now() - Start) / ((double)PASSES * TRACE_LENGTH);
+    if (Round == 0 || Ns < Best) Best = Ns;
+  }
+
+  *pHandled = Handled;
+  return Best;
+}
+
+static int Run(char const *pName)
+{
+  unsigned long TableHandled, SwitchHandled, CompareHandled;
+  double TableNs = Measure(TableDispatch, &TableHandled);
+  double SwitchNs = Measure(SwitchDispatch, &SwitchHandled);
+  double CompareNs = Measure(CompareDispatch, &CompareHandled);
+
+  printf("%-16s %8.2f %8.2f %8.2f\n", pName, TableNs, SwitchNs, CompareNs);
+
+  /* the same stubs ran */
+  return TableHandled != SwitchHandled || TableHandled != CompareHandled;
+}
+
+int main(void)
+{
+  int Result = 0;
+
+  if (SWITCH_END - SWITCH_BASE != MAXIMUM_MESSAGE_TYPES)
+  {
+    printf("schema has %d rows\n", SWITCH_END - SWITCH_BASE);
+    return 1;
+  }
+
+  printf("ns/msg              table   switch  compare\n");
+
+  RandomTrace();
+  Result |= Run("display types");
+  ScreenTrace();
+  Result |= Run("screen update");
+
+  return Result;
+}
@@ -0,0 +1,455 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchHeap.c
+ *
+ * heap_2, heap_4 and heap_tlsf on the allocations of the display task.
+ *
+ * The firmware runs on heap_4 through a session of display workloads (app
+ * screens, text, widgets, notifications) while every pvPortMalloc and
+ * vPortFree is recorded, boot included. The trace is then replayed on each
+ * heap, and so is a stress trace: the boot allocations followed by random
+ * allocations of the sizes seen in the session, up to STRESS_BLOCKS at a
+ * time, freed in random order.
+ *
+ * A replay runs in a process of its own so each heap starts empty, ROUNDS
+ * times; the time of an operation is the least of its rounds, which keeps
+ * host noise out of the worst case. After every operation the heap is
+ * walked for its fragmentation: the share of free bytes outside the
+ * largest free block.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "BitmapData.h"
+#include "Fonts.h"
+#include "Widget.h"
+#include "HostBoard.h"
+#include "BenchHeap.h"
+
+#define TRACE_SIZE              (16384)
+#define BLOCK_NUM               (256)
+#define SESSION_ROUNDS          (4)
+#define ROUNDS                  (9)
+
+#define STRESS_OPS              (8192)
+#define STRESS_BLOCKS           (96)
+
+#define WIDGET_NUM              (4)
+#define WIDGET_ID(_q)           (0x20 + (_q))
+#define WIDGET_LINES            (4)
+
+typedef struct
+{
+  unsigned short Size;          /* 0 for a free */
+  unsigned short Block;
+} tOp;
+
+/* what a replay leaves in shared memory */
+typedef struct
+{
+  unsigned long Failures;
+  double MaxFragment;
+  double SumFragment;
+  size_t MinLargest;
+  unsigned long long Ns[TRACE_SIZE];
+} tReplay;
+
+static tOp Trace[TRACE_SIZE];
+static unsigned int TraceLength;
+static unsigned int BootLength;
+
+static tOp Stress[TRACE_SIZE];
+static unsigned int StressLength;
+
+/* the recorded blocks by trace block number */
+static void *pLive[BLOCK_NUM];
+
+/******************************************************************************/
+
+extern void *__real_pvPortMalloc(size_t Size);
+extern void *__real_pvPortMallocFrom(size_t Size, unsigned char Site);
+extern void __real_vPortFree(void *pBuffer);
+
+static void RecordAlloc(void *pBuffer, size_t Size)
+{
+  unsigned short Block;
+
+  if (pBuffer == NULL || TraceLength == TRACE_SIZE) return;
+
+  for (Block = 0; Block < BLOCK_NUM && pLive[Block]; ++Block);
+  if (Block == BLOCK_NUM) return;
+
+  pLive[Block] = pBuffer;
+  Trace[TraceLength].Size = Size;
+  Trace[TraceLength].Block = Block;
+  TraceLength ++;
+}
+
+void *__wrap_pvPortMalloc(size_t Size)
+{
+  void *pBuffer = __real_pvPortMalloc(Size);
+
+  RecordAlloc(pBuffer, Size);
+  return pBuffer;
+}
+
+void *__wrap_pvPortMallocFrom(size_t Size, unsigned char Site)
+{
+  void *pBuffer = __real_pvPortMallocFrom(Size, Site);
+
+  RecordAlloc(pBuffer, Size);
+  return pBuffer;
+}
+
+/* pool buffers come here too; only heap blocks are in the trace */
+void __wrap_vPortFree(void *pBuffer)
+{
+  unsigned short Block;
+
+  for (Block = 0; Block < BLOCK_NUM; ++Block)
+  {
+    if (pBuffer && pLive[Block] == pBuffer)
+    {
+      pLive[Block] = NULL;
+      if (TraceLength < TRACE_SIZE)
+      {
+        Trace[TraceLength].Size = 0;
+        Trace[TraceLength].Block = Block;
+        TraceLength ++;
+      }
+      break;
+    }
+  }
+
+  __real_vPortFree(pBuffer);
+}
+
+/******************************************************************************/
+
+static void WriteScreen(unsigned char Mode)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    memset(Line + 1, Row ^ Mode, BYTES_PER_LINE);
+    HostSend(WriteBufferMsg, Mode, Line, sizeof(Line));
+  }
+  HostSend(UpdateDisplayMsg, Mode, NULL, 0);
+  HostWaitIdle();
+}
+
+static void DrawText(unsigned char Mode, unsigned char WidgetId, unsigned char Options)
+{
+  static char const Text[] = "Hello, host";
+  unsigned char Data[DRAW_INFO_SIZE + sizeof(Text) - 1];
+  Draw_t *pInfo = (Draw_t *)Data;
+
+  memset(Data, 0, DRAW_INFO_SIZE);
+  pInfo->Id = DRAW_ID_TYPE_TEXT | MetaWatch16;
+  pInfo->X = 4;
+  pInfo->Y = 20;
+  pInfo->Width = LCD_COL_NUM / 2 - 8;
+  pInfo->WidgetId = WidgetId;
+  pInfo->TextLen = sizeof(Text) - 1;
+  memcpy(Data + DRAW_INFO_SIZE, Text, sizeof(Text) - 1);
+
+  HostSend(DrawMsg, DRAW_MSG_BEGIN | DRAW_MSG_END | Options | Mode << 6, Data, sizeof(Data));
+  HostWaitIdle();
+}
+
+static void Widgets(void)
+{
+  unsigned char List[WIDGET_NUM * 2];
+  unsigned char Data[2 + WIDGET_LINES * BYTES_PER_QUAD_LINE];
+  unsigned char Quad, Row;
+
+  for (Quad = 0; Quad < WIDGET_NUM; ++Quad)
+  {
+    List[Quad * 2] = WIDGET_ID(Quad);
+    List[Quad * 2 + 1] = LAYOUT_QUAD_SCREEN << LAYOUT_SHFT | Quad;
+  }
+  HostSend(SetWidgetListMsg, 1 << 2, List, sizeof(List));
+
+  for (Quad = 0; Quad < WIDGET_NUM - 1; ++Quad)
+  {
+    for (Row = 0; Row < QUAD_ROW_NUM; Row += WIDGET_LINES)
+    {
+      Data[0] = WIDGET_ID(Quad);
+      Data[1] = Row;
+      memset(Data + 2, Quad * 0x11 + Row, sizeof(Data) - 2);
+      HostSend(WriteBufferMsg, MSG_OPT_NEWUI | IDLE_MODE, Data, sizeof(Data));
+    }
+  }
+  HostWaitIdle();
+
+  /* the last one is drawn by the watch */
+  DrawText(IDLE_MODE, WIDGET_ID(WIDGET_NUM - 1), DRAW_WIDGET_END);
+}
+
+static void Session(void)
+{
+  unsigned char DrawTop = 1;
+  unsigned char Round;
+
+  HostWaitIdle();
+  BootLength = TraceLength;
+
+  HostSend(ControlFullScreenMsg, 0, &DrawTop, sizeof(DrawTop));
+  HostWaitIdle();
+
+  for (Round = 0; Round < SESSION_ROUNDS; ++Round)
+  {
+    Widgets();
+    HostSend(UpdateDisplayMsg, MSG_OPT_NEWUI | IDLE_MODE, NULL, 0);
+    HostWaitIdle();
+
+    HostSend(LoadTemplateMsg, TMPL_NOTIF_MODE << 4 | NOTIF_MODE, NULL, 0);
+    HostWaitIdle();
+    WriteScreen(NOTIF_MODE);
+
+    WriteScreen(APP_MODE);
+    DrawText(APP_MODE, 0, 0);
+    HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+    HostWaitIdle();
+
+    HostSend(ChangeModeMsg, IDLE_MODE, NULL, 0);
+    HostWait(1000);
+  }
+}
+
+/******************************************************************************/
+
+/* boot as recorded, then the session's sizes freed in random order */
+static void MakeStress(void)
+{
+  unsigned short Sizes[TRACE_SIZE];
+  unsigned short Blocks[STRESS_BLOCKS];
+  unsigned char Used[BLOCK_NUM] = {0};
+  unsigned int SizeNum = 0, BlockNum = 0;
+  unsigned long Seed = 1;
+  unsigned int i;
+
+  for (i = 0; i < BootLength; ++i)
+  {
+    Stress[i] = Trace[i];
+    Used[Trace[i].Block] = Trace[i].Size != 0;
+  }
+  StressLength = BootLength;
+
+  /* each size once: the few large buffers weigh as much as the messages */
+  for (i = BootLength; i < TraceLength; ++i)
+  {
+    unsigned int j;
+
+    if (Trace[i].Size == 0) continue;
+    for (j = 0; j < SizeNum && Sizes[j] != Trace[i].Size; ++j);
+    if (j == SizeNum) Sizes[SizeNum++] = Trace[i].Size;
+  }
+
+  for (i = 0; i < STRESS_OPS; ++i)
+  {
+    tOp *pOp = &Stress[StressLength++];
+
+    Seed = Seed * 1103515245 + 12345;
+
+    if (BlockNum < STRESS_BLOCKS && (BlockNum == 0 || (Seed >> 16) & 1))
+    {
+      unsigned short Block;
+
+      for (Block = 0; Used[Block]; ++Block);
+      Used[Block] = TRUE;
+      Blocks[BlockNum++] = Block;
+
+      pOp->Size = Sizes[(Seed >> 17) % SizeNum];
+      pOp->Block = Block;
+    }
+    else
+    {
+      unsigned int Index = (Seed >> 17) % BlockNum;
+
+      pOp->Size = 0;
+      pOp->Block = Blocks[Index];
+      Used[Blocks[Index]] = FALSE;
+      Blocks[Index] = Blocks[--BlockNum];
+    }
+  }
+}
+
+/******************************************************************************/
+
+void BenchHeapSuspend(void)
+{
+}
+
+signed portBASE_TYPE BenchHeapResume(void)
+{
+  return pdFALSE;
+}
+
+void BenchHeapMallocFailed(void)
+{
+}
+
+void BenchHeapFreeFailed(unsigned char *pBuffer)
+{
+  fprintf(stderr, "free of a block not from the heap\n");
+  exit(1);
+}
+
+static unsigned long long Now(void)
+{
+  struct timespec Time;
+
+  clock_gettime(CLOCK_MONOTONIC, &Time);
+  return Time.tv_sec * 1000000000ULL + Time.tv_nsec;
+}
+
+static void Replay(tBenchHeap const *pHeap, tOp const *pOps, unsigned int Num, tReplay *pResult)
+{
+  void *pBlock[BLOCK_NUM] = {0};
+  unsigned int i;
+
+  memset(pResult, 0, sizeof(*pResult));
+  pResult->MinLargest = (size_t)-1;
+
+  for (i = 0; i < Num; ++i)
+  {
+    tOp const *pOp = &pOps[i];
+    unsigned long long Start = Now();
+
+    if (pOp->Size)
+    {
+      pBlock[pOp->Block] = pHeap->pMalloc(pOp->Size);
+      pResult->Ns[i] = Now() - Start;
+      if (pBlock[pOp->Block] == NULL) pResult->Failures ++;
+    }
+    else
+    {
+      pHeap->pFree(pBlock[pOp->Block]);
+      pResult->Ns[i] = Now() - Start;
+      pBlock[pOp->Block] = NULL;
+    }
+
+    size_t Free = pHeap->pFreeBytes();
+    size_t Largest = pHeap->pLargestFree();
+    double Fragment = Free ? 1.0 - (double)Largest / Free : 0;
+
+    if (Fragment > pResult->MaxFragment) pResult->MaxFragment = Fragment;
+    pResult->SumFragment += Fragment;
+    if (Largest < pResult->MinLargest) pResult->MinLargest = Largest;
+  }
+}
+
+static int CompareNs(void const *pA, void const *pB)
+{
+  unsigned long long A = *(unsigned long long const *)pA;
+  unsigned long long B = *(unsigned long long const *)pB;
+
+  return A < B ? -1 : A > B;
+}
+
+/* the boot allocations are replayed but not timed */
+static int Measure(char const *pTrace, tBenchHeap const *pHeap, tOp const *pOps, unsigned int Num)
+{
+  static unsigned long long Best[TRACE_SIZE];
+  tReplay *pResult = mmap(NULL, sizeof(tReplay), PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  unsigned long long *pBest = Best + BootLength;
+  unsigned int Timed = Num - BootLength;
+  unsigned long long Sum = 0;
+  unsigned int Round, i;
+  tReplay First;
+
+  if (pResult == MAP_FAILED) return 1;
+
+  for (Round = 0; Round < ROUNDS; ++Round)
+  {
+    int Status;
+    pid_t Child = fork();
+
+    if (Child == 0)
+    {
+      /* no page faults in the timing: the heaps are touched first here */
+      mlockall(MCL_CURRENT);
+      Replay(pHeap, pOps, Num, pResult);
+      _exit(0);
+    }
+
+    if (Child < 0 || waitpid(Child, &Status, 0) != Child || !WIFEXITED(Status) ||
+        WEXITSTATUS(Status) != 0) return 1;
+
+    if (Round == 0) First = *pResult;
+
+    for (i = 0; i < Num; ++i)
+    {
+      if (Round == 0 || pResult->Ns[i] < Best[i]) Best[i] = pResult->Ns[i];
+    }
+  }
+
+  for (i = 0; i < Timed; ++i) Sum += pBest[i];
+  qsort(pBest, Timed, sizeof(Best[0]), CompareNs);
+
+  printf("%-8s %-10s %6u %7llu %7llu %7llu %8lu %6.1f %6.1f %8lu\n", pTrace, pHeap->pName, Timed,
+         Sum / Timed, pBest[Timed * 99 / 100], pBest[Timed - 1], First.Failures,
+         First.SumFragment * 100 / Num, First.MaxFragment * 100,
+         (unsigned long)First.MinLargest);
+
+  munmap(pResult, sizeof(tReplay));
+  return 0;
+}
+
+int main(void)
+{
+  static tBenchHeap const *const pHeaps[] = {&Heap2, &Heap4, &HeapTlsf};
+  unsigned int i;
+  int Result;
+
+  Result = HostRun(Session);
+  if (Result) return Result;
+
+  MakeStress();
+
+  printf("trace: %u operations, %u at boot\n", TraceLength, BootLength);
+  printf("%-8s %-10s %6s %7s %7s %7s %8s %6s %6s %8s\n", "trace", "heap", "ops", "mean ns",
+         "p99 ns", "max ns", "failures", "frag %", "max %", "largest");
+
+  for (i = 0; i < sizeof(pHeaps) / sizeof(pHeaps[0]); ++i)
+  {
+    Result |= Measure("display", pHeaps[i], Trace, TraceLength);
+  }
+  for (i = 0; i < sizeof(pHeaps) / sizeof(pHeaps[0]); ++i)
+  {
+    Result |= Measure("stress", pHeaps[i], Stress, StressLength);
+  }
+
+  return Result;
+}
@@ -0,0 +1,51 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchHeap.h
+ *
+ * The FreeRTOS heaps side by side in one program: BenchHeapVariant.c is
+ * built once per heap with its functions renamed, and describes the heap
+ * with a tBenchHeap.
+ */
+/******************************************************************************/
+
+#ifndef BENCH_HEAP_H
+#define BENCH_HEAP_H
+
+#include <stddef.h>
+
+typedef struct
+{
+  char const *pName;
+  void *(*pMalloc)(size_t Size);
+  void (*pFree)(void *pBuffer);
+  /* bytes in free blocks, and in the largest of them */
+  size_t (*pFreeBytes)(void);
+  size_t (*pLargestFree)(void);
+} tBenchHeap;
+
+extern tBenchHeap const Heap2;
+extern tBenchHeap const Heap4;
+extern tBenchHeap const HeapTlsf;
+
+/* what the heaps call around their critical sections and on failure */
+void BenchHeapSuspend(void);
+signed portBASE_TYPE BenchHeapResume(void);
+void BenchHeapMallocFailed(void);
+void BenchHeapFreeFailed(unsigned char *pBuffer);
+
+#endif /* BENCH_HEAP_H */
@@ -0,0 +1,83 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchHeapVariant.c
+ *
+ * One heap of FreeRTOS/portable/MemMang under names of its own: HEAP_FILE
+ * is the heap source and HEAP_NAME the tBenchHeap describing it. The
+ * scheduler calls and the failure hooks go to the bench, which replays
+ * traces with the scheduler stopped.
+ */
+/******************************************************************************/
+
+#define HEAP_PASTE(_a, _b)            _a##_b
+#define HEAP_JOIN(_a, _b)             HEAP_PASTE(_a, _b)
+#define HEAP_LOCAL(_Name)             HEAP_JOIN(HEAP_NAME, _Name)
+
+#define pvPortMalloc                  HEAP_LOCAL(Malloc)
+#define pvPortMallocFrom              HEAP_LOCAL(MallocFrom)
+#define vPortFree                     HEAP_LOCAL(Free)
+#define vPortInitialiseBlocks         HEAP_LOCAL(InitialiseBlocks)
+#define xPortGetFreeHeapSize          HEAP_LOCAL(FreeBytes)
+#define vPortGetHeapStats             HEAP_LOCAL(GetHeapStats)
+#define vPortGetHeapSiteStats         HEAP_LOCAL(GetHeapSiteStats)
+#define vPortWalkHeap                 HEAP_LOCAL(WalkHeap)
+#define vApplicationHeapTraceHook     HEAP_LOCAL(Trace)
+#define vTaskSuspendAll               BenchHeapSuspend
+#define xTaskResumeAll                BenchHeapResume
+#define vApplicationMallocFailedHook  BenchHeapMallocFailed
+#define vApplicationFreeFailedHook    BenchHeapFreeFailed
+
+#include HEAP_FILE
+
+#include "BenchHeap.h"
+
+/* the bench heaps are not traced */
+void vApplicationHeapTraceHook(unsigned char Op, unsigned char Site, size_t Offset, size_t Size)
+{
+}
+
+#ifdef HEAP_2
+
+/* the free list is in size order, the largest block is last */
+static size_t LargestFree(void)
+{
+  xBlockLink *pxBlock = xStart.pxNextFreeBlock;
+  size_t xLargest = 0;
+
+  if (pxBlock == NULL) return configTOTAL_HEAP_SIZE;
+
+  for (; pxBlock != &xEnd; pxBlock = pxBlock->pxNextFreeBlock) xLargest = pxBlock->xBlockSize;
+  return xLargest;
+}
+
+#else
+
+static size_t LargestFree(void)
+{
+  xHeapStats Stats;
+
+  vPortGetHeapStats(&Stats);
+  return Stats.xLargestFreeBlock;
+}
+
+#endif
+
+tBenchHeap const HEAP_NAME =
+{
+  HEAP_TITLE, pvPortMalloc, vPortFree, xPortGetFreeHeapSize, LargestFree
+};
@@ -0,0 +1,390 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchPool.c
+ *
+ * Message buffers from the pool (BufferPool.c, heap_4 for the ones that do
+ * not fit or when it is empty) against every buffer from heap_4, as
+ * CreateMessage did before the pool.
+ *
+ * The traces are random, one per seed: the phone sends bursts of up to
+ * BURST_MAX messages that the display task takes off the queue in order
+ * meanwhile, most of them a row or less, a few oversize. Between messages
+ * widget draw buffers (one, two or four quads) come and go, up to
+ * DRAW_LIVE at a time, in the HEAP_LEFT bytes the heap has after boot; with
+ * the pool that is BUFFER_POOL_SIZE buffers less, the pool's RAM.
+ *
+ * Every seed is replayed in a process of its own so the pool and the heap
+ * start empty, ROUNDS times; the time of a message operation is the least
+ * of its rounds. The firmware is not booted: the critical sections of the
+ * pool cost nothing here and the heap's scheduler suspension is left out.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "BufferPool.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Widget.h"
+#include "hal_serial_ram.h"
+#include "BenchHeap.h"
+
+#define SEEDS                   (8)
+#define TRACE_OPS               (8192)
+#define ROUNDS                  (9)
+
+/* free heap after boot: tight enough for heap_4 to start failing */
+#define HEAP_LEFT               (6144)
+
+#define BURST_MAX               (96)
+#define OVERSIZE_PERCENT        (2)
+#define ROW_PERCENT             (70)
+#define DRAW_LIVE               (3)
+#define DRAW_EVERY              (64)
+
+#define QUEUE_MAX               (DISPLAY_QUEUE_LENGTH)
+#define BLOCK_NUM               (QUEUE_MAX + DRAW_LIVE)
+
+typedef struct
+{
+  unsigned short Size;          /* 0 for a free */
+  unsigned char Block;
+  unsigned char Draw;
+} tOp;
+
+/* what the replays of one allocator leave in shared memory */
+typedef struct
+{
+  unsigned long Msgs;
+  unsigned long Fallbacks;      /* pool buffers that came from the heap */
+  unsigned long MsgFailures;
+  unsigned long DrawFailures;
+  size_t MinLargest;
+  double SumFragment;
+  unsigned long long Ns[SEEDS][TRACE_OPS];
+} tResult;
+
+typedef struct
+{
+  char const *pName;
+  unsigned char Pool;
+} tAllocator;
+
+static tOp Traces[SEEDS][TRACE_OPS];
+
+static unsigned int const DrawSizes[] =
+{
+  BYTES_PER_QUAD + SRAM_HEADER_LEN,
+  2 * BYTES_PER_QUAD + SRAM_HEADER_LEN,
+  4 * BYTES_PER_QUAD + SRAM_HEADER_LEN
+};
+
+/******************************************************************************/
+
+static unsigned long Random(unsigned long *pSeed)
+{
+  *pSeed = *pSeed * 1103515245 + 12345;
+  return *pSeed >> 16;
+}
+
+static unsigned short MessageSize(unsigned long *pSeed)
+{
+  unsigned long Kind = Random(pSeed) % 100;
+  unsigned short Payload;
+
+  if (Kind < OVERSIZE_PERCENT) Payload = MSG_PAYLOAD_LENGTH + 1 + Random(pSeed) % 128;
+  else if (Kind < OVERSIZE_PERCENT + ROW_PERCENT) Payload = 1 + BYTES_PER_LINE;
+  else Payload = Random(pSeed) % (MSG_PAYLOAD_LENGTH + 1);
+
+  return Payload + MSG_OVERHEAD_LENGTH;
+}
+
+static void MakeTrace(unsigned long Seed, tOp *pOps)
+{
+  unsigned char Queue[QUEUE_MAX];
+  unsigned char Used[BLOCK_NUM] = {0};
+  unsigned char Draw[DRAW_LIVE];
+  unsigned int Head = 0, Depth = 0, DrawNum = 0, Burst = 0;
+  unsigned int i = 0;
+
+  while (i < TRACE_OPS)
+  {
+    tOp *pOp = &pOps[i];
+
+    if (Random(&Seed) % DRAW_EVERY == 0)
+    {
+      pOp->Draw = TRUE;
+
+      if (DrawNum == DRAW_LIVE)
+      {
+        pOp->Size = 0;
+        pOp->Block = Draw[0];
+        Used[Draw[0]] = FALSE;
+        memmove(Draw, Draw + 1, --DrawNum);
+      }
+      else
+      {
+        for (pOp->Block = QUEUE_MAX; Used[pOp->Block]; ++pOp->Block);
+        Used[pOp->Block] = TRUE;
+        Draw[DrawNum++] = pOp->Block;
+        pOp->Size = DrawSizes[Random(&Seed) % (sizeof(DrawSizes) / sizeof(DrawSizes[0]))];
+      }
+      i ++;
+      continue;
+    }
+
+    pOp->Draw = FALSE;
+
+    /* the display task gets a turn every few messages of a burst */
+    if (Burst && Depth < QUEUE_MAX && (Depth == 0 || Random(&Seed) % 4))
+    {
+      for (pOp->Block = 0; Used[pOp->Block]; ++pOp->Block);
+      Used[pOp->Block] = TRUE;
+      Queue[(Head + Depth++) % QUEUE_MAX] = pOp->Block;
+      pOp->Size = MessageSize(&Seed);
+      Burst --;
+    }
+    else if (Depth)
+    {
+      pOp->Size = 0;
+      pOp->Block = Queue[Head];
+      Used[Queue[Head]] = FALSE;
+      Head = (Head + 1) % QUEUE_MAX;
+      Depth --;
+    }
+    else
+    {
+      Burst = 1 + Random(&Seed) % BURST_MAX;
+      continue;
+    }
+    i ++;
+  }
+}
+
+/******************************************************************************/
+
+void BenchHeapSuspend(void)
+{
+}
+
+signed portBASE_TYPE BenchHeapResume(void)
+{
+  return pdFALSE;
+}
+
+void BenchHeapMallocFailed(void)
+{
+}
+
+void BenchHeapFreeFailed(unsigned char *pBuffer)
+{
+  fprintf(stderr, "free of a block not from the heap\n");
+  exit(1);
+}
+
+static unsigned long long Now(void)
+{
+  struct timespec Time;
+
+  clock_gettime(CLOCK_MONOTONIC, &Time);
+  return Time.tv_sec * 1000000000ULL + Time.tv_nsec;
+}
+
+/* CreateMessage and FreeMessageBuffer with and without the pool */
+static void *CreateBuffer(tAllocator const *pAlloc, unsigned short Size, tResult *pResult)
+{
+  void *pBuffer = NULL;
+
+  if (pAlloc->Pool)
+  {
+    pBuffer = GetPoolBuffer(Size);
+    if (!pBuffer && Size <= MSG_BUFFER_LENGTH) pResult->Fallbacks ++;
+  }
+
+  if (!pBuffer) pBuffer = Heap4.pMalloc(Size);
+  return pBuffer;
+}
+
+static void FreeBuffer(tAllocator const *pAlloc, void *pBuffer)
+{
+  if (!pAlloc->Pool || !ReleasePoolBuffer(pBuffer)) Heap4.pFree(pBuffer);
+}
+
+static void Replay(tAllocator const *pAlloc, unsigned int Seed, tResult *pResult)
+{
+  void *pBlock[BLOCK_NUM] = {0};
+  unsigned int i;
+
+  /* heap_4 counts its free bytes from the first allocation */
+  Heap4.pFree(Heap4.pMalloc(1));
+
+  /* what boot leaves, and the pool is taken off that */
+  size_t Boot = Heap4.pFreeBytes() - HEAP_LEFT;
+  if (pAlloc->Pool) Boot += BUFFER_POOL_SIZE * MSG_BUFFER_LENGTH;
+  Heap4.pMalloc(Boot);
+
+  for (i = 0; i < TRACE_OPS; ++i)
+  {
+    tOp const *pOp = &Traces[Seed][i];
+    unsigned long long Start = Now();
+
+    if (pOp->Draw)
+    {
+      if (pOp->Size)
+      {
+        pBlock[pOp->Block] = Heap4.pMalloc(pOp->Size);
+        if (!pBlock[pOp->Block]) pResult->DrawFailures ++;
+      }
+      else if (pBlock[pOp->Block]) Heap4.pFree(pBlock[pOp->Block]);
+      pResult->Ns[Seed][i] = 0;
+    }
+    else if (pOp->Size)
+    {
+      pBlock[pOp->Block] = CreateBuffer(pAlloc, pOp->Size, pResult);
+      pResult->Ns[Seed][i] = Now() - Start;
+      if (!pBlock[pOp->Block]) pResult->MsgFailures ++;
+      pResult->Msgs ++;
+    }
+    else
+    {
+      if (pBlock[pOp->Block]) FreeBuffer(pAlloc, pBlock[pOp->Block]);
+      pResult->Ns[Seed][i] = Now() - Start;
+    }
+
+    if (pOp->Size == 0) pBlock[pOp->Block] = NULL;
+
+    size_t Free = Heap4.pFreeBytes();
+    size_t Largest = Heap4.pLargestFree();
+
+    pResult->SumFragment += Free ? 1.0 - (double)Largest / Free : 0;
+    if (Largest < pResult->MinLargest) pResult->MinLargest = Largest;
+  }
+}
+
+static int CompareNs(void const *pA, void const *pB)
+{
+  unsigned long long A = *(unsigned long long const *)pA;
+  unsigned long long B = *(unsigned long long const *)pB;
+
+  return A < B ? -1 : A > B;
+}
+
+static int Measure(tAllocator const *pAlloc)
+{
+  static unsigned long long Best[SEEDS][TRACE_OPS];
+  static unsigned long long Timed[SEEDS * TRACE_OPS];
+  tResult *pResult = mmap(NULL, sizeof(tResult), PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  unsigned long long Sum = 0;
+  unsigned int Round, Seed, i, Num = 0;
+  tResult First;
+
+  if (pResult == MAP_FAILED) return 1;
+
+  for (Round = 0; Round < ROUNDS; ++Round)
+  {
+    memset(pResult, 0, sizeof(*pResult));
+    pResult->MinLargest = (size_t)-1;
+
+    for (Seed = 0; Seed < SEEDS; ++Seed)
+    {
+      int Status;
+      pid_t Child = fork();
+
+      if (Child == 0)
+      {
+        mlockall(MCL_CURRENT);
+        Replay(pAlloc, Seed, pResult);
+        _exit(0);
+      }
+
+      if (Child < 0 || waitpid(Child, &Status, 0) != Child || !WIFEXITED(Status) ||
+          WEXITSTATUS(Status) != 0) return 1;
+    }
+
+    if (Round == 0) First = *pResult;
+
+    for (Seed = 0; Seed < SEEDS; ++Seed)
+    {
+      for (i = 0; i < TRACE_OPS; ++i)
+      {
+        if (Round == 0 || pResult->Ns[Seed][i] < Best[Seed][i]) Best[Seed][i] = pResult->Ns[Seed][i];
+      }
+    }
+  }
+
+  /* message operations only */
+  for (Seed = 0; Seed < SEEDS; ++Seed)
+  {
+    for (i = 0; i < TRACE_OPS; ++i)
+    {
+      if (Traces[Seed][i].Draw) continue;
+      Timed[Num++] = Best[Seed][i];
+      Sum += Best[Seed][i];
+    }
+  }
+  qsort(Timed, Num, sizeof(Timed[0]), CompareNs);
+
+  printf("%-8s %6u %7llu %7llu %7llu %9lu %8lu %8lu %6.1f %8lu\n", pAlloc->pName, Num,
+         Sum / Num, Timed[Num * 99 / 100], Timed[Num - 1], First.Fallbacks,
+         First.MsgFailures, First.DrawFailures,
+         First.SumFragment * 100 / (SEEDS * TRACE_OPS), (unsigned long)First.MinLargest);
+
+  munmap(pResult, sizeof(tResult));
+  return 0;
+}
+
+int main(void)
+{
+  static tAllocator const Allocators[] = {{"heap_4", FALSE}, {"pool", TRUE}};
+  unsigned long Msgs = 0, Draws = 0;
+  unsigned int Seed, i;
+  int Result = 0;
+
+  for (Seed = 0; Seed < SEEDS; ++Seed)
+  {
+    MakeTrace(Seed + 1, Traces[Seed]);
+
+    for (i = 0; i < TRACE_OPS; ++i)
+    {
+      if (Traces[Seed][i].Size == 0) continue;
+      if (Traces[Seed][i].Draw) Draws ++;
+      else Msgs ++;
+    }
+  }
+
+  printf("%u random traces: %lu messages, %lu draw buffers, %u bytes free after boot\n",
+         SEEDS, Msgs, Draws, HEAP_LEFT);
+  printf("%-8s %6s %7s %7s %7s %9s %8s %8s %6s %8s\n", "buffers", "ops", "mean ns",
+         "p99 ns", "max ns", "fallbacks", "msg fail", "drw fail", "frag %", "largest");
+
+  for (i = 0; i < sizeof(Allocators) / sizeof(Allocators[0]); ++i)
+  {
+    Result |= Measure(&Allocators[i]);
+  }
+
+  return Result;
+}
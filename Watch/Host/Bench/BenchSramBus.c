@@ -0,0 +1,203 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchSramBus.c
+ *
+ * Serial RAM bus cost of the display paths, counted by the 23K256 model:
+ * bytes clocked (instruction and address included), data bytes, chip
+ * select frames and edges, and the bus time at 16 MCLK cycles a byte.
+ * Each workload is timed from the first message until the display task
+ * is idle again, LCD writes included in the elapsed time. The idle time
+ * is what the display task leaves to other tasks while it is blocked on a
+ * long DMA transfer.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "BitmapData.h"
+#include "Fonts.h"
+#include "Widget.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "Sram23k.h"
+#include "SharpLcd.h"
+
+#define SRAM_BYTE_CYCLES        (16)
+#define WIDGET_NUM              (4)
+#define WIDGET_ID(_q)           (0x20 + (_q))
+/* rows of a quad in one WriteBufferMsg: id, row and 4 quad lines */
+#define WIDGET_LINES            (4)
+
+static unsigned int Msgs;
+
+static void Send(unsigned char Type, unsigned char Options,
+                 unsigned char const *pData, unsigned char Length)
+{
+  HostSend(Type, Options, pData, Length);
+  Msgs ++;
+}
+
+static void Measure(char const *pName, void (*pRun)(void))
+{
+  tSram23kStats Start = Sram23kStats;
+  unsigned long long StartCycles = HostCycles;
+  unsigned long long StartIdle = HostIdleCycles;
+  unsigned long LcdBytes = SharpLcdStats.Bytes;
+
+  Msgs = 0;
+  pRun();
+  HostWaitIdle();
+
+  unsigned long Bytes = Sram23kStats.Bytes - Start.Bytes;
+
+  printf("%-20s %4u %7lu %7lu %6lu %6lu %7llu %8llu %8llu %6lu\n", pName, Msgs, Bytes,
+         Sram23kStats.DataBytes - Start.DataBytes,
+         Sram23kStats.Transactions - Start.Transactions,
+         Sram23kStats.CsToggles - Start.CsToggles,
+         HOST_CYCLES_TO_US((unsigned long long)Bytes * SRAM_BYTE_CYCLES),
+         HOST_CYCLES_TO_US(HostCycles - StartCycles),
+         HOST_CYCLES_TO_US(HostIdleCycles - StartIdle),
+         SharpLcdStats.Bytes - LcdBytes);
+}
+
+/* an RLE template decoded into the notification screen */
+static void TemplateLoad(void)
+{
+  Send(LoadTemplateMsg, TMPL_NOTIF_MODE << 4 | NOTIF_MODE, NULL, 0);
+}
+
+/* a phone template: the app screen filled black */
+static void TemplateFill(void)
+{
+  unsigned char Fill = 1;
+  Send(LoadTemplateMsg, APP_MODE, &Fill, sizeof(Fill));
+}
+
+/* a whole app screen, one row a message */
+static void WriteBuffer(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    memset(Line + 1, Row, BYTES_PER_LINE);
+    Send(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+  }
+}
+
+static void DrawText(void)
+{
+  static char const Text[] = "Hello, host";
+  unsigned char Data[DRAW_INFO_SIZE + sizeof(Text) - 1];
+  Draw_t *pInfo = (Draw_t *)Data;
+
+  memset(Data, 0, DRAW_INFO_SIZE);
+  pInfo->Id = DRAW_ID_TYPE_TEXT | MetaWatch16;
+  pInfo->X = 4;
+  pInfo->Y = 40;
+  pInfo->Width = LCD_COL_NUM;
+  pInfo->TextLen = sizeof(Text) - 1;
+  memcpy(Data + DRAW_INFO_SIZE, Text, sizeof(Text) - 1);
+
+  Send(DrawMsg, DRAW_MSG_BEGIN | DRAW_MSG_END | APP_MODE << 6, Data, sizeof(Data));
+}
+
+/* four quad widgets on idle page 0 and all of their rows */
+static void WidgetData(void)
+{
+  unsigned char List[WIDGET_NUM * 2];
+  unsigned char Data[2 + WIDGET_LINES * BYTES_PER_QUAD_LINE];
+  unsigned char Quad, Row;
+
+  for (Quad = 0; Quad < WIDGET_NUM; ++Quad)
+  {
+    List[Quad * 2] = WIDGET_ID(Quad);
+    List[Quad * 2 + 1] = LAYOUT_QUAD_SCREEN << LAYOUT_SHFT | Quad;
+  }
+  /* one part of one */
+  Send(SetWidgetListMsg, 1 << 2, List, sizeof(List));
+
+  for (Quad = 0; Quad < WIDGET_NUM; ++Quad)
+  {
+    for (Row = 0; Row < QUAD_ROW_NUM; Row += WIDGET_LINES)
+    {
+      Data[0] = WIDGET_ID(Quad);
+      Data[1] = Row;
+      memset(Data + 2, Quad * 0x11 + Row, sizeof(Data) - 2);
+      Send(WriteBufferMsg, MSG_OPT_NEWUI | IDLE_MODE, Data, sizeof(Data));
+    }
+  }
+}
+
+static void WidgetPage(void)
+{
+  Send(UpdateDisplayMsg, MSG_OPT_NEWUI | IDLE_MODE, NULL, 0);
+}
+
+/* the phone draws a notification and shows it */
+static void NotifData(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    memset(Line + 1, ~Row, BYTES_PER_LINE);
+    HostSend(WriteBufferMsg, NOTIF_MODE, Line, sizeof(Line));
+  }
+  HostWaitIdle();
+}
+
+static void NotifUpdate(void)
+{
+  Send(UpdateDisplayMsg, NOTIF_MODE, NULL, 0);
+}
+
+static void Script(void)
+{
+  unsigned char DrawTop = 1;
+
+  HostWaitIdle();
+  HostSend(ControlFullScreenMsg, 0, &DrawTop, sizeof(DrawTop));
+  HostWaitIdle();
+
+  printf("%-20s %4s %7s %7s %6s %6s %7s %8s %8s %6s\n", "workload", "msgs", "bytes",
+         "data", "frames", "cs", "bus us", "total us", "idle us", "lcd");
+
+  Measure("template load", TemplateLoad);
+  Measure("template fill", TemplateFill);
+  Measure("WriteBufferMsg x96", WriteBuffer);
+  Measure("DrawMsg text", DrawText);
+  Measure("widget data", WidgetData);
+  Measure("widget page render", WidgetPage);
+  NotifData();
+  Measure("notification update", NotifUpdate);
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
@@ -0,0 +1,159 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchWidgets.c
+ *
+ * The phone's update of a full widget list replayed for 4 and for 16 quad
+ * widgets (the most the list takes: four pages of four): the list, every row
+ * of every widget, then each page shown. The display task's cost is in
+ * host ns (HostDisplayNs) per message, the best of ROUNDS replays; with
+ * the widgets indexed by id and page quad a row or a page costs the same
+ * whatever the length of the list.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Widget.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+
+#define ROUNDS                  (5)
+
+/* MAX_WIDGET_NUM in Widget.c */
+#define LIST_MAX_NUM            (16)
+
+#define WIDGET_ID(_i)           (0x20 + (_i))
+#define WIDGET_LINES            (4)
+/* widgets in one part of a SetWidgetListMsg */
+#define LIST_PART_NUM           (8)
+
+static unsigned char WidgetNum;
+static unsigned int Msgs;
+
+static void Send(unsigned char Type, unsigned char Options,
+                 unsigned char const *pData, unsigned char Length)
+{
+  HostSend(Type, Options, pData, Length);
+  Msgs ++;
+}
+
+/* quad widgets filling the pages in turn, in parts of LIST_PART_NUM */
+static void List(void)
+{
+  unsigned char List[LIST_PART_NUM * 2];
+  unsigned char Parts = (WidgetNum + LIST_PART_NUM - 1) / LIST_PART_NUM;
+  unsigned char Part, i;
+
+  for (Part = 0; Part < Parts; ++Part)
+  {
+    for (i = 0; i < LIST_PART_NUM && Part * LIST_PART_NUM + i < WidgetNum; ++i)
+    {
+      unsigned char Widget = Part * LIST_PART_NUM + i;
+
+      List[i * 2] = WIDGET_ID(Widget);
+      List[i * 2 + 1] = (Widget / QUAD_NUM) << 4 | LAYOUT_QUAD_SCREEN << LAYOUT_SHFT |
+                        Widget % QUAD_NUM;
+    }
+    Send(SetWidgetListMsg, Parts << 2 | Part, List, i * 2);
+  }
+}
+
+static void Rows(void)
+{
+  unsigned char Data[2 + WIDGET_LINES * BYTES_PER_QUAD_LINE];
+  unsigned char Widget, Row;
+
+  for (Widget = 0; Widget < WidgetNum; ++Widget)
+  {
+    for (Row = 0; Row < QUAD_ROW_NUM; Row += WIDGET_LINES)
+    {
+      Data[0] = WIDGET_ID(Widget);
+      Data[1] = Row;
+      memset(Data + 2, Widget * 0x11 + Row, sizeof(Data) - 2);
+      Send(WriteBufferMsg, MSG_OPT_NEWUI | IDLE_MODE, Data, sizeof(Data));
+    }
+  }
+}
+
+static void Pages(void)
+{
+  unsigned char Page;
+
+  for (Page = 0; Page < (WidgetNum + QUAD_NUM - 1) / QUAD_NUM; ++Page)
+  {
+    Send(UpdateDisplayMsg, MSG_OPT_NEWUI | MSG_OPT_SET_PAGE | Page << SET_PAGE_SHFT | IDLE_MODE,
+         NULL, 0);
+    HostWaitIdle();
+  }
+}
+
+static void Measure(char const *pName, void (*pRun)(void))
+{
+  unsigned long long Best = 0;
+  unsigned long long Cycles = 0;
+  unsigned char Round;
+
+  for (Round = 0; Round < ROUNDS; ++Round)
+  {
+    unsigned long long StartNs = HostDisplayNs;
+    unsigned long long StartCycles = HostCycles;
+
+    Msgs = 0;
+    pRun();
+    HostWaitIdle();
+
+    unsigned long long Ns = HostDisplayNs - StartNs;
+    if (Round == 0 || Ns < Best) Best = Ns;
+    Cycles = HostCycles - StartCycles;
+  }
+
+  printf("%7u %-8s %5u %9llu %8llu %9llu\n", WidgetNum, pName, Msgs, Best / Msgs,
+         Best / 1000, HOST_CYCLES_TO_US(Cycles));
+}
+
+static void Script(void)
+{
+  static unsigned char const Lists[] = {QUAD_NUM, LIST_MAX_NUM};
+  unsigned char DrawTop = 1;
+  unsigned char i;
+
+  HostWaitIdle();
+  HostSend(ControlFullScreenMsg, 0, &DrawTop, sizeof(DrawTop));
+  HostWaitIdle();
+
+  printf("%7s %-8s %5s %9s %8s %9s\n", "widgets", "update", "msgs", "ns/msg", "host us",
+         "total us");
+
+  for (i = 0; i < sizeof(Lists); ++i)
+  {
+    WidgetNum = Lists[i];
+    Measure("list", List);
+    Measure("rows", Rows);
+    Measure("pages", Pages);
+  }
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
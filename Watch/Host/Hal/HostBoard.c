@@ -0,0 +1,280 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostBoard.c
+ *
+ * The parts of the board the host build does not take from Watch/Hardware:
+ * the variables the linker places at fixed addresses on the MSP430, the
+ * clock and power setup (nothing to do), the RTC and the buttons.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "hal_board_type.h"
+#include "hal_boot.h"
+#include "hal_miscellaneous.h"
+#include "hal_rtc.h"
+#include "HAL_PMM.h"
+#include "Messages.h"
+#include "LcdDisplay.h"
+#include "Log.h"
+#include "Version.h"
+#include "hal_accelerometer.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "Sram23k.h"
+#include "SharpLcd.h"
+
+/* RTCIV */
+#define RTC_PRESCALE_ZERO_IFG   8
+#define RTC_PRESCALE_ONE_IFG    10
+
+/* the MSP430 RAM; Log.c reads the state block at its fixed address */
+#define RAM_START               (0x1000)
+#define RAM_SIZE                (0x5000)
+
+/* MCLK cycles a pass through the idle loop takes without sleeping */
+#define IDLE_LOOP_CYCLES        (64)
+
+unsigned long long HostIdleCycles;
+unsigned long long HostDisplayNs;
+
+/* __no_init variables at fixed addresses on the MSP430 */
+unsigned char niResetType;
+unsigned char niResetCode;
+unsigned char niResetValue;
+char niBuild[3];
+unsigned long long niSignature;
+unsigned char niRtcMin;
+unsigned char niRtcHour;
+unsigned char niRtcDay;
+unsigned char niRtcMon;
+unsigned char niRtcDow;
+unsigned int niRtcYear;
+unsigned char niRadioReadyToSleep;
+unsigned char niDisplayQueue;
+unsigned char niWrapperQueue;
+unsigned char niWdtNum;
+unsigned char niBattery;
+unsigned char niMuxMode;
+unsigned char niProperty;
+
+/* ResetLog_t niLog[18] and LogBuffer_t niLogBuffer of Log.c */
+unsigned long long niLog[18];
+unsigned short niLogBuffer;
+
+/* main.c */
+char const VERSION[] = APP_VER;
+char const BUILD[] = BUILD_VER;
+
+unsigned char BoardType;
+
+static unsigned char RtcPs0Isr(void);
+static unsigned char RtcPs1Isr(void);
+static void RtcTick(void);
+
+extern void __real_vApplicationIdleHook(void);
+extern void RTC_ISR(void);
+extern void ButtonPortIsr(void);
+
+/******************************************************************************/
+
+unsigned char GetMsp430HardwareRevision(void)
+{
+  return 'F';
+}
+
+unsigned char Errata(void)
+{
+  return FALSE;
+}
+
+void SetupClockAndPowerManagementModule(void)
+{
+}
+
+void ConfigureDefaultIO(void)
+{
+}
+
+unsigned char GetBoardConfiguration(void)
+{
+  return BoardType;
+}
+
+unsigned int SetVCore(unsigned char Level)
+{
+  return TRUE;
+}
+
+/* no accelerometer: reads give zeros */
+void InitAccelerometerPeripheral(void)
+{
+}
+
+void AccelerometerWrite(unsigned char Addr, unsigned char* pData, unsigned char Length)
+{
+}
+
+void AccelerometerRead(unsigned char Addr, unsigned char* pData, unsigned char Length)
+{
+  memset(pData, 0, Length);
+}
+
+/* the idle loop takes time; without this a task that polls and an idle
+ * task that cannot sleep would never let time pass */
+void __wrap_vApplicationIdleHook(void)
+{
+  HostBusy(IDLE_LOOP_CYCLES);
+  __real_vApplicationIdleHook();
+}
+
+static unsigned long long HostNs(void)
+{
+  struct timespec Time;
+
+  clock_gettime(CLOCK_MONOTONIC, &Time);
+  return Time.tv_sec * 1000000000ULL + Time.tv_nsec;
+}
+
+void HostTaskSwitched(signed char const *pName, unsigned char In)
+{
+  static unsigned long long IdleSince;
+  static unsigned long long DisplaySince;
+
+  if (strcmp((char const *)pName, "IDLE") == 0)
+  {
+    if (In) IdleSince = HostCycles;
+    else HostIdleCycles += HostCycles - IdleSince;
+  }
+  else if (strcmp((char const *)pName, "DISPLAY") == 0)
+  {
+    if (In) DisplaySince = HostNs();
+    else HostDisplayNs += HostNs() - DisplaySince;
+  }
+}
+
+void __wrap_SoftwareReset(unsigned char Code, unsigned char Value)
+{
+  fprintf(stderr, "SoftwareReset: code %u value %u\n", Code, Value);
+  abort();
+}
+
+/******************************************************************************/
+
+/* prescaler 0 at 128 Hz, prescaler 1 at 1 Hz; the isr only runs while its
+ * interrupt is enabled */
+static unsigned char RtcPs0Isr(void)
+{
+  HostRaise(RtcPs0Isr, HostCycles + HOST_MCLK_HZ / 128);
+
+  if (RTCPS0CTL & RT0PSIE)
+  {
+    RTCIV = RTC_PRESCALE_ZERO_IFG;
+    RTC_ISR();
+  }
+  return FALSE;
+}
+
+static unsigned char RtcPs1Isr(void)
+{
+  HostRaise(RtcPs1Isr, HostCycles + HOST_MCLK_HZ);
+  RtcTick();
+
+  if (RTCPS1CTL & RT1PSIE)
+  {
+    RTCIV = RTC_PRESCALE_ONE_IFG;
+    RTC_ISR();
+  }
+  return FALSE;
+}
+
+static unsigned char IncBcd(volatile unsigned char *pValue, unsigned char Max)
+{
+  unsigned char Bin = BCD_H(*pValue) * 10 + BCD_L(*pValue) + 1;
+
+  if (Bin > Max) Bin = 0;
+  *pValue = ToBCD(Bin);
+  return Bin == 0;
+}
+
+/* calendar mode, BCD; days do not roll over */
+static void RtcTick(void)
+{
+  if (RTCCTL01 & RTCHOLD) return;
+
+  if (IncBcd(&RTCSEC, 59) && IncBcd(&RTCMIN, 59)) IncBcd(&RTCHOUR, 23);
+}
+
+/******************************************************************************/
+
+static unsigned char ButtonIsr(void)
+{
+  ButtonPortIsr();
+  return FALSE;
+}
+
+void HostButton(unsigned char Mask, unsigned char Pressed)
+{
+  /* the buttons pull the pins low */
+  if (Pressed) P2IN &= ~Mask;
+  else P2IN |= Mask;
+
+  /* falling edges on enabled pins interrupt */
+  if (Pressed && (P2IE & Mask))
+  {
+    P2IFG |= Mask;
+    HostRaise(ButtonIsr, HostCycles);
+    HostDeliver();
+  }
+}
+
+/******************************************************************************/
+
+unsigned char HostLcdRowIs(unsigned char Row, unsigned char const *pData)
+{
+  unsigned char Data[SHARP_LCD_LINE_BYTES];
+
+  SharpLcdReadRow(Row, Data);
+  return memcmp(Data, pData, SHARP_LCD_LINE_BYTES) == 0;
+}
+
+void HostStartBoard(void)
+{
+  if (mmap((void *)RAM_START, RAM_SIZE, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0) != (void *)RAM_START)
+  {
+    perror("HostStartBoard: mapping the MSP430 RAM");
+    exit(1);
+  }
+
+  HostResetRegisters();
+  Sram23kReset();
+  SharpLcdReset();
+
+  CheckResetType();
+
+  HostRaise(RtcPs0Isr, HOST_MCLK_HZ / 128);
+  HostRaise(RtcPs1Isr, HOST_MCLK_HZ);
+}
@@ -0,0 +1,100 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostBoard.h
+ *
+ * The watch as the host tests and benches see it: a digital gen2 board with
+ * the 23K256 serial RAM, the Sharp LCD, the RTC and the buttons simulated,
+ * and a wrapper task that stands in for the Bluetooth stack.
+ *
+ * A run boots the firmware (CreateWrapperTask, CreateDisplayTask,
+ * vTaskStartScheduler as in main.c) and runs a script in the wrapper task.
+ * The script plays the phone: it routes messages to the display task, waits
+ * simulated time, and reads what the phone would get back. The run ends
+ * with HostEnd; a process runs once.
+ */
+/******************************************************************************/
+
+#ifndef HOST_BOARD_H
+#define HOST_BOARD_H
+
+#include "Messages.h"
+
+/*! Boot the watch and run pScript in the wrapper task
+ *
+ * \return the status given to HostEnd
+ */
+int HostRun(void (*pScript)(void));
+
+/*! End the run from the script */
+void HostEnd(int Status);
+
+/*! Route a message from the phone: Length bytes of payload at pData are
+ * copied into a message buffer (none when Length is 0) */
+void HostSend(unsigned char Type, unsigned char Options,
+              unsigned char const *pData, unsigned char Length);
+
+/*! Let Ms milliseconds of simulated time pass; messages the watch sends to
+ * the wrapper meanwhile are taken off its queue and counted */
+void HostWait(unsigned int Ms);
+
+/*! Wait until the display task has handled every queued message */
+void HostWaitIdle(void);
+
+/*! Wait for the next message to the wrapper
+ *
+ * \return FALSE if none came within Ms; the message buffer is the caller's
+ * to free with FreeMessageBuffer
+ */
+unsigned char HostReceive(tMessage *pMsg, unsigned int Ms);
+
+/*! SppAckMsg options of the last credit the watch sent (0xFF: none yet) */
+extern unsigned char HostCredit;
+
+/*! messages the wrapper has received, by type */
+extern unsigned int HostWrapperMsgs[MAXIMUM_MESSAGE_TYPES];
+
+/*! MCLK cycles the idle task has had, asleep or not: the cpu time the
+ * firmware leaves free */
+extern unsigned long long HostIdleCycles;
+
+/*! host ns the display task has run: what its code costs on the build
+ * machine, which the simulated cycles (bus time only) leave out */
+extern unsigned long long HostDisplayNs;
+
+/*! gets the debug uart output when set (instead of stderr) */
+extern void (*pHostConsole)(char Out);
+
+/*! Press (TRUE) or release buttons; Mask is SW_A .. SW_F */
+void HostButton(unsigned char Mask, unsigned char Pressed);
+
+/*! Compare one LCD row with a line of firmware polarity data
+ *
+ * \return TRUE if they are the same
+ */
+unsigned char HostLcdRowIs(unsigned char Row, unsigned char const *pData);
+
+/*! Fail the run when _x is false */
+#define HOST_CHECK(_x) HostCheck((_x) != 0, #_x, __FILE__, __LINE__)
+
+void HostCheck(int Ok, char const *pExpr, char const *pFile, int Line);
+
+/* used by the host drivers */
+void HostResetRegisters(void);
+unsigned char HostLcdDmaIsr(void);
+
+#endif /* HOST_BOARD_H */
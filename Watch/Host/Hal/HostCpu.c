@@ -0,0 +1,216 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostCpu.c
+ *
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "HostCpu.h"
+
+#define EVENT_NUM     16
+#define DEVICE_NUM    4
+
+typedef struct
+{
+  unsigned long long At;
+  tHostIsr Isr;
+} tEvent;
+
+unsigned long long HostCycles;
+unsigned long long HostSleepCycles;
+
+/* sorted by time, then by the order they were raised in */
+static tEvent Events[EVENT_NUM];
+static unsigned char EventNum;
+
+static tHostDevice Devices[DEVICE_NUM];
+static unsigned char DeviceNum;
+
+static unsigned short Sr;
+static unsigned char InIsr;
+static unsigned char ExitLpm;
+
+static void RunIsr(tHostIsr Isr);
+static void MoveTo(unsigned long long At);
+
+void HostAddDevice(tHostDevice Device)
+{
+  if (DeviceNum == DEVICE_NUM)
+  {
+    fprintf(stderr, "HostAddDevice: too many devices\n");
+    abort();
+  }
+  Devices[DeviceNum++] = Device;
+}
+
+static void MoveTo(unsigned long long At)
+{
+  unsigned char i;
+
+  HostCycles = At;
+  for (i = 0; i < DeviceNum; ++i) Devices[i]();
+}
+
+void HostRaise(tHostIsr Isr, unsigned long long At)
+{
+  unsigned char i;
+
+  HostCancel(Isr);
+  if (EventNum == EVENT_NUM)
+  {
+    fprintf(stderr, "HostRaise: too many pending isrs\n");
+    abort();
+  }
+
+  for (i = EventNum; i && Events[i - 1].At > At; --i) Events[i] = Events[i - 1];
+  Events[i].At = At;
+  Events[i].Isr = Isr;
+  EventNum ++;
+}
+
+void HostCancel(tHostIsr Isr)
+{
+  unsigned char i, k;
+
+  for (i = 0, k = 0; i < EventNum; ++i)
+    if (Events[i].Isr != Isr) Events[k++] = Events[i];
+
+  EventNum = k;
+}
+
+void HostDeliver(void)
+{
+  while ((Sr & GIE) && !InIsr && EventNum && Events[0].At <= HostCycles)
+  {
+    tHostIsr Isr = Events[0].Isr;
+    HostCancel(Isr);
+    RunIsr(Isr);
+  }
+}
+
+static void RunIsr(tHostIsr Isr)
+{
+  unsigned short Saved = Sr;
+
+  /* the cpu clears GIE on entry and reti restores the SR */
+  Sr &= ~GIE;
+  InIsr = 1;
+  unsigned char Switch = Isr();
+  InIsr = 0;
+  Sr = Saved;
+
+  /* a context switch from an isr (portSAVE_CONTEXT) clears the low power
+   * bits of the interrupted task */
+  if (Switch)
+  {
+    ExitLpm = 1;
+    vPortYieldFromIsr();
+  }
+}
+
+void HostBusy(unsigned long Cycles)
+{
+  unsigned long long End = HostCycles + Cycles;
+
+  for (;;)
+  {
+    HostDeliver();
+    if (HostCycles >= End) break;
+
+    if ((Sr & GIE) && !InIsr && EventNum && Events[0].At < End)
+    {
+      if (Events[0].At > HostCycles) MoveTo(Events[0].At);
+    }
+    else MoveTo(End);
+  }
+}
+
+void HostSleep(void)
+{
+  ExitLpm = 0;
+  Sr |= GIE;
+
+  while (!ExitLpm)
+  {
+    if (!EventNum)
+    {
+      fprintf(stderr, "HostSleep: no isr left to wake up the cpu\n");
+      abort();
+    }
+
+    if (Events[0].At > HostCycles)
+    {
+      HostSleepCycles += Events[0].At - HostCycles;
+      MoveTo(Events[0].At);
+    }
+    HostDeliver();
+  }
+}
+
+unsigned short __get_interrupt_state(void)
+{
+  return Sr;
+}
+
+void __set_interrupt_state(unsigned short State)
+{
+  Sr = State;
+  HostDeliver();
+}
+
+void __disable_interrupt(void)
+{
+  Sr &= ~GIE;
+}
+
+void __enable_interrupt(void)
+{
+  Sr |= GIE;
+  HostDeliver();
+}
+
+void __delay_cycles(unsigned long Cycles)
+{
+  HostBusy(Cycles);
+}
+
+void __bis_SR_register(unsigned short Bits)
+{
+  if (Bits & CPUOFF) HostSleep();
+  else if (Bits & GIE) __enable_interrupt();
+}
+
+void __bic_SR_register(unsigned short Bits)
+{
+  if (Bits & GIE) __disable_interrupt();
+}
+
+void __bic_SR_register_on_exit(unsigned short Bits)
+{
+  if (Bits & CPUOFF) ExitLpm = 1;
+}
+
+void __low_power_mode_4(void)
+{
+  fprintf(stderr, "LPM4 (shipping mode) entered\n");
+  exit(1);
+}
@@ -0,0 +1,84 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostCpu.h
+ *
+ * Simulated time and interrupts of the host build.
+ *
+ * Time is counted in MCLK cycles (16.777216 MHz). It only moves when a
+ * device model charges a transfer, when the cpu busy waits (HostBusy,
+ * __delay_cycles) or when the idle task sleeps (HostSleep). The C code in
+ * between takes no simulated time.
+ *
+ * A DMA channel is a device: it moves the bytes that are due whenever time
+ * moves, reading memory then, so a buffer changed under a running transfer
+ * goes out changed as it would on the MSP430.
+ *
+ * An interrupt is an isr function raised for a point in time. It runs once
+ * time has reached that point and GIE is set, with GIE clear while it runs,
+ * like on the MSP430. When the isr returns TRUE the scheduler switches to
+ * the highest priority ready task right after it (what vTickISR does).
+ */
+/******************************************************************************/
+
+#ifndef HOST_CPU_H
+#define HOST_CPU_H
+
+#define HOST_MCLK_HZ          (16777216UL)
+
+/*! MCLK cycles per ACLK (32768 Hz) cycle */
+#define HOST_ACLK_CYCLES      (HOST_MCLK_HZ / 32768)
+
+/*! MCLK cycles per RTOS tick */
+#define HOST_TICK_CYCLES      (HOST_MCLK_HZ / configTICK_RATE_HZ)
+
+#define HOST_CYCLES_TO_US(_c) ((_c) * 1000000ULL / HOST_MCLK_HZ)
+#define HOST_US_TO_CYCLES(_u) ((unsigned long long)(_u) * HOST_MCLK_HZ / 1000000ULL)
+
+/*! \return TRUE to switch tasks when the isr returns */
+typedef unsigned char (*tHostIsr)(void);
+
+/*! Moves the data of a peripheral (a DMA channel) up to HostCycles */
+typedef void (*tHostDevice)(void);
+
+/*! MCLK cycles since power up */
+extern unsigned long long HostCycles;
+
+/*! part of HostCycles spent in low power mode */
+extern unsigned long long HostSleepCycles;
+
+/*! Raise Isr at cycle At (at once when At has passed). An isr is pending
+ * at most once; raising it again moves it. */
+void HostRaise(tHostIsr Isr, unsigned long long At);
+
+/*! Take back a raised isr that has not run yet */
+void HostCancel(tHostIsr Isr);
+
+/*! The cpu is busy for Cycles; isrs due meanwhile run if GIE is set */
+void HostBusy(unsigned long Cycles);
+
+/*! Low power mode: time jumps to the next isr until one of them clears
+ * the low power bits (EXIT_LPM_ISR) */
+void HostSleep(void);
+
+/*! Call Device every time time moves, before the isrs due then run */
+void HostAddDevice(tHostDevice Device);
+
+/*! Run the isrs that are due, if GIE is set */
+void HostDeliver(void);
+
+#endif /* HOST_CPU_H */
@@ -0,0 +1,193 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdDriver.c
+*
+* Host build: Watch/Application/LcdDriver.c over the Sharp LCD model. The
+* command byte and the trailer are sent by the cpu, the lines by the DMA
+* (128 MCLK cycles a byte at 1 MHz); the wait for the DMA follows the same
+* rules as on the MSP430.
+*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "hal_board_type.h"
+#include "hal_clock_control.h"
+#include "DebugUart.h"
+#include "LcdDriver.h"
+#include "LcdDisplay.h"
+#include "Property.h"
+#include "Statistics.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "SharpLcd.h"
+
+#define LCD_STATIC_CMD      0x00
+#define LCD_WRITE_CMD       0x01
+#define LCD_CLEAR_CMD       0x04
+
+#define FIRST_LCD_LINE_OFFSET  1
+
+/* as in the MSP430 driver */
+#define LCD_BLOCKING_LENGTH    64
+
+/* SMCLK / 16, 8 bits */
+#define LCD_BYTE_CYCLES        (128)
+
+static unsigned char LcdDmaBusy = 0;
+static unsigned char LcdWriting = 0;
+static unsigned char LcdDmaBlocking = 0;
+static xSemaphoreHandle LcdDmaDone = NULL;
+
+/* DMA2: bytes of the current write clocked out so far */
+static unsigned char const *pDmaSource;
+static unsigned int DmaSize;
+static unsigned int DmaSent;
+static unsigned long long DmaStart;
+
+static void StartWrite(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size);
+static void MoveDma(void);
+
+static void Send(unsigned char Out)
+{
+  HostBusy(LCD_BYTE_CYCLES);
+  SharpLcdTransfer(Out, HostCycles);
+}
+
+void LcdPeripheralInit(void)
+{
+  if (!LcdDmaDone)
+  {
+    vSemaphoreCreateBinary(LcdDmaDone);
+    xSemaphoreTake(LcdDmaDone, 0);
+    HostAddDevice(MoveDma);
+  }
+}
+
+/* the DMA clocks each byte out LCD_BYTE_CYCLES after the previous one */
+static void MoveDma(void)
+{
+  while (DmaSent < DmaSize && DmaStart + (DmaSent + 1ULL) * LCD_BYTE_CYCLES <= HostCycles)
+  {
+    DmaSent ++;
+    SharpLcdTransfer(pDmaSource[DmaSent - 1], DmaStart + DmaSent * (unsigned long long)LCD_BYTE_CYCLES);
+  }
+}
+
+void WriteToLcd(tLcdLine *pData, unsigned char LineNum)
+{
+  StartWriteToLcd(pData, LineNum);
+  WaitForLcd();
+}
+
+void StartWriteToLcd(tLcdLine *pData, unsigned char LineNum)
+{
+  WaitForLcd();
+
+  /* flip bits */
+  if (!GetProperty(PROP_INVERT_DISPLAY))
+  {
+    unsigned char i, k;
+    for (i = 0; i < LineNum; ++i)
+    {
+      pData[i].Row += FIRST_LCD_LINE_OFFSET;
+      for (k = 0; k < BYTES_PER_LINE; ++k)
+        pData[i].Data[k] = ~(pData[i].Data[k]);
+    }
+  }
+
+  StartWrite(LCD_WRITE_CMD, (unsigned char *)pData, sizeof(tLcdLine) * LineNum);
+}
+
+static void StartWrite(unsigned char Cmd, unsigned char *pBuffer, unsigned int Size)
+{
+  EnableSmClkUser(LCD_USER);
+  LcdWriting = 1;
+  SharpLcdSelect();
+
+  LcdDmaBusy = 1;
+  LcdDmaBlocking = Size >= LCD_BLOCKING_LENGTH && LcdDmaDone && (__get_interrupt_state() & GIE);
+
+  Send(Cmd);
+
+  pDmaSource = pBuffer;
+  DmaSize = Size;
+  DmaSent = 0;
+  DmaStart = HostCycles;
+
+  HostRaise(HostLcdDmaIsr, HostCycles + (unsigned long long)Size * LCD_BYTE_CYCLES);
+}
+
+void WaitForLcd(void)
+{
+  if (!LcdWriting) return;
+  LcdWriting = 0;
+
+  if (LcdDmaBlocking)
+  {
+    portTickType Start = xTaskGetTickCount();
+
+    xSemaphoreTake(LcdDmaDone, portMAX_DELAY);
+    LcdDmaBlocking = 0;
+
+    gAppStats.DmaWaits ++;
+    gAppStats.DmaTicksFreed += xTaskGetTickCount() - Start;
+  }
+  else while (LcdDmaBusy)
+  {
+    if (!(__get_interrupt_state() & GIE))
+    {
+      fprintf(stderr, "LcdDriver: waiting for the DMA with interrupts disabled\n");
+      abort();
+    }
+    HostBusy(LCD_BYTE_CYCLES);
+  }
+
+  Send(0x00);
+  Send(LCD_STATIC_CMD);
+  Send(0x00);
+
+  SharpLcdDeselect();
+  DisableSmClkUser(LCD_USER);
+}
+
+void ClearLcd(void)
+{
+  WaitForLcd();
+  EnableSmClkUser(LCD_USER);
+  SharpLcdSelect();
+
+  Send(LCD_CLEAR_CMD);
+  Send(0x00);
+
+  SharpLcdDeselect();
+  DisableSmClkUser(LCD_USER);
+}
+
+unsigned char LcdDmaIsr(void)
+{
+  signed portBASE_TYPE HigherPriorityTaskWoken = pdFALSE;
+
+  LcdDmaBusy = 0;
+  if (LcdDmaBlocking) xSemaphoreGiveFromISR(LcdDmaDone, &HigherPriorityTaskWoken);
+
+  return HigherPriorityTaskWoken;
+}
@@ -0,0 +1,62 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Registers.c
+ *
+ * The register variables of the host msp430.h and their power up values.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HOST_REGISTER_DEFINE
+#include <msp430.h>
+#include "HostBoard.h"
+
+/* ADC12MEM0 reads the hardware configuration divider: 154 counts is board
+ * configuration 2 (23K256 serial RAM); ADC12MEM1 is a 4 V battery */
+#define BOARD_CONFIG_COUNTS     154
+#define BATTERY_COUNTS          2543
+
+/* set HOST_CONSOLE to see the debug uart on stderr */
+static signed char Console = -1;
+
+void (*pHostConsole)(char Out);
+
+volatile unsigned char *HostUsciIfg(volatile unsigned char *pIfg)
+{
+  if (pIfg == &HostUCA3IFG && UCA3TXBUF)
+  {
+    if (Console < 0) Console = getenv("HOST_CONSOLE") != NULL;
+    if (pHostConsole) pHostConsole(UCA3TXBUF);
+    else if (Console) fputc(UCA3TXBUF, stderr);
+    UCA3TXBUF = 0;
+  }
+
+  *pIfg |= UCTXIFG | UCRXIFG;
+  return pIfg;
+}
+
+void HostResetRegisters(void)
+{
+  ADC12MEM0 = BOARD_CONFIG_COUNTS;
+  ADC12MEM1 = BATTERY_COUNTS;
+
+  /* buttons are pulled up (not pressed) */
+  P2IN = 0xFF;
+}
@@ -0,0 +1,145 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file SharpLcd.c
+ *
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SharpLcd.h"
+
+#define MODE_WRITE    (0x01)
+#define MODE_CLEAR    (0x04)
+
+typedef enum
+{
+  Deselected,
+  Mode,
+  Address,
+  Data,
+  Dummy,
+  Done
+} eState;
+
+unsigned char SharpLcdMemory[SHARP_LCD_ROWS][SHARP_LCD_LINE_BYTES];
+unsigned long long SharpLcdLineAt[SHARP_LCD_ROWS];
+tSharpLcdStats SharpLcdStats;
+void (*pSharpLcdLine)(unsigned char Row, unsigned long long At);
+
+static eState State = Deselected;
+static unsigned char Row;
+static unsigned char Index;
+
+void SharpLcdReset(void)
+{
+  State = Deselected;
+  memset(SharpLcdMemory, 0xFF, sizeof(SharpLcdMemory));
+  memset(SharpLcdLineAt, 0, sizeof(SharpLcdLineAt));
+  memset(&SharpLcdStats, 0, sizeof(SharpLcdStats));
+}
+
+void SharpLcdSelect(void)
+{
+  if (State != Deselected)
+  {
+    fprintf(stderr, "SharpLcd: selected twice\n");
+    abort();
+  }
+
+  State = Mode;
+  SharpLcdStats.Frames ++;
+}
+
+void SharpLcdDeselect(void)
+{
+  if (State == Address || State == Data)
+  {
+    fprintf(stderr, "SharpLcd: deselected inside line %u\n", Row + 1);
+    abort();
+  }
+
+  State = Deselected;
+}
+
+void SharpLcdTransfer(unsigned char In, unsigned long long At)
+{
+  SharpLcdStats.Bytes ++;
+
+  switch (State)
+  {
+  case Deselected:
+    fprintf(stderr, "SharpLcd: clocked while deselected\n");
+    abort();
+
+  case Mode:
+    if (In & MODE_CLEAR)
+    {
+      memset(SharpLcdMemory, 0xFF, sizeof(SharpLcdMemory));
+      SharpLcdStats.Clears ++;
+      State = Done;
+    }
+    else State = (In & MODE_WRITE) ? Address : Done;
+    break;
+
+  case Address:
+    /* the dummy byte that ends a write */
+    if (In == 0)
+    {
+      State = Done;
+      break;
+    }
+
+    if (In > SHARP_LCD_ROWS)
+    {
+      fprintf(stderr, "SharpLcd: line %u\n", In);
+      abort();
+    }
+
+    Row = In - 1;
+    Index = 0;
+    State = Data;
+    break;
+
+  case Data:
+    SharpLcdMemory[Row][Index++] = In;
+    if (Index == SHARP_LCD_LINE_BYTES)
+    {
+      SharpLcdLineAt[Row] = At;
+      SharpLcdStats.Lines ++;
+      if (pSharpLcdLine) pSharpLcdLine(Row, At);
+      State = Dummy;
+    }
+    break;
+
+  case Dummy:
+    State = Address;
+    break;
+
+  default:
+    break;
+  }
+}
+
+void SharpLcdReadRow(unsigned char Row, unsigned char *pData)
+{
+  unsigned char i;
+
+  for (i = 0; i < SHARP_LCD_LINE_BYTES; ++i) pData[i] = ~SharpLcdMemory[Row][i];
+}
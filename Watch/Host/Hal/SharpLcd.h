@@ -0,0 +1,80 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file SharpLcd.h
+ *
+ * Model of the Sharp LS013B4DN04 memory LCD (96 x 96) as seen on its SPI
+ * pins. Chip select is active high and bytes go LSB first.
+ *
+ * A frame starts with a mode byte: M0 (0x01) writes lines, M2 (0x04)
+ * clears the memory, 0x00 only toggles VCOM. A line is its address (1 to
+ * 96), 12 data bytes and a dummy byte; a second dummy byte (address 0) ends
+ * the write. A zero bit is a dark pixel.
+ *
+ * The model keeps the pixel memory and the cycle each line was last
+ * written at, so a test can check what is on the glass and when it got
+ * there.
+ */
+/******************************************************************************/
+
+#ifndef SHARP_LCD_H
+#define SHARP_LCD_H
+
+#define SHARP_LCD_ROWS          (96)
+#define SHARP_LCD_LINE_BYTES    (12)
+
+typedef struct
+{
+  unsigned long Bytes;
+  unsigned long Frames;         /* chip select asserted */
+  unsigned long Lines;          /* lines written */
+  unsigned long Clears;
+} tSharpLcdStats;
+
+/*! pixel memory as sent: a zero bit is dark */
+extern unsigned char SharpLcdMemory[SHARP_LCD_ROWS][SHARP_LCD_LINE_BYTES];
+
+/*! cycle the last byte of each line was clocked in (0: never written) */
+extern unsigned long long SharpLcdLineAt[SHARP_LCD_ROWS];
+
+extern tSharpLcdStats SharpLcdStats;
+
+/*! called with each line written when set, so a test can see lines that
+ * are written over before it looks */
+extern void (*pSharpLcdLine)(unsigned char Row, unsigned long long At);
+
+/*! power up: memory white, statistics cleared */
+void SharpLcdReset(void);
+
+void SharpLcdSelect(void);
+void SharpLcdDeselect(void);
+
+/*! Clock one byte into the display
+ *
+ * \param In the byte on SI
+ * \param At the cycle its last bit is clocked
+ */
+void SharpLcdTransfer(unsigned char In, unsigned long long At);
+
+/*! Copy one row out in the polarity of the firmware buffers (a one bit is
+ * dark, as in LcdBuffer and the serial RAM)
+ *
+ * \param Row 0 to 95
+ */
+void SharpLcdReadRow(unsigned char Row, unsigned char *pData);
+
+#endif /* SHARP_LCD_H */
@@ -0,0 +1,170 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Sram23k.c
+ *
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Sram23k.h"
+
+#define CMD_READ      (0x03)
+#define CMD_WRITE     (0x02)
+#define CMD_RDSR      (0x05)
+#define CMD_WRSR      (0x01)
+
+/* where the current instruction is */
+typedef enum
+{
+  Deselected,
+  Command,
+  AddrHigh,
+  AddrLow,
+  Data,
+  ReadStatus,
+  WriteStatus,
+  Done
+} eState;
+
+unsigned char Sram23kArray[SRAM_23K_SIZE];
+tSram23kStats Sram23kStats;
+
+static eState State = Deselected;
+static unsigned char Cmd;
+static unsigned int Addr;
+static unsigned char Status = SRAM_23K_MODE_BYTE;
+
+void Sram23kReset(void)
+{
+  State = Deselected;
+  Status = SRAM_23K_MODE_BYTE;
+  memset(&Sram23kStats, 0, sizeof(Sram23kStats));
+}
+
+void Sram23kSelect(void)
+{
+  /* already low */
+  if (State != Deselected) return;
+
+  State = Command;
+  Sram23kStats.Transactions ++;
+  Sram23kStats.CsToggles ++;
+}
+
+void Sram23kDeselect(void)
+{
+  if (State == Deselected) return;
+
+  State = Deselected;
+  Sram23kStats.CsToggles ++;
+}
+
+static void NextAddr(void)
+{
+  switch (Status & SRAM_23K_MODE_MASK)
+  {
+  case SRAM_23K_MODE_BYTE:
+    State = Done;
+    break;
+
+  case SRAM_23K_MODE_PAGE:
+    Addr = (Addr & ~(SRAM_23K_PAGE_SIZE - 1)) | ((Addr + 1) & (SRAM_23K_PAGE_SIZE - 1));
+    break;
+
+  default:
+    Addr = (Addr + 1) & (SRAM_23K_SIZE - 1);
+    break;
+  }
+}
+
+unsigned char Sram23kTransfer(unsigned char Out)
+{
+  unsigned char In = 0xFF;
+
+  if (State == Deselected)
+  {
+    fprintf(stderr, "Sram23k: clocked while deselected\n");
+    abort();
+  }
+
+  Sram23kStats.Bytes ++;
+
+  switch (State)
+  {
+  case Command:
+    Cmd = Out;
+    if (Cmd == CMD_READ || Cmd == CMD_WRITE) State = AddrHigh;
+    else if (Cmd == CMD_RDSR) State = ReadStatus;
+    else if (Cmd == CMD_WRSR) State = WriteStatus;
+    else
+    {
+      fprintf(stderr, "Sram23k: unknown instruction %02X\n", Cmd);
+      abort();
+    }
+    break;
+
+  case AddrHigh:
+    Addr = (Out << 8) & (SRAM_23K_SIZE - 1);
+    State = AddrLow;
+    break;
+
+  case AddrLow:
+    Addr |= Out;
+    State = Data;
+    if (Cmd == CMD_READ) Sram23kStats.Reads ++;
+    else Sram23kStats.Writes ++;
+    break;
+
+  case Data:
+    if (Cmd == CMD_READ)
+    {
+      In = Sram23kArray[Addr];
+      Sram23kStats.ReadBytes ++;
+    }
+    else
+    {
+      Sram23kArray[Addr] = Out;
+      Sram23kStats.WriteBytes ++;
+    }
+    Sram23kStats.DataBytes ++;
+    NextAddr();
+    break;
+
+  case ReadStatus:
+    In = Status;
+    break;
+
+  case WriteStatus:
+    Status = Out;
+    State = Done;
+    break;
+
+  default:
+    Sram23kStats.Ignored ++;
+    break;
+  }
+
+  return In;
+}
+
+unsigned char Sram23kStatus(void)
+{
+  return Status;
+}
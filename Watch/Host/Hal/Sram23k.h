@@ -0,0 +1,80 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Sram23k.h
+ *
+ * Model of the Microchip 23K256 SPI serial RAM (32 KB) as seen on its pins:
+ * chip select framing and one byte exchanged per 8 SPI clocks.
+ *
+ * Instructions: READ (0x03) and WRITE (0x02) followed by a 16 bit address,
+ * RDSR (0x05) and WRSR (0x01). The mode bits of the status register choose
+ * how far one instruction goes: byte mode transfers a single byte, page mode
+ * wraps inside the 32 byte page, sequential mode runs through the whole
+ * array. The part powers up in byte mode.
+ *
+ * Everything on the bus is counted so the cost of an access pattern can be
+ * compared: bytes clocked, transactions (one per chip select) and chip
+ * select edges.
+ */
+/******************************************************************************/
+
+#ifndef SRAM_23K_H
+#define SRAM_23K_H
+
+#define SRAM_23K_SIZE           (32768)
+#define SRAM_23K_PAGE_SIZE      (32)
+
+#define SRAM_23K_MODE_MASK      (0xC0)
+#define SRAM_23K_MODE_BYTE      (0x00)
+#define SRAM_23K_MODE_PAGE      (0x80)
+#define SRAM_23K_MODE_SEQ       (0x40)
+
+typedef struct
+{
+  unsigned long Bytes;          /* every byte clocked while selected */
+  unsigned long DataBytes;      /* bytes read or written in the array */
+  unsigned long ReadBytes;
+  unsigned long WriteBytes;
+  unsigned long Transactions;   /* chip select asserted */
+  unsigned long CsToggles;      /* chip select edges */
+  unsigned long Reads;          /* READ instructions */
+  unsigned long Writes;         /* WRITE instructions */
+  unsigned long Ignored;        /* bytes past the end of a byte mode access */
+} tSram23kStats;
+
+extern unsigned char Sram23kArray[SRAM_23K_SIZE];
+extern tSram23kStats Sram23kStats;
+
+/*! power up: byte mode, statistics cleared, array keeps its contents */
+void Sram23kReset(void);
+
+/*! CS low: the next byte is an instruction (nothing if CS is low already) */
+void Sram23kSelect(void);
+
+/*! CS high: ends the instruction (nothing if CS is high already) */
+void Sram23kDeselect(void);
+
+/*! Exchange one byte while selected
+ *
+ * \param Out the byte on SI
+ * \return the byte on SO
+ */
+unsigned char Sram23kTransfer(unsigned char Out);
+
+unsigned char Sram23kStatus(void);
+
+#endif /* SRAM_23K_H */
@@ -0,0 +1,237 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Wrapper.c
+ *
+ * Host build: the wrapper task of Wrapper.h, which on the watch drives the
+ * Bluetooth stack (a closed library). Here it runs the script of a test or
+ * bench and the radio is always on, connected and ready to sleep unless the
+ * script is polling.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "Messages.h"
+#include "LcdDisplay.h"
+#include "hal_boot.h"
+#include "Wrapper.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+
+#define WRAPPER_STACK_SIZE      (configMINIMAL_STACK_SIZE + 100)
+#define WRAPPER_PRIORITY        (tskIDLE_PRIORITY + 2)
+
+extern xQueueHandle QueueHandles[];
+extern xQueueHandle UrgentQueueHandle;
+extern unsigned char niRadioReadyToSleep;
+
+void HostStartBoard(void);
+
+unsigned char HostCredit = 0xFF;
+unsigned int HostWrapperMsgs[MAXIMUM_MESSAGE_TYPES];
+
+static void (*pHostScript)(void);
+static int HostStatus;
+
+/* the script polls at the priority of the idle task, which must not sleep
+ * meanwhile: it only checks the queues before it does */
+static unsigned char Polling = FALSE;
+
+static void WrapperTask(void *pvParameters);
+void HostCheck(int Ok, char const *pExpr, char const *pFile, int Line)
+{
+  if (Ok) return;
+
+  fprintf(stderr, "%s:%d: check failed: %s\n", pFile, Line, pExpr);
+  exit(1);
+}
+
+void HostSend(unsigned char Type, unsigned char Options,
+              unsigned char const *pData, unsigned char Length)
+{
+  tMessage Msg = {Length, Type, Options, NULL};
+
+  if (Length)
+  {
+    HOST_CHECK(CreateMessage(&Msg));
+    memcpy(Msg.pBuffer, pData, Length);
+  }
+  RouteMsg(&Msg);
+}
+
+static void Received(tMessage *pMsg);
+
+/******************************************************************************/
+
+int HostRun(void (*pScript)(void))
+{
+  pHostScript = pScript;
+  HostStartBoard();
+
+  CreateWrapperTask();
+  CreateDisplayTask();
+
+  vTaskStartScheduler();
+  return HostStatus;
+}
+
+void HostEnd(int Status)
+{
+  HostStatus = Status;
+  vTaskEndScheduler();
+}
+
+void CreateWrapperTask(void)
+{
+  QueueHandles[WRAPPER_QINDEX] = xQueueCreate(WRAPPER_QUEUE_LENGTH, MESSAGE_SIZE);
+  if (!QueueHandles[WRAPPER_QINDEX]) SoftwareReset(RESET_TASK_FAIL, WRAPPER_QINDEX);
+
+  niRadioReadyToSleep = TRUE;
+  xTaskCreate(WrapperTask, "WRAPPER", WRAPPER_STACK_SIZE, NULL, WRAPPER_PRIORITY, NULL);
+}
+
+static void WrapperTask(void *pvParameters)
+{
+  pHostScript();
+  HostEnd(0);
+}
+
+static void Received(tMessage *pMsg)
+{
+  HostWrapperMsgs[pMsg->Type] ++;
+  if (pMsg->Type == SppAckMsg) HostCredit = pMsg->Options;
+}
+
+unsigned char HostReceive(tMessage *pMsg, unsigned int Ms)
+{
+  if (!xQueueReceive(QueueHandles[WRAPPER_QINDEX], pMsg, Ms / portTICK_RATE_MS)) return FALSE;
+
+  Received(pMsg);
+  return TRUE;
+}
+
+void HostWait(unsigned int Ms)
+{
+  portTickType End = xTaskGetTickCount() + Ms / portTICK_RATE_MS;
+  tMessage Msg;
+
+  for (;;)
+  {
+    portTickType Left = End - xTaskGetTickCount();
+
+    /* wrapped: the end has passed */
+    if (Left == 0 || Left > Ms / portTICK_RATE_MS) break;
+
+    if (xQueueReceive(QueueHandles[WRAPPER_QINDEX], &Msg, Left))
+    {
+      Received(&Msg);
+      if (Msg.pBuffer) FreeMessageBuffer(Msg.pBuffer);
+    }
+  }
+}
+
+void HostWaitIdle(void)
+{
+  tMessage Msg;
+
+  /* below the display task, which runs whenever it is ready */
+  Polling = TRUE;
+  vTaskPrioritySet(NULL, tskIDLE_PRIORITY);
+
+  /* the display task is idle once it waits for its queue again */
+  while (QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting ||
+         UrgentQueueHandle->uxMessagesWaiting ||
+         listLIST_IS_EMPTY(&QueueHandles[DISPLAY_QINDEX]->xTasksWaitingToReceive))
+  {
+    if (xQueueReceive(QueueHandles[WRAPPER_QINDEX], &Msg, 0))
+    {
+      Received(&Msg);
+      if (Msg.pBuffer) FreeMessageBuffer(Msg.pBuffer);
+    }
+    taskYIELD();
+  }
+
+  vTaskPrioritySet(NULL, WRAPPER_PRIORITY);
+  Polling = FALSE;
+}
+
+/******************************************************************************/
+
+unsigned char ReadyToSleep(void)
+{
+  return !Polling;
+}
+
+unsigned char Connected(unsigned char Type)
+{
+  return TRUE;
+}
+
+unsigned char OnceConnected(void)
+{
+  return TRUE;
+}
+
+unsigned char RadioOn(void)
+{
+  return TRUE;
+}
+
+eBluetoothState BluetoothState(void)
+{
+  return Connect;
+}
+
+unsigned char BlePaired(void)
+{
+  return TRUE;
+}
+
+unsigned char BtPaired(void)
+{
+  return FALSE;
+}
+
+unsigned char CurrentInterval(unsigned char Prop)
+{
+  return 0;
+}
+
+etSniffState QuerySniffState(void)
+{
+  return Active;
+}
+
+void GetBDAddrStr(char *pAddr)
+{
+  strcpy(pAddr, "000000000000");
+}
+
+char const *GetLocalName(void)
+{
+  return "Host";
+}
+
+int vSprintF(char *buffer, const char *format, va_list ap)
+{
+  return vsprintf(buffer, format, ap);
+}
@@ -0,0 +1,59 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_lpm.c
+*
+* Host build: LPM3, then one tick to run the tasks an isr has woken, as on
+* the MSP430. The tick stays on while a task is delayed (the check that is
+* commented out in Hardware/hal_lpm.c): on the watch the radio keeps the
+* cpu awake through the short delays of the display task, here nothing
+* else would. Shipping mode ends the run.
+*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hal_rtos_timer.h"
+#include "hal_lpm.h"
+#include "HostCpu.h"
+
+extern unsigned char xPortTickIsr(void);
+
+static unsigned char ShippingMode = FALSE;
+
+void EnterLpm3(void)
+{
+  if (ShippingMode)
+  {
+    fprintf(stderr, "shipping mode entered\n");
+    exit(1);
+  }
+
+  if (!xTaskTickRequired()) DisableRtosTick();
+  _BIS_SR(SCG1 + CPUOFF + GIE);
+  EnableRtosTick();
+
+  /* RTOS_TICK_SET_IFG() */
+  HostRaise(xPortTickIsr, HostCycles);
+}
+
+void EnableShippingMode(void)
+{
+  ShippingMode = TRUE;
+}
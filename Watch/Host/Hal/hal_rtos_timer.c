@@ -0,0 +1,72 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_rtos_timer.c
+*
+* Host build: the RTOS tick is an isr raised every HOST_TICK_CYCLES while
+* it is enabled, as TA0CCR0 does on the MSP430. The crystal timers are not
+* used by the application and are not simulated.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "hal_board_type.h"
+#include "hal_rtos_timer.h"
+#include "hal_crystal_timers.h"
+#include "HostCpu.h"
+
+/* these are shared with the port */
+unsigned char RtosTickEnabled = 0;
+unsigned int RtosTickCount = RTOS_TICK_COUNT;
+
+extern unsigned char xPortTickIsr(void);
+
+void SetupRtosTimer(void)
+{
+  EnableRtosTick();
+}
+
+void EnableRtosTick(void)
+{
+  if (RtosTickEnabled) return;
+
+  RtosTickEnabled = TRUE;
+  HostRaise(xPortTickIsr, HostCycles + RtosTickCount * HOST_TICK_CYCLES);
+}
+
+void DisableRtosTick(void)
+{
+  if (!RtosTickEnabled) return;
+
+  RtosTickEnabled = FALSE;
+  HostCancel(xPortTickIsr);
+}
+
+unsigned char QuerySchedulerState(void)
+{
+  return RtosTickEnabled;
+}
+
+void StartCrystalTimer(unsigned char TimerId,
+                       unsigned char (*pCallback) (void),
+                       unsigned int Ticks)
+{
+}
+
+void StopCrystalTimer(unsigned char TimerId)
+{
+}
@@ -0,0 +1,231 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_serial_ram.c
+*
+* Host build: the serial RAM functions of Watch/Hardware/hal_serial_ram.c
+* over the 23K256 model. Bytes go to the model when a transfer starts; the
+* DMA interrupt is raised for when the last byte has been clocked (16 MCLK
+* cycles a byte at 8.39 MHz) and the caller spins or blocks on it with the
+* same rules as the MSP430 driver.
+*/
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "hal_board_type.h"
+#include "hal_clock_control.h"
+#include "hal_miscellaneous.h"
+#include "hal_lpm.h"
+#include "hal_rtos_timer.h"
+#include "hal_serial_ram.h"
+#include "DebugUart.h"
+#include "LcdDriver.h"
+#include "Statistics.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "Sram23k.h"
+
+/* write and read status register */
+#define SPI_RDSR                (0x05)
+#define SPI_WRSR                (0x01)
+#define SPI_INIT_DELAY_IN_MS    (10 * portTICK_RATE_MS)
+
+#define DEFAULT_SR_VALUE_256    (0x00)
+#define FINAL_SR_VALUE_256      (0x41)
+#define SEQUENTIAL_MODE_COMMAND (0x41)
+
+/* as in the MSP430 driver */
+#define SRAM_BLOCKING_LENGTH    128
+
+/* SMCLK / 2, 8 bits */
+#define SRAM_BYTE_CYCLES        (16)
+
+static unsigned char DmaBusy  = 0;
+static unsigned char DmaBlocking = 0;
+static xSemaphoreHandle DmaDone = NULL;
+
+static unsigned char DmaVector(unsigned int Iv);
+
+/* a byte sent by the cpu: write TXBUF and wait for RXIFG */
+static unsigned char Exchange(unsigned char Out)
+{
+  HostBusy(SRAM_BYTE_CYCLES);
+  return Sram23kTransfer(Out);
+}
+
+void InitSramSpi(void)
+{
+  if (!DmaDone)
+  {
+    vSemaphoreCreateBinary(DmaDone);
+    xSemaphoreTake(DmaDone, 0);
+  }
+
+  vTaskDelay(SPI_INIT_DELAY_IN_MS);
+
+  Sram23kSelect();
+  Exchange(SPI_RDSR);
+  unsigned char ReadData = Exchange(0x00);
+  if (ReadData != DEFAULT_SR_VALUE_256 && ReadData != FINAL_SR_VALUE_256) PrintS("# SRAM Init1");
+  Sram23kDeselect();
+
+  Sram23kSelect();
+  Exchange(SPI_WRSR);
+  Exchange(SEQUENTIAL_MODE_COMMAND);
+  Sram23kDeselect();
+
+  Sram23kSelect();
+  Exchange(SPI_RDSR);
+  ReadData = Exchange(0x00);
+  if (ReadData != FINAL_SR_VALUE_256) PrintS("# SRAM Init2");
+  Sram23kDeselect();
+}
+
+static unsigned char Dma1Isr(void)
+{
+  return DmaVector(4);
+}
+
+unsigned char HostLcdDmaIsr(void)
+{
+  return DmaVector(6);
+}
+
+static void StartWait(unsigned int Length, unsigned int Count)
+{
+  DmaBusy = 1;
+  DmaBlocking = Length >= SRAM_BLOCKING_LENGTH && DmaDone && (__get_interrupt_state() & GIE);
+  HostRaise(Dma1Isr, HostCycles + (unsigned long)Count * SRAM_BYTE_CYCLES);
+}
+
+static void WaitForDma(void)
+{
+  if (DmaBlocking)
+  {
+    portTickType Start = xTaskGetTickCount();
+
+    xSemaphoreTake(DmaDone, portMAX_DELAY);
+    DmaBlocking = 0;
+
+    gAppStats.DmaWaits ++;
+    gAppStats.DmaTicksFreed += xTaskGetTickCount() - Start;
+  }
+  else while (DmaBusy)
+  {
+    /* the MSP430 would spin here for ever */
+    if (!(__get_interrupt_state() & GIE))
+    {
+      fprintf(stderr, "hal_serial_ram: waiting for the DMA with interrupts disabled\n");
+      abort();
+    }
+    HostBusy(SRAM_BYTE_CYCLES);
+  }
+}
+
+void SramRead(unsigned char *pWriteData, unsigned char *pReadData, unsigned int Length)
+{
+  unsigned int Count = Length + SRAM_HEADER_LEN + 1;
+  unsigned int i;
+
+  StartWait(0, Count);
+  Sram23kSelect();
+
+  /* DMA1 stores RXBUF one trigger late: the first byte it stores is
+   * the one received before the transfer */
+  for (i = 0; i < Count - 1; ++i)
+    pReadData[i + 1] = Sram23kTransfer(i < SRAM_HEADER_LEN ? pWriteData[i] : 0x00);
+
+  Sram23kTransfer(0x00);
+  WaitForDma();
+
+  Sram23kDeselect();
+
+  gAppStats.SramBytes += Length + SRAM_READ_OVERHEAD;
+  gAppStats.SramFrames ++;
+  gAppStats.SramTransfers ++;
+}
+
+static void WriteDma(unsigned long const pData, unsigned int Count, unsigned char Op)
+{
+  unsigned char const *pSource = (unsigned char const *)pData;
+  unsigned int i;
+
+  EnableSmClkUser(SERIAL_RAM_USER);
+  StartWait(Count, Count);
+
+  for (i = 0; i < Count; ++i) Sram23kTransfer(Op == DMA_COPY ? pSource[i] : *pSource);
+  WaitForDma();
+
+  DisableSmClkUser(SERIAL_RAM_USER);
+
+  gAppStats.SramBytes += Count;
+  gAppStats.SramTransfers ++;
+}
+
+void SramWrite(unsigned long const pData, unsigned int Length, unsigned char Op)
+{
+  Sram23kSelect();
+  WriteDma(pData, Length + SRAM_HEADER_LEN, Op);
+  Sram23kDeselect();
+  gAppStats.SramFrames ++;
+}
+
+void SramWriteNext(unsigned long const pData, unsigned int Length, unsigned char Op)
+{
+  WriteDma(pData, Length, Op);
+}
+
+void SramEndWrite(void)
+{
+  Sram23kDeselect();
+  gAppStats.SramFrames ++;
+}
+
+void SramSetAddr(unsigned int Addr)
+{
+  Sram23kSelect();
+
+  Exchange(SPI_WRITE);
+  Exchange(Addr >> 8);
+  Exchange(Addr);
+  gAppStats.SramBytes += SRAM_HEADER_LEN;
+}
+
+/* DMA_ISR and DmaIsr for the channel of DMAIV Iv. The context save of
+ * DMA_ISR always leaves LPM; it switches tasks when DmaIsr returns TRUE */
+static unsigned char DmaVector(unsigned int Iv)
+{
+  signed portBASE_TYPE HigherPriorityTaskWoken = pdFALSE;
+
+  switch (Iv)
+  {
+  case 2:
+  case 4:
+    DmaBusy = 0;
+    if (DmaBlocking) xSemaphoreGiveFromISR(DmaDone, &HigherPriorityTaskWoken);
+    break;
+  case 6: HigherPriorityTaskWoken = LcdDmaIsr(); break;
+  default: break;
+  }
+
+  EXIT_LPM_ISR();
+  return HigherPriorityTaskWoken && QuerySchedulerState();
+}
@@ -0,0 +1,65 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file intrinsics.h
+ *
+ * Host stand-in for the IAR MSP430 intrinsics. The status register is
+ * simulated by HostCpu.c: clearing GIE holds simulated interrupts back,
+ * setting it delivers the ones that are due.
+ */
+/******************************************************************************/
+
+#ifndef HOST_INTRINSICS_H
+#define HOST_INTRINSICS_H
+
+typedef unsigned short __istate_t;
+
+unsigned short __get_interrupt_state(void);
+void __set_interrupt_state(unsigned short State);
+void __disable_interrupt(void);
+void __enable_interrupt(void);
+
+/*! let Cycles MCLK cycles pass with the cpu busy */
+void __delay_cycles(unsigned long Cycles);
+
+void __bis_SR_register(unsigned short Bits);
+void __bic_SR_register(unsigned short Bits);
+
+/*! clear SR bits of the interrupted code when the isr returns; only
+ * leaving low power mode is simulated */
+void __bic_SR_register_on_exit(unsigned short Bits);
+
+void __low_power_mode_4(void);
+
+#define __no_operation()              ((void)0)
+#define __even_in_range(_Value, _Max) (_Value)
+
+/* the DMA address registers are only written by hal_serial_ram.c and
+ * LcdDriver.c, which the host build replaces */
+#define __data16_write_addr(_Addr, _Value) ((void)(_Addr), (void)(_Value))
+
+#define _BIS_SR(_x)                   __bis_SR_register(_x)
+#define _BIC_SR(_x)                   __bic_SR_register(_x)
+#define _BIC_SR_IRQ(_x)               __bic_SR_register_on_exit(_x)
+
+/* IAR keywords */
+#define __interrupt
+#define __root
+#define __no_init
+#define __monitor
+
+#endif /* HOST_INTRINSICS_H */
@@ -0,0 +1,685 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file msp430.h
+ *
+ * Host stand-in for the MSP430F5438A device header. Every peripheral
+ * register the firmware touches is a plain variable (Registers.c defines
+ * them). Bit names have the values of the TI header.
+ *
+ * Nothing happens on a register write: the peripherals that matter to the
+ * display pipeline (serial RAM, LCD, RTC, buttons, RTOS timer) are driven by
+ * the Hal files of the host build instead. Flags that firmware spins on are
+ * always set (UCTXIFG, UCRXIFG) or left clear (busy bits) so those loops
+ * end.
+ */
+/******************************************************************************/
+
+#ifndef HOST_MSP430_H
+#define HOST_MSP430_H
+
+#include "intrinsics.h"
+
+#ifdef HOST_REGISTER_DEFINE
+#define HOST_REG(_Type, _Name) volatile _Type _Name;
+#else
+#define HOST_REG(_Type, _Name) extern volatile _Type _Name;
+#endif
+
+#define HOST_REG8(_Name)   HOST_REG(unsigned char, _Name)
+#define HOST_REG16(_Name)  HOST_REG(unsigned int, _Name)
+#define HOST_REG20(_Name)  HOST_REG(unsigned long, _Name)
+
+/* low and high byte of a 16 bit register */
+#define HOST_REG_L(_Name)  (((volatile unsigned char *)&(_Name))[0])
+#define HOST_REG_H(_Name)  (((volatile unsigned char *)&(_Name))[1])
+
+/************************************************************
+* STANDARD BITS
+************************************************************/
+#define BIT0                (0x0001)
+#define BIT1                (0x0002)
+#define BIT2                (0x0004)
+#define BIT3                (0x0008)
+#define BIT4                (0x0010)
+#define BIT5                (0x0020)
+#define BIT6                (0x0040)
+#define BIT7                (0x0080)
+#define BIT8                (0x0100)
+#define BIT9                (0x0200)
+#define BITA                (0x0400)
+#define BITB                (0x0800)
+#define BITC                (0x1000)
+#define BITD                (0x2000)
+#define BITE                (0x4000)
+#define BITF                (0x8000)
+
+/************************************************************
+* STATUS REGISTER BITS
+************************************************************/
+#define C                   (0x0001)
+#define Z                   (0x0002)
+#define N                   (0x0004)
+#define V                   (0x0100)
+#define GIE                 (0x0008)
+#define CPUOFF              (0x0010)
+#define OSCOFF              (0x0020)
+#define SCG0                (0x0040)
+#define SCG1                (0x0080)
+
+#define LPM0_bits           (CPUOFF)
+#define LPM1_bits           (SCG0+CPUOFF)
+#define LPM2_bits           (SCG1+CPUOFF)
+#define LPM3_bits           (SCG1+SCG0+CPUOFF)
+#define LPM4_bits           (SCG1+SCG0+OSCOFF+CPUOFF)
+
+/************************************************************
+* ADC12 PLUS
+************************************************************/
+HOST_REG16(ADC12CTL0)
+HOST_REG16(ADC12CTL1)
+HOST_REG16(ADC12CTL2)
+HOST_REG16(ADC12IFG)
+HOST_REG16(ADC12IE)
+HOST_REG16(ADC12IV)
+HOST_REG8(ADC12MCTL0)
+HOST_REG8(ADC12MCTL1)
+HOST_REG8(ADC12MCTL2)
+HOST_REG16(ADC12MEM0)
+HOST_REG16(ADC12MEM1)
+HOST_REG16(ADC12MEM2)
+
+#define ADC12SC             (0x0001)
+#define ADC12ENC            (0x0002)
+#define ADC12TOVIE          (0x0004)
+#define ADC12OVIE           (0x0008)
+#define ADC12ON             (0x0010)
+#define ADC12REFON          (0x0020)
+#define ADC12REF2_5V        (0x0040)
+#define ADC12MSC            (0x0080)
+#define ADC12BUSY           (0x0001)
+#define ADC12ISSH           (0x0100)
+#define ADC12SHP            (0x0200)
+#define ADC12SSEL_0         (0x0000)
+#define ADC12SSEL_3         (0x0018)
+#define ADC12DIV_7          (0x00E0)
+#define ADC12CSTARTADD_0    (0x0000)
+#define ADC12CSTARTADD_1    (0x1000)
+#define ADC12CSTARTADD_2    (0x2000)
+#define ADC12REFBURST       (0x0040)
+#define ADC12REFOUT         (0x0080)
+#define ADC12SR             (0x0004)
+#define ADC12TCOFF          (0x0010)
+#define ADC12RES_2          (0x0020)
+#define ADC12EOS            (0x0080)
+#define ADC12INCH_0         (0x0000)
+#define ADC12INCH_1         (0x0001)
+#define ADC12INCH_13        (0x000D)
+#define ADC12INCH_15        (0x000F)
+
+/************************************************************
+* DMA
+************************************************************/
+HOST_REG16(DMACTL0)
+HOST_REG16(DMACTL1)
+HOST_REG16(DMACTL2)
+HOST_REG16(DMACTL3)
+HOST_REG16(DMACTL4)
+HOST_REG16(DMAIV)
+HOST_REG16(DMA0CTL)
+HOST_REG20(DMA0SA)
+HOST_REG20(DMA0DA)
+HOST_REG16(DMA0SZ)
+HOST_REG16(DMA1CTL)
+HOST_REG20(DMA1SA)
+HOST_REG20(DMA1DA)
+HOST_REG16(DMA1SZ)
+HOST_REG16(DMA2CTL)
+HOST_REG20(DMA2SA)
+HOST_REG20(DMA2DA)
+HOST_REG16(DMA2SZ)
+
+#define DMA0TSEL_16         (16*0x0001u)
+#define DMA0TSEL_17         (17*0x0001u)
+#define DMA1TSEL_16         (16*0x0100u)
+#define DMA1TSEL_17         (17*0x0100u)
+#define DMA2TSEL_19         (19*0x0001u)
+#define DMARMWDIS           (0x0004)
+#define DMAREQ              (0x0001)
+#define DMAABORT            (0x0002)
+#define DMAIE               (0x0004)
+#define DMAIFG              (0x0008)
+#define DMAEN               (0x0010)
+#define DMALEVEL            (0x0020)
+#define DMASRCBYTE          (0x0040)
+#define DMADSTBYTE          (0x0080)
+#define DMASBDB             (0x00C0)
+#define DMASRCINCR_3        (0x0300)
+#define DMADSTINCR_3        (0x0C00)
+#define DMADT_0             (0x0000)
+#define DMADT_4             (0x4000)
+
+/************************************************************
+* FLASH
+************************************************************/
+HOST_REG16(FCTL1)
+HOST_REG16(FCTL3)
+HOST_REG16(FCTL4)
+
+#define FWKEY               (0xA500)
+#define FRKEY               (0x9600)
+#define ERASE               (0x0002)
+#define MERAS               (0x0004)
+#define WRT                 (0x0040)
+#define BLKWRT              (0x0080)
+#define BUSY                (0x0001)
+#define KEYV                (0x0002)
+#define ACCVIFG             (0x0004)
+#define WAIT                (0x0008)
+#define LOCK                (0x0010)
+#define EMEX                (0x0020)
+#define LOCKA               (0x0040)
+
+/************************************************************
+* DIGITAL I/O Port1 - Port11
+************************************************************/
+#define HOST_PORT(_n)             \
+  HOST_REG8(P##_n##IN)            \
+  HOST_REG8(P##_n##OUT)           \
+  HOST_REG8(P##_n##DIR)           \
+  HOST_REG8(P##_n##REN)           \
+  HOST_REG8(P##_n##DS)            \
+  HOST_REG8(P##_n##SEL)
+
+HOST_PORT(1)
+HOST_PORT(2)
+HOST_PORT(3)
+HOST_PORT(4)
+HOST_PORT(5)
+HOST_PORT(6)
+HOST_PORT(7)
+HOST_PORT(8)
+HOST_PORT(9)
+HOST_PORT(10)
+HOST_PORT(11)
+HOST_REG8(P1IES)
+HOST_REG8(P1IE)
+HOST_REG8(P1IFG)
+HOST_REG16(P1IV)
+HOST_REG8(P2IES)
+HOST_REG8(P2IE)
+HOST_REG8(P2IFG)
+HOST_REG16(P2IV)
+HOST_REG16(PJIN)
+HOST_REG16(PJOUT)
+HOST_REG16(PJDIR)
+
+/************************************************************
+* PMM - Power Management System
+************************************************************/
+HOST_REG16(PMMCTL0)
+HOST_REG16(PMMCTL1)
+HOST_REG16(SVSMHCTL)
+HOST_REG16(SVSMLCTL)
+HOST_REG16(SVSMIO)
+HOST_REG16(PMMIFG)
+HOST_REG16(PMMRIE)
+HOST_REG16(PM5CTL0)
+
+#define PMMCTL0_L           HOST_REG_L(PMMCTL0)
+#define PMMCTL0_H           HOST_REG_H(PMMCTL0)
+#define PMMIFG_L            HOST_REG_L(PMMIFG)
+
+#define PMMPW               (0xA500)
+#define PMMPW_H             (0xA5)
+#define PMMCOREV0           (0x0001)
+#define PMMCOREV1           (0x0002)
+#define PMMSWBOR            (0x0004)
+#define PMMSWPOR            (0x0008)
+#define PMMREGOFF           (0x0010)
+#define PMMHPMRE            (0x0080)
+#define PMMCOREV_0          (0x0000)
+#define PMMCOREV_1          (0x0001)
+#define PMMCOREV_2          (0x0002)
+#define PMMCOREV_3          (0x0003)
+
+#define SVSMHRRL0           (0x0001)
+#define SVSMHRRL1           (0x0002)
+#define SVSMHRRL2           (0x0004)
+#define SVSMHDLYST          (0x0008)
+#define SVSHMD              (0x0010)
+#define SVSMHEVM            (0x0040)
+#define SVSMHACE            (0x0080)
+#define SVSHRVL0            (0x0100)
+#define SVSHRVL1            (0x0200)
+#define SVSHE               (0x0400)
+#define SVSHFP              (0x0800)
+#define SVMHOVPE            (0x1000)
+#define SVMHE               (0x4000)
+#define SVMHFP              (0x8000)
+
+#define SVSMLRRL0           (0x0001)
+#define SVSMLRRL1           (0x0002)
+#define SVSMLRRL2           (0x0004)
+#define SVSMLDLYST          (0x0008)
+#define SVSLMD              (0x0010)
+#define SVSMLEVM            (0x0040)
+#define SVSMLACE            (0x0080)
+#define SVSLRVL0            (0x0100)
+#define SVSLRVL1            (0x0200)
+#define SVSLE               (0x0400)
+#define SVSLFP              (0x0800)
+#define SVMLOVPE            (0x1000)
+#define SVMLE               (0x4000)
+#define SVMLFP              (0x8000)
+
+#define SVSMLDLYIFG         (0x0001)
+#define SVMLIFG             (0x0002)
+#define SVMLVLRIFG          (0x0004)
+#define SVSMHDLYIFG         (0x0010)
+#define SVMHIFG             (0x0020)
+#define SVMHVLRIFG          (0x0040)
+#define PMMBORIFG           (0x0100)
+#define PMMRSTIFG           (0x0200)
+#define PMMPORIFG           (0x0400)
+#define SVSHIFG             (0x1000)
+#define SVSLIFG             (0x2000)
+#define PMMLPM5IFG          (0x8000)
+
+#define SVSMLDLYIE          (0x0001)
+#define SVMLIE              (0x0002)
+#define SVMLVLRIE           (0x0004)
+#define SVSMHDLYIE          (0x0010)
+#define SVMHIE              (0x0020)
+#define SVMHVLRIE           (0x0040)
+#define SVSLPE              (0x0100)
+#define SVMLVLRPE           (0x0200)
+#define SVSHPE              (0x1000)
+#define SVMHVLRPE           (0x2000)
+
+#define LOCKLPM5            (0x0001)
+
+/************************************************************
+* REF MODULE
+************************************************************/
+HOST_REG16(REFCTL0)
+
+#define REFON               (0x0001)
+#define REFOUT              (0x0002)
+#define REFTCOFF            (0x0008)
+#define REFVSEL_2           (0x0020)
+#define REFMSTR             (0x0080)
+
+/************************************************************
+* Real Time Clock
+************************************************************/
+HOST_REG16(RTCCTL01)
+HOST_REG16(RTCCTL23)
+HOST_REG8(RTCCTL2)
+HOST_REG16(RTCPS0CTL)
+HOST_REG16(RTCPS1CTL)
+HOST_REG16(RTCPS)
+HOST_REG16(RTCIV)
+HOST_REG8(RTCSEC)
+HOST_REG8(RTCMIN)
+HOST_REG8(RTCHOUR)
+HOST_REG8(RTCDOW)
+HOST_REG8(RTCDAY)
+HOST_REG8(RTCMON)
+HOST_REG16(RTCYEAR)
+
+#define RTCYEARL            HOST_REG_L(RTCYEAR)
+#define RTCYEARH            HOST_REG_H(RTCYEAR)
+
+#define RTCRDYIFG           (0x0001)
+#define RTCAIFG             (0x0002)
+#define RTCTEVIFG           (0x0004)
+#define RTCRDYIE            (0x0010)
+#define RTCAIE              (0x0020)
+#define RTCTEVIE            (0x0040)
+#define RTCTEV_0            (0x0000)
+#define RTCSSEL_0           (0x0000)
+#define RTCRDY              (0x1000)
+#define RTCMODE             (0x2000)
+#define RTCHOLD             (0x4000)
+#define RTCBCD              (0x8000)
+#define RTCCALS             (0x80)
+#define RTCCALF_3           (0x0300)
+#define RT0PSIFG            (0x0001)
+#define RT0PSIE             (0x0002)
+#define RT0IP_7             (0x001C)
+#define RT1PSIFG            (0x0001)
+#define RT1PSIE             (0x0002)
+#define RT1IP_6             (0x0018)
+
+/************************************************************
+* SFR - Special Function Register Module
+************************************************************/
+HOST_REG16(SFRIE1)
+HOST_REG16(SFRIFG1)
+HOST_REG16(SFRRPCR)
+
+#define WDTIE               (0x0001)
+#define OFIE                (0x0002)
+#define VMAIE               (0x0008)
+#define NMIIE               (0x0010)
+#define ACCVIE              (0x0020)
+#define JMBINIE             (0x0040)
+#define JMBOUTIE            (0x0080)
+#define WDTIFG              (0x0001)
+#define OFIFG               (0x0002)
+#define VMAIFG              (0x0008)
+#define NMIIFG              (0x0010)
+#define SYSNMI              (0x0001)
+#define SYSNMIIES           (0x0002)
+#define SYSRSTUP            (0x0004)
+#define SYSRSTRE            (0x0008)
+
+/************************************************************
+* SYS - System Module
+************************************************************/
+HOST_REG16(SYSCTL)
+HOST_REG16(SYSRSTIV)
+HOST_REG16(SYSSNIV)
+HOST_REG16(SYSUNIV)
+
+#define SYSRIVECT           (0x0001)
+#define SYSPMMPE            (0x0004)
+#define SYSBSLIND           (0x0010)
+#define SYSJTAGPIN          (0x0020)
+#define SYSRSTIV_NONE       (0x0000)
+#define SYSRSTIV_BOR        (0x0002)
+#define SYSRSTIV_RSTNMI     (0x0004)
+#define SYSRSTIV_DOBOR      (0x0006)
+#define SYSRSTIV_WDTTO      (0x0016)
+#define SYSRSTIV_WDTKEY     (0x0018)
+
+/************************************************************
+* Timer A0, A1 and B0
+************************************************************/
+HOST_REG16(TA0CTL)
+HOST_REG16(TA0CCTL0)
+HOST_REG16(TA0CCTL1)
+HOST_REG16(TA0CCTL2)
+HOST_REG16(TA0CCTL3)
+HOST_REG16(TA0CCTL4)
+HOST_REG16(TA0R)
+HOST_REG16(TA0CCR0)
+HOST_REG16(TA0CCR1)
+HOST_REG16(TA0CCR2)
+HOST_REG16(TA0CCR3)
+HOST_REG16(TA0CCR4)
+HOST_REG16(TA0IV)
+HOST_REG16(TA0EX0)
+HOST_REG16(TA1CTL)
+HOST_REG16(TA1CCTL0)
+HOST_REG16(TA1CCTL1)
+HOST_REG16(TA1CCTL2)
+HOST_REG16(TA1R)
+HOST_REG16(TA1CCR0)
+HOST_REG16(TA1CCR1)
+HOST_REG16(TA1CCR2)
+HOST_REG16(TA1IV)
+HOST_REG16(TA1EX0)
+HOST_REG16(TB0CTL)
+HOST_REG16(TB0CCTL0)
+HOST_REG16(TB0CCTL1)
+HOST_REG16(TB0CCTL2)
+HOST_REG16(TB0CCTL6)
+HOST_REG16(TB0R)
+HOST_REG16(TB0CCR0)
+HOST_REG16(TB0CCR1)
+HOST_REG16(TB0CCR2)
+HOST_REG16(TB0CCR6)
+HOST_REG16(TB0IV)
+HOST_REG16(TB0EX0)
+
+#define TAIFG               (0x0001)
+#define TAIE                (0x0002)
+#define TACLR               (0x0004)
+#define MC_0                (0x0000)
+#define MC_1                (0x0010)
+#define MC_2                (0x0020)
+#define MC_3                (0x0030)
+#define MC__STOP            (0x0000)
+#define MC__UP              (0x0010)
+#define MC__CONTINUOUS      (0x0020)
+#define MC__UPDOWN          (0x0030)
+#define ID_0                (0x0000)
+#define ID_1                (0x0040)
+#define ID_2                (0x0080)
+#define ID_3                (0x00C0)
+#define ID__1               (0x0000)
+#define ID__2               (0x0040)
+#define ID__4               (0x0080)
+#define ID__8               (0x00C0)
+#define TASSEL_0            (0x0000)
+#define TASSEL_1            (0x0100)
+#define TASSEL_2            (0x0200)
+#define TASSEL__TACLK       (0x0000)
+#define TASSEL__ACLK        (0x0100)
+#define TASSEL__SMCLK       (0x0200)
+#define CCIFG               (0x0001)
+#define COV                 (0x0002)
+#define OUT                 (0x0004)
+#define CCI                 (0x0008)
+#define CCIE                (0x0010)
+#define OUTMOD_0            (0x0000)
+#define OUTMOD_4            (0x0080)
+#define OUTMOD_6            (0x00C0)
+#define OUTMOD_7            (0x00E0)
+#define CAP                 (0x0100)
+#define SCS                 (0x0800)
+#define CCIS_0              (0x0000)
+#define CCIS_1              (0x1000)
+#define CM_0                (0x0000)
+#define CM_1                (0x4000)
+#define CM_2                (0x8000)
+#define CM_3                (0xC000)
+#define TBCLR               (0x0004)
+#define TBSSEL__ACLK        (0x0100)
+#define TBSSEL__SMCLK       (0x0200)
+#define TBIDEX__8           (0x0007)
+
+/************************************************************
+* Unified Clock System
+************************************************************/
+HOST_REG16(UCSCTL0)
+HOST_REG16(UCSCTL1)
+HOST_REG16(UCSCTL2)
+HOST_REG16(UCSCTL3)
+HOST_REG16(UCSCTL4)
+HOST_REG16(UCSCTL5)
+HOST_REG16(UCSCTL6)
+HOST_REG16(UCSCTL7)
+HOST_REG16(UCSCTL8)
+
+#define UCSCTL6_L           HOST_REG_L(UCSCTL6)
+#define UCSCTL6_H           HOST_REG_H(UCSCTL6)
+
+#define MOD0                (0x0008)
+#define DCORSEL_0           (0x0000)
+#define DCORSEL_1           (0x0010)
+#define DCORSEL_2           (0x0020)
+#define DCORSEL_3           (0x0030)
+#define DCORSEL_4           (0x0040)
+#define DCORSEL_5           (0x0050)
+#define DCORSEL_6           (0x0060)
+#define DCORSEL_7           (0x0070)
+#define FLLD0               (0x1000)
+#define FLLD__2             (0x1000)
+#define SELREF_7            (0x0070)
+#define SELREF__XT1CLK      (0x0000)
+#define SELREF__REFOCLK     (0x0020)
+#define SELM_7              (0x0007)
+#define SELM__DCOCLK        (0x0003)
+#define SELM__DCOCLKDIV     (0x0004)
+#define SELS_7              (0x0070)
+#define SELS__DCOCLK        (0x0030)
+#define SELS__DCOCLKDIV     (0x0040)
+#define SELA_7              (0x0700)
+#define SELA__XT1CLK        (0x0000)
+#define SELA__REFOCLK       (0x0200)
+#define DIVM_7              (0x0007)
+#define DIVM__1             (0x0000)
+#define DIVM__2             (0x0001)
+#define XT1OFF              (0x0001)
+#define SMCLKOFF            (0x0002)
+#define XCAP0               (0x0004)
+#define XCAP1               (0x0008)
+#define XT1BYPASS           (0x0010)
+#define XTS                 (0x0020)
+#define XT1DRIVE0           (0x0040)
+#define XT1DRIVE1           (0x0080)
+#define XT2OFF              (0x0100)
+#define XT1DRIVE_0          (0x0000)
+#define XT1DRIVE_3          (0x00C0)
+#define XT1DRIVE0_L         (0x0040)
+#define XT1DRIVE1_L         (0x0080)
+#define DCOFFG              (0x0001)
+#define XT1LFOFFG           (0x0002)
+#define XT1HFOFFG           (0x0004)
+#define XT2OFFG             (0x0008)
+#define ACLKREQEN           (0x0001)
+#define MCLKREQEN           (0x0002)
+#define SMCLKREQEN          (0x0004)
+#define MODOSCREQEN         (0x0008)
+
+/************************************************************
+* USCI A0, A1, A3, B0, B1
+************************************************************/
+#define HOST_USCI(_x)             \
+  HOST_REG8(UC##_x##CTL0)         \
+  HOST_REG8(UC##_x##CTL1)         \
+  HOST_REG8(UC##_x##BR0)          \
+  HOST_REG8(UC##_x##BR1)          \
+  HOST_REG8(UC##_x##MCTL)         \
+  HOST_REG8(UC##_x##STAT)         \
+  HOST_REG8(UC##_x##RXBUF)        \
+  HOST_REG8(UC##_x##TXBUF)        \
+  HOST_REG8(UC##_x##IE)           \
+  HOST_REG8(HostUC##_x##IFG)      \
+  HOST_REG16(UC##_x##IV)
+
+HOST_USCI(A0)
+HOST_USCI(A1)
+HOST_USCI(A3)
+HOST_USCI(B0)
+HOST_USCI(B1)
+/* A USCI is always ready to send and has always received a byte: the host
+ * drivers of the SPI devices model their timing. Reading UCA3IFG also
+ * passes the byte written to UCA3TXBUF to the debug console. */
+volatile unsigned char *HostUsciIfg(volatile unsigned char *pIfg);
+
+#define UCA0IFG             (*HostUsciIfg(&HostUCA0IFG))
+#define UCA1IFG             (*HostUsciIfg(&HostUCA1IFG))
+#define UCA3IFG             (*HostUsciIfg(&HostUCA3IFG))
+#define UCB0IFG             (*HostUsciIfg(&HostUCB0IFG))
+#define UCB1IFG             (*HostUsciIfg(&HostUCB1IFG))
+
+HOST_REG16(UCB0I2CSA)
+HOST_REG16(UCB1I2CSA)
+
+#define UCSWRST             (0x01)
+#define UCTXSTT             (0x02)
+#define UCTXSTP             (0x04)
+#define UCTXNACK            (0x08)
+#define UCTR                (0x10)
+#define UCSSEL_2            (0x80)
+#define UCSSEL__ACLK        (0x40)
+#define UCSSEL__SMCLK       (0x80)
+#define UCSYNC              (0x01)
+#define UCMODE_0            (0x00)
+#define UCMODE_3            (0x06)
+#define UCMST               (0x08)
+#define UC7BIT              (0x10)
+#define UCMSB               (0x20)
+#define UCCKPL              (0x40)
+#define UCCKPH              (0x80)
+#define UCBRS_5             (0x0A)
+#define UCBRF_0             (0x00)
+#define UCBUSY              (0x01)
+#define UCBBUSY             (0x10)
+#define UCRXIE              (0x01)
+#define UCTXIE              (0x02)
+#define UCSTTIE             (0x04)
+#define UCSTPIE             (0x08)
+#define UCALIE              (0x10)
+#define UCNACKIE            (0x20)
+#define UCRXIFG             (0x01)
+#define UCTXIFG             (0x02)
+#define UCSTTIFG            (0x04)
+#define UCSTPIFG            (0x08)
+#define UCNACKIFG           (0x20)
+
+/************************************************************
+* WATCHDOG TIMER A
+************************************************************/
+HOST_REG16(WDTCTL)
+
+#define WDTIS0              (0x0001)
+#define WDTIS1              (0x0002)
+#define WDTIS2              (0x0004)
+#define WDTCNTCL            (0x0008)
+#define WDTTMSEL            (0x0010)
+#define WDTSSEL0            (0x0020)
+#define WDTSSEL1            (0x0040)
+#define WDTHOLD             (0x0080)
+#define WDTPW               (0x5A00)
+#define WDTIS_0             (0x0000)
+#define WDTIS_1             (0x0001)
+#define WDTIS_2             (0x0002)
+#define WDTIS_3             (0x0003)
+#define WDTIS_4             (0x0004)
+#define WDTIS_5             (0x0005)
+#define WDTSSEL__SMCLK      (0x0000)
+#define WDTSSEL__ACLK       (0x0020)
+
+/************************************************************
+* TLV descriptors
+************************************************************/
+#define TLV_START           (0x1A08)
+#define TLV_END             (0x1AFF)
+
+/************************************************************
+* Interrupt Vectors (offset from 0xFF80)
+************************************************************/
+#define RTC_VECTOR          (41 * 2u)
+#define PORT2_VECTOR        (42 * 2u)
+#define USCI_B3_VECTOR      (43 * 2u)
+#define USCI_A3_VECTOR      (44 * 2u)
+#define USCI_B1_VECTOR      (45 * 2u)
+#define USCI_A1_VECTOR      (46 * 2u)
+#define PORT1_VECTOR        (47 * 2u)
+#define TIMER1_A1_VECTOR    (48 * 2u)
+#define TIMER1_A0_VECTOR    (49 * 2u)
+#define DMA_VECTOR          (50 * 2u)
+#define USCI_B2_VECTOR      (51 * 2u)
+#define USCI_A2_VECTOR      (52 * 2u)
+#define TIMER0_A1_VECTOR    (53 * 2u)
+#define TIMER0_A0_VECTOR    (54 * 2u)
+#define ADC12_VECTOR        (55 * 2u)
+#define USCI_B0_VECTOR      (56 * 2u)
+#define USCI_A0_VECTOR      (57 * 2u)
+#define WDT_VECTOR          (58 * 2u)
+#define TIMER0_B1_VECTOR    (59 * 2u)
+#define TIMER0_B0_VECTOR    (60 * 2u)
+#define UNMI_VECTOR         (61 * 2u)
+#define SYSNMI_VECTOR       (62 * 2u)
+#define RESET_VECTOR        (63 * 2u)
+
+#endif /* HOST_MSP430_H */
@@ -0,0 +1,186 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestButtonFlood.c
+ *
+ * Button A on an app screen goes back to the idle screen. It is pressed
+ * while the phone is quiet and while the phone floods the display queue
+ * with app rows and repaints, kept FLOOD_DEPTH deep; the time from the
+ * press to the first idle line on the LCD is taken each time.
+ *
+ * Most of it is the debounce (BTN_ON_COUNT ticks of the 32 Hz RTC
+ * interrupt), so the presses are spread over its phase. Under flood the
+ * press may wait for the bulk message being handled and for nothing else:
+ * the worst press is at most one repaint later than the worst quiet one.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "Messages.h"
+#include "hal_board_type.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Wrapper.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "SharpLcd.h"
+
+extern xQueueHandle QueueHandles[];
+
+/* below the status bar, where the idle screen differs from the pattern */
+#define PROBE_ROW               (60)
+#define FLOOD_DEPTH             (24)
+#define PRESS_NUM               (8)
+
+/* one 32 Hz RTC tick apart over the presses */
+#define PRESS_STEP_MS           (1000 / 32 / PRESS_NUM)
+#define PRESS_TIMEOUT_MS        (2000)
+#define RELEASE_MS              (300)
+
+static unsigned char Line[1 + BYTES_PER_LINE];
+static unsigned char FloodRow;
+
+static unsigned long long PressAt;
+static unsigned long long SeenAt;
+
+static void Pattern(unsigned char Row)
+{
+  unsigned char i;
+
+  Line[0] = Row;
+  for (i = 0; i < BYTES_PER_LINE; ++i) Line[1 + i] = Row * 13 + i * 7 + 1;
+}
+
+/* the first line off the app screen after the press */
+static void LcdLine(unsigned char Row, unsigned long long At)
+{
+  unsigned char Data[SHARP_LCD_LINE_BYTES];
+  unsigned char i;
+
+  if (Row != PROBE_ROW || !PressAt || SeenAt) return;
+
+  SharpLcdReadRow(Row, Data);
+  for (i = 0; i < BYTES_PER_LINE; ++i)
+  {
+    if (Data[i] != (unsigned char)(Row * 13 + i * 7 + 1)) break;
+  }
+  if (i < BYTES_PER_LINE) SeenAt = At;
+}
+
+/* every app row and a repaint; the cycles the repaint took */
+static unsigned long long ShowApp(void)
+{
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Pattern(Row);
+    HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+  }
+  HostWaitIdle();
+
+  unsigned long long Start = HostCycles;
+  HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  HostWaitIdle();
+
+  Pattern(PROBE_ROW);
+  HOST_CHECK(HostLcdRowIs(PROBE_ROW, Line + 1));
+  return HostCycles - Start;
+}
+
+/* the app keeps redrawing: a row (the same pixels) and a repaint */
+static void TopUp(void)
+{
+  while (QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting < FLOOD_DEPTH)
+  {
+    Pattern(FloodRow++ % LCD_ROW_NUM);
+    HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+    HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  }
+}
+
+/* us from the press to the idle screen */
+static unsigned long Press(unsigned char Flood, unsigned int DelayMs)
+{
+  ShowApp();
+  HostWait(DelayMs);
+  if (Flood) TopUp();
+
+  SeenAt = 0;
+  PressAt = HostCycles;
+  HostButton(SW_A, TRUE);
+
+  while (!SeenAt)
+  {
+    HOST_CHECK(HostCycles - PressAt < HOST_US_TO_CYCLES(PRESS_TIMEOUT_MS * 1000UL));
+    HostWait(1);
+    if (Flood) TopUp();
+  }
+
+  unsigned long Us = HOST_CYCLES_TO_US(SeenAt - PressAt);
+  PressAt = 0;
+
+  HostButton(SW_A, FALSE);
+  HostWait(RELEASE_MS);
+  HostWaitIdle();
+  return Us;
+}
+
+static void Script(void)
+{
+  unsigned long Quiet = 0, Flooded = 0;
+  unsigned long long Repaint;
+  unsigned char i;
+
+  /* the end of the splash screen turns the buttons on */
+  HostSend(BluetoothStateChangeMsg, Connect, NULL, 0);
+  HostWaitIdle();
+
+  pSharpLcdLine = LcdLine;
+  Repaint = ShowApp();
+
+  printf("press    quiet us  flood us\n");
+  for (i = 0; i < PRESS_NUM; ++i)
+  {
+    unsigned long Q = Press(FALSE, i * PRESS_STEP_MS);
+    unsigned long F = Press(TRUE, i * PRESS_STEP_MS);
+
+    printf("%5u %11lu %9lu\n", i, Q, F);
+    if (Q > Quiet) Quiet = Q;
+    if (F > Flooded) Flooded = F;
+  }
+
+  /* what a message at the back of the flood waits */
+  unsigned long long Start = HostCycles;
+  TopUp();
+  HostWaitIdle();
+
+  printf("worst %11lu %9lu (repaint %llu us, flood %llu us deep)\n", Quiet, Flooded,
+    HOST_CYCLES_TO_US(Repaint), HOST_CYCLES_TO_US(HostCycles - Start));
+
+  HOST_CHECK(Flooded <= Quiet + HOST_CYCLES_TO_US(Repaint) + 1000);
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
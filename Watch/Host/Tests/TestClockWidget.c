@@ -0,0 +1,130 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestClockWidget.c
+ *
+ * Clock widgets are found through the quads of the page shown (Widget.c
+ * PageQuad), so what another page or another widget holds must not change
+ * how a clock is drawn:
+ *
+ * - two clocks with the same clock id on different pages each draw their
+ *   own face: the screen is the same as with the clock alone in the list;
+ * - a clock whose first quad is covered by a later widget still draws its
+ *   other quad.
+ *
+ * Each screen is compared with one rendered in the same minute.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Widget.h"
+#include "HostBoard.h"
+#include "SharpLcd.h"
+
+/* idle page of a widget layout */
+#define PAGE(_p)                ((_p) << 4)
+#define LAYOUT(_Page, _Type, _Quad) (PAGE(_Page) | (_Type) << LAYOUT_SHFT | (_Quad))
+
+#define CLOCK_ID_ONE            (0x01)
+#define CLOCK_ID_TWO            (0x02)
+#define WIDGET_ID               (0x20)
+
+typedef unsigned char tScreen[SHARP_LCD_ROWS][SHARP_LCD_LINE_BYTES];
+
+/* one part of one */
+static void SetList(unsigned char const *pList, unsigned char Length)
+{
+  HostSend(SetWidgetListMsg, 1 << 2, pList, Length);
+}
+
+static void Show(unsigned char Page, tScreen Screen)
+{
+  HostSend(UpdateDisplayMsg, MSG_OPT_NEWUI | MSG_OPT_SET_PAGE | Page << SET_PAGE_SHFT | IDLE_MODE,
+           NULL, 0);
+  HostWaitIdle();
+  memcpy(Screen, SharpLcdMemory, sizeof(tScreen));
+}
+
+/* a one quad clock on page 0, a four quad clock with the same id on page 1 */
+static void ClockOnOtherPage(void)
+{
+  static unsigned char const Quad[] =
+    {CLOCK_ID_ONE, LAYOUT(0, LAYOUT_QUAD_SCREEN, 0)};
+  static unsigned char const Full[] =
+    {CLOCK_ID_ONE, LAYOUT(1, LAYOUT_FULL_SCREEN, 0)};
+  static unsigned char const Both[] =
+    {CLOCK_ID_ONE, LAYOUT(0, LAYOUT_QUAD_SCREEN, 0),
+     CLOCK_ID_ONE, LAYOUT(1, LAYOUT_FULL_SCREEN, 0)};
+  static tScreen QuadScreen, FullScreen, Alone;
+
+  /* both clocks are new here: nothing has drawn them yet */
+  SetList(Both, sizeof(Both));
+  Show(1, FullScreen);
+  Show(0, QuadScreen);
+
+  SetList(Full, sizeof(Full));
+  Show(1, Alone);
+  HOST_CHECK(memcmp(FullScreen, Alone, sizeof(tScreen)) == 0);
+  SetList(Quad, sizeof(Quad));
+  Show(0, Alone);
+  HOST_CHECK(memcmp(QuadScreen, Alone, sizeof(tScreen)) == 0);
+}
+
+/* a two quad clock across the top with a widget over its left quad */
+static void ClockUnderWidget(void)
+{
+  static unsigned char const Covered[] =
+    {CLOCK_ID_TWO, LAYOUT(0, LAYOUT_HORI_SCREEN, 0),
+     WIDGET_ID, LAYOUT(0, LAYOUT_QUAD_SCREEN, 0)};
+  static unsigned char const Alone[] =
+    {CLOCK_ID_TWO, LAYOUT(0, LAYOUT_HORI_SCREEN, 0)};
+  static tScreen Screen, ClockAlone;
+  unsigned char Row;
+
+  /* the clock is new here: nothing has drawn it yet */
+  SetList(Covered, sizeof(Covered));
+  Show(0, Screen);
+  SetList(Alone, sizeof(Alone));
+  Show(0, ClockAlone);
+
+  for (Row = 0; Row < HALF_SCREEN_ROWS; ++Row)
+  {
+    HOST_CHECK(memcmp(Screen[Row] + BYTES_PER_QUAD_LINE, ClockAlone[Row] + BYTES_PER_QUAD_LINE,
+                      BYTES_PER_QUAD_LINE) == 0);
+  }
+}
+
+static void Script(void)
+{
+  unsigned char DrawTop = 1;
+
+  HostWaitIdle();
+  HostSend(ControlFullScreenMsg, 0, &DrawTop, sizeof(DrawTop));
+
+  ClockOnOtherPage();
+  ClockUnderWidget();
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
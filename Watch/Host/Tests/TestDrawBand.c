@@ -0,0 +1,275 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestDrawBand.c
+ *
+ * A text is drawn into its rows read from the serial ram at once and written
+ * back at once (OpenSramBand). The test is built three times: as the
+ * firmware is, without the line cache (bitmaps get a band of their own too)
+ * and with SRAM_DRAW_BAND and SRAM_LINE_CACHE 0, the old row by row draw.
+ * Every case is drawn over a pattern, shown, and the whole LCD is appended
+ * to the file named on the command line; the files must be the same
+ * (DrawBandSame). The serial ram transactions and the time of each draw are
+ * printed.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Fonts.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "Sram23k.h"
+#include "SharpLcd.h"
+
+#define SRAM_BYTE_CYCLES        (16)
+
+/* what fits in a single message after the header */
+#define SINGLE_BYTES            (MSG_PAYLOAD_LENGTH - DRAW_INFO_SIZE)
+
+#define BMP_WIDTH               (40)
+#define BMP_ROW_BYTES           (BMP_WIDTH / 8)
+#define BMP_ROWS                (24)
+#define BMP_BYTES               (BMP_ROW_BYTES * BMP_ROWS)
+
+#define WIDE_WIDTH              (88)
+
+/* splits the bitmap rows across messages */
+#define BMP_FRAGMENT            (7)
+
+static FILE *pScreens;
+static unsigned char Bitmap[BMP_BYTES];
+
+static unsigned long Transactions;
+static unsigned long long Cycles;
+static unsigned long long Bus;
+
+static void Pattern(unsigned char Mode)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+  unsigned char i;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    for (i = 0; i < BYTES_PER_LINE; ++i) Line[1 + i] = Row * 13 + i * 7 + Mode;
+    HostSend(WriteBufferMsg, Mode, Line, sizeof(Line));
+  }
+  HostWaitIdle();
+}
+
+static void MakeBitmap(unsigned char Seed)
+{
+  unsigned int i;
+
+  for (i = 0; i < BMP_BYTES; ++i) Bitmap[i] = i * 29 + Seed * 7 + 1;
+}
+
+static void SetHeader(Draw_t *pInfo, unsigned char Id, unsigned char X, unsigned char Y,
+                      unsigned char Opt)
+{
+  memset(pInfo, 0, DRAW_INFO_SIZE);
+  pInfo->Id = Id;
+  pInfo->X = X;
+  pInfo->Y = Y;
+  pInfo->Opt = Opt;
+}
+
+/* a text in messages of up to SINGLE_BYTES characters */
+static void SendText(unsigned char Mode, unsigned char Font, unsigned char X,
+                     unsigned char Y, unsigned char Opt, char const *pText)
+{
+  unsigned char Data[MSG_PAYLOAD_LENGTH];
+  unsigned char Length = strlen(pText);
+  unsigned char Flags = DRAW_MSG_BEGIN;
+  unsigned char Offset = 0;
+
+  SetHeader((Draw_t *)Data, DRAW_ID_TYPE_TEXT | Font, X, Y, Opt);
+  ((Draw_t *)Data)->Width = LCD_COL_NUM - X;
+  ((Draw_t *)Data)->TextLen = Length;
+
+  do
+  {
+    unsigned char Header = Flags & DRAW_MSG_BEGIN ? DRAW_INFO_SIZE : 0;
+    unsigned char Part = Length - Offset;
+
+    if (Part > MSG_PAYLOAD_LENGTH - Header) Part = MSG_PAYLOAD_LENGTH - Header;
+    if (Offset + Part == Length) Flags |= DRAW_MSG_END;
+
+    memcpy(Data + Header, pText + Offset, Part);
+    HostSend(DrawMsg, Flags | Mode << 6, Data, Header + Part);
+    Offset += Part;
+    Flags = 0;
+  }
+  while (Offset < Length);
+}
+
+/* Bitmap, Rows high, in fragments of up to Fragment bytes */
+static void SendBitmap(unsigned char Mode, unsigned char X, unsigned char Y, unsigned char Opt,
+                       unsigned char Width, unsigned char Rows, unsigned char Fragment)
+{
+  unsigned char Data[MSG_PAYLOAD_LENGTH];
+  unsigned int Length = WIDTH_IN_BYTES(Width) * Rows;
+  unsigned int Offset = 0;
+  unsigned char Flags = DRAW_MSG_BEGIN;
+
+  SetHeader((Draw_t *)Data, DRAW_ID_TYPE_BMP, X, Y, Opt);
+  ((Draw_t *)Data)->Width = Width;
+  ((Draw_t *)Data)->Height = Rows;
+
+  do
+  {
+    unsigned char Header = Flags & DRAW_MSG_BEGIN ? DRAW_INFO_SIZE : 0;
+    unsigned int Part = Length - Offset;
+
+    if (Part > Fragment) Part = Fragment;
+    if (Part > MSG_PAYLOAD_LENGTH - Header) Part = MSG_PAYLOAD_LENGTH - Header;
+    if (Offset + Part == Length) Flags |= DRAW_MSG_END;
+
+    memcpy(Data + Header, Bitmap + Offset, Part);
+    HostSend(DrawMsg, Flags | Mode << 6, Data, Header + Part);
+    Offset += Part;
+    Flags = 0;
+  }
+  while (Offset < Length);
+}
+
+static void Start(void)
+{
+  HostWaitIdle();
+  Transactions = Sram23kStats.Transactions;
+  Bus = Sram23kStats.Bytes;
+  Cycles = HostCycles;
+}
+
+/* the draw's cost; the screen shown and appended to the file */
+static void Stop(char const *pName, unsigned char Mode)
+{
+  static unsigned char Last[LCD_ROW_NUM][SHARP_LCD_LINE_BYTES];
+  unsigned char Screen[LCD_ROW_NUM][SHARP_LCD_LINE_BYTES];
+  unsigned char Row;
+
+  HostWaitIdle();
+  Cycles = HostCycles - Cycles;
+  Transactions = Sram23kStats.Transactions - Transactions;
+  Bus = (unsigned long long)(Sram23kStats.Bytes - Bus) * SRAM_BYTE_CYCLES;
+
+printf("%-16s %12lu %8llu %8llu\n", pName, Transactions,
+         HOST_CYCLES_TO_US(Bus), HOST_CYCLES_TO_US(Cycles));
+
+  HostSend(UpdateDisplayMsg, Mode, NULL, 0);
+  HostWaitIdle();
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row) SharpLcdReadRow(Row, Screen[Row]);
+  HOST_CHECK(fwrite(Screen, sizeof(Screen), 1, pScreens) == 1);
+
+  /* each case draws something */
+  HOST_CHECK(memcmp(Screen, Last, sizeof(Screen)));
+  memcpy(Last, Screen, sizeof(Screen));
+}
+
+static void Script(void)
+{
+  HostWaitIdle();
+  Pattern(NOTIF_MODE);
+  Pattern(APP_MODE);
+  HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  HostWaitIdle();
+  size_t Free = xPortGetFreeHeapSize();
+
+  printf("draw             transactions  bus us   draw us\n");
+
+  Start();
+  SendText(APP_MODE, MetaWatch16, 0, 0, DRAW_OPT_SET, "Band 0,0");
+  Stop("16 set", APP_MODE);
+
+  Start();
+  SendText(APP_MODE, MetaWatch7, 3, 20, DRAW_OPT_OR, "odd x, or");
+  Stop("7 or", APP_MODE);
+
+  Start();
+  SendText(APP_MODE, MetaWatch5, 5, 31, DRAW_OPT_NOT, "NOT 5 PIXELS HIGH");
+  Stop("5 not", APP_MODE);
+
+  Start();
+  SendText(APP_MODE, Time, 1, 40, DRAW_OPT_DST_NOT, "12:34");
+  Stop("time dst not", APP_MODE);
+
+  Start();
+  SendText(APP_MODE, MetaWatch7, 0, 62, DRAW_OPT_SET,
+           "a text longer than one message is collected first");
+  Stop("7 multipart", APP_MODE);
+
+  /* clipped at the right edge and at the bottom */
+  Start();
+  SendText(APP_MODE, MetaWatch16, 70, 88, DRAW_OPT_SET, "edge");
+  Stop("16 clipped", APP_MODE);
+
+  /* narrow bitmaps are drawn row by row when there is no line cache */
+  MakeBitmap(1);
+  Start();
+  SendBitmap(APP_MODE, 13, 72, DRAW_OPT_SET, 8, SINGLE_BYTES, SINGLE_BYTES);
+  Stop("bitmap single", APP_MODE);
+
+  MakeBitmap(2);
+  Start();
+  SendBitmap(APP_MODE, 44, 10, DRAW_OPT_NOT, BMP_WIDTH, BMP_ROWS, BMP_FRAGMENT);
+  Stop("bitmap stream", APP_MODE);
+
+  /* wide enough for a band of its own */
+  MakeBitmap(3);
+  Start();
+  SendBitmap(APP_MODE, 3, 76, DRAW_OPT_OR, WIDE_WIDTH, BMP_BYTES / WIDTH_IN_BYTES(WIDE_WIDTH),
+             MSG_PAYLOAD_LENGTH);
+  Stop("bitmap wide", APP_MODE);
+
+  /* no band is left open */
+  HOST_CHECK(xPortGetFreeHeapSize() == Free);
+
+  /* a notification goes over the app screen (and keeps its page read ahead
+   * on the heap), so it comes last */
+  Start();
+  SendText(NOTIF_MODE, MetaWatch16, 9, 50, DRAW_OPT_OR, "Notif");
+  Stop("16 notif", NOTIF_MODE);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s screens\n", argv[0]);
+    return 2;
+  }
+
+  pScreens = fopen(argv[1], "wb");
+  if (!pScreens)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  int Status = HostRun(Script);
+
+  fclose(pScreens);
+  return Status;
+}
@@ -0,0 +1,168 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestHeapCapture.c
+ *
+ * Records a phone session with the trace, heap operations included, and
+ * writes the "tdump" to the file given on the command line for
+ * Tools/HeapReplay. Message buffers come from the pool, so the heap is
+ * used by the draws: texts of varied lengths are collected in heap buffers
+ * over several messages with repaints between the parts, and every other
+ * one is left open to be abandoned by the next.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Fonts.h"
+#include "Trace.h"
+#include "HostBoard.h"
+
+#define ROUNDS                  (6)
+#define MSG_GAP_MS              (2)
+#define ROUND_GAP_MS            (40)
+#define TEXT_Y                  (30)
+
+#define TEXT_PART               (MSG_PAYLOAD_LENGTH - DRAW_INFO_SIZE)
+
+static unsigned char const TextLen[] = {40, 180, 24, 120, 250, 64, 8, 200, 96};
+
+static FILE *pCapture;
+static char Line[256];
+static unsigned int LineLen;
+static unsigned int Operations;
+
+static void Capture(char Out)
+{
+  unsigned int Tick, Type, Ops, Length;
+
+  if (Out == '\r') return;
+  fputc(Out, pCapture);
+
+  if (Out != '\n')
+  {
+    if (LineLen < sizeof(Line) - 1) Line[LineLen++] = Out;
+    return;
+  }
+
+  Line[LineLen] = '\0';
+  LineLen = 0;
+
+  /* heap slots after the time stamp */
+  char const *pSlot = strchr(Line, ' ');
+  if (pSlot && sscanf(pSlot, " %u H %2x %2x %u:", &Tick, &Type, &Ops, &Length) == 4 &&
+      Type == 'O') Operations += Ops;
+}
+
+/* Length characters of a TextLen text; the header goes with the first */
+static void SendText(unsigned char Flags, unsigned char TextLen, unsigned char Length)
+{
+  unsigned char Data[MSG_PAYLOAD_LENGTH];
+  unsigned char Header = Flags & DRAW_MSG_BEGIN ? DRAW_INFO_SIZE : 0;
+  unsigned char i;
+
+  if (Header)
+  {
+    Draw_t *pInfo = (Draw_t *)Data;
+
+    memset(Data, 0, DRAW_INFO_SIZE);
+    pInfo->Id = DRAW_ID_TYPE_TEXT | MetaWatch16;
+    pInfo->X = 4;
+    pInfo->Y = TEXT_Y;
+    pInfo->Width = LCD_COL_NUM - 8;
+    pInfo->TextLen = TextLen;
+  }
+
+  for (i = 0; i < Length; ++i) Data[Header + i] = 'a' + (TextLen + i) % 26;
+  HostSend(DrawMsg, Flags | APP_MODE << 6, Data, Header + Length);
+  HostWait(MSG_GAP_MS);
+}
+
+/* the parts sent meanwhile would wait in the staging ring */
+static void Repaint(void)
+{
+  HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  HostWaitIdle();
+}
+
+static void Script(void)
+{
+  unsigned char Round;
+
+  HostWaitIdle();
+  ToggleTrace();
+
+  for (Round = 0; Round < ROUNDS; ++Round)
+  {
+    unsigned char Len = TextLen[Round % sizeof(TextLen)];
+    unsigned char Sent = Len < TEXT_PART ? Len : TEXT_PART;
+
+    SendText(DRAW_MSG_BEGIN, Len, Sent);
+    Repaint();
+
+    if (Round & 1)
+    {
+      do
+      {
+        unsigned char Part = Len - Sent < MSG_PAYLOAD_LENGTH ? Len - Sent : MSG_PAYLOAD_LENGTH;
+
+        Sent += Part;
+        SendText(Sent == Len ? DRAW_MSG_END : 0, Len, Part);
+      }
+      while (Sent < Len);
+      Repaint();
+    }
+
+    HostWait(ROUND_GAP_MS);
+  }
+
+  HostWaitIdle();
+  ToggleTrace();
+
+  pHostConsole = Capture;
+  DumpTrace();
+  pHostConsole = NULL;
+
+  /* a text buffer each round, freed, and the repaints' */
+  HOST_CHECK(Operations > ROUNDS * 2);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s capture\n", argv[0]);
+    return 2;
+  }
+
+  pCapture = fopen(argv[1], "w");
+  if (!pCapture)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  int Status = HostRun(Script);
+
+  fclose(pCapture);
+  return Status;
+}
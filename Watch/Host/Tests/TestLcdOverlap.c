@@ -0,0 +1,153 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestLcdOverlap.c
+ *
+ * UpdateDisplayHandler and DrawWidgetToLcd read the next lines from the
+ * serial RAM while the LCD DMA sends the previous ones. The LCD model gets
+ * each byte when the DMA clocks it out, so a line buffer refilled too early
+ * shows up on the screen. The refresh must take less than the LCD and the
+ * serial RAM transfers one after the other, by at least the reads that
+ * overlap the LCD.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Widget.h"
+#include "hal_serial_ram.h"
+#include "HostCpu.h"
+#include "HostBoard.h"
+#include "Sram23k.h"
+#include "SharpLcd.h"
+
+/* the watch draws its status bar over the top of an app screen */
+#define STATUS_BAR_ROWS         (12)
+
+#define SRAM_BYTE_CYCLES        (16)
+#define LCD_BYTE_CYCLES         (128)
+
+/* a full screen goes out in bursts of 8 lines (SerialRam.c); all but the
+ * first burst is read while the one before it is sent */
+#define BURST_LINES             (8)
+#define BURST_READ_CYCLES       ((BURST_LINES * BYTES_PER_LINE + SRAM_READ_OVERHEAD) * SRAM_BYTE_CYCLES)
+#define HIDDEN_CYCLES           ((LCD_ROW_NUM / BURST_LINES - 1) * BURST_READ_CYCLES)
+
+#define WIDGET_ID(_q)           (0x20 + (_q))
+#define WIDGET_LINES            (4)
+
+static void Pattern(unsigned char Row, unsigned char *pData)
+{
+  unsigned char i;
+
+  for (i = 0; i < BYTES_PER_LINE; ++i) pData[i] = Row * 13 + i * 7 + 1;
+}
+
+/* route an update and check that it overlaps the two buses */
+static void Refresh(char const *pName, unsigned char Options)
+{
+  unsigned long long Start = HostCycles;
+  unsigned long SramBytes = Sram23kStats.Bytes;
+  unsigned long LcdBytes = SharpLcdStats.Bytes;
+
+  HostSend(UpdateDisplayMsg, Options, NULL, 0);
+  HostWaitIdle();
+
+  unsigned long long Elapsed = HostCycles - Start;
+  unsigned long long Sram = (unsigned long long)(Sram23kStats.Bytes - SramBytes) * SRAM_BYTE_CYCLES;
+  unsigned long long Lcd = (unsigned long long)(SharpLcdStats.Bytes - LcdBytes) * LCD_BYTE_CYCLES;
+
+  printf("%s: %llu us, lcd %llu us, serial ram %llu us, hidden %llu us\n", pName,
+         HOST_CYCLES_TO_US(Elapsed), HOST_CYCLES_TO_US(Lcd), HOST_CYCLES_TO_US(Sram),
+         HOST_CYCLES_TO_US(Lcd + Sram - Elapsed));
+
+  HOST_CHECK(Lcd && Sram);
+  HOST_CHECK(Elapsed + HIDDEN_CYCLES <= Lcd + Sram);
+}
+
+static void AppScreen(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    Pattern(Row, Line + 1);
+    HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+  }
+  HostWaitIdle();
+
+  Refresh("app screen", APP_MODE);
+
+  for (Row = STATUS_BAR_ROWS; Row < LCD_ROW_NUM; ++Row)
+  {
+    Pattern(Row, Line);
+    HOST_CHECK(HostLcdRowIs(Row, Line));
+  }
+}
+
+/* four quad widgets on idle page 0 */
+static void WidgetPage(void)
+{
+  unsigned char List[QUAD_NUM * 2];
+  unsigned char Data[2 + WIDGET_LINES * BYTES_PER_QUAD_LINE];
+  unsigned char DrawTop = 1;
+  unsigned char Quad, Row;
+
+  HostSend(ControlFullScreenMsg, 0, &DrawTop, sizeof(DrawTop));
+
+  for (Quad = 0; Quad < QUAD_NUM; ++Quad)
+  {
+    List[Quad * 2] = WIDGET_ID(Quad);
+    List[Quad * 2 + 1] = LAYOUT_QUAD_SCREEN << LAYOUT_SHFT | Quad;
+  }
+  HostSend(SetWidgetListMsg, 1 << 2, List, sizeof(List));
+
+  for (Quad = 0; Quad < QUAD_NUM; ++Quad)
+  {
+    for (Row = 0; Row < QUAD_ROW_NUM; Row += WIDGET_LINES)
+    {
+      Data[0] = WIDGET_ID(Quad);
+      Data[1] = Row;
+      memset(Data + 2, Quad * 0x11 + Row, sizeof(Data) - 2);
+      HostSend(WriteBufferMsg, MSG_OPT_NEWUI | IDLE_MODE, Data, sizeof(Data));
+    }
+  }
+  HostWaitIdle();
+
+  Refresh("widget page", MSG_OPT_NEWUI | IDLE_MODE);
+}
+
+static void Script(void)
+{
+  HostWaitIdle();
+
+  /* the idle page first: the app screen leaves idle mode */
+  WidgetPage();
+  AppScreen();
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
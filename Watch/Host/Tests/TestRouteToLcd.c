@@ -0,0 +1,70 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestRouteToLcd.c
+ *
+ * A message routed like the wrapper task routes the phone's: the pixels of
+ * a WriteBufferMsg and an UpdateDisplayMsg end up on the LCD.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "HostBoard.h"
+
+/* the watch draws its status bar over the top of an app screen */
+#define STATUS_BAR_ROWS         (12)
+
+/* a different pattern on every row */
+static void Pattern(unsigned char Row, unsigned char *pData)
+{
+  unsigned char i;
+
+  for (i = 0; i < BYTES_PER_LINE; ++i) pData[i] = Row * 13 + i * 7 + 1;
+}
+
+static void Script(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Row;
+
+  /* let the display task finish booting */
+  HostWaitIdle();
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    Pattern(Row, Line + 1);
+    HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+  }
+  HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  HostWaitIdle();
+
+  for (Row = STATUS_BAR_ROWS; Row < LCD_ROW_NUM; ++Row)
+  {
+    Pattern(Row, Line);
+    HOST_CHECK(HostLcdRowIs(Row, Line));
+  }
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
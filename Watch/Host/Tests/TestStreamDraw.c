@@ -0,0 +1,252 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestStreamDraw.c
+ *
+ * Multipart DrawMsg bitmaps are drawn row by row from the message buffers
+ * as they come (DrawHandler.c). On an app screen:
+ *
+ * - however the payload is split, rows split across messages included, the
+ *   bitmap comes out the same and nothing is left on the heap;
+ * - a transfer that ends short draws the whole rows it got and nothing
+ *   else, and data that comes after it with no transfer is dropped;
+ * - a BEGIN in the middle of a transfer abandons it (a collected payload is
+ *   freed) and the new one is drawn.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Fonts.h"
+#include "HostBoard.h"
+
+/* below the status bar, byte aligned */
+#define BMP_X                   (16)
+#define BMP_Y                   (24)
+#define BMP_WIDTH               (40)
+#define BMP_ROW_BYTES           (BMP_WIDTH / 8)
+#define BMP_ROWS                (16)
+#define BMP_BYTES               (BMP_ROW_BYTES * BMP_ROWS)
+
+#define OTHER_Y                 (BMP_Y + BMP_ROWS + 8)
+
+#define MAX_FRAGMENT            (MSG_PAYLOAD_LENGTH)
+
+static unsigned char Bitmap[BMP_BYTES];
+
+static void MakeBitmap(unsigned char Seed)
+{
+  unsigned int i;
+
+  for (i = 0; i < BMP_BYTES; ++i) Bitmap[i] = i * 29 + Seed * 7 + 1;
+}
+
+static void ClearApp(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE] = {0};
+  unsigned char Row;
+
+  for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+  {
+    Line[0] = Row;
+    HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+  }
+}
+
+static void Show(void)
+{
+  HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+  HostWaitIdle();
+}
+
+/* the first Rows rows of the bitmap are at Y, the rest of the rows blank */
+static unsigned char BitmapIs(unsigned char Y, unsigned char Rows)
+{
+  unsigned char Line[BYTES_PER_LINE];
+  unsigned char Row;
+
+  for (Row = 0; Row < BMP_ROWS; ++Row)
+  {
+    memset(Line, 0, sizeof(Line));
+    if (Row < Rows) memcpy(Line + BMP_X / 8, Bitmap + Row * BMP_ROW_BYTES, BMP_ROW_BYTES);
+    if (!HostLcdRowIs(Y + Row, Line)) return FALSE;
+  }
+
+  return TRUE;
+}
+
+/* Length bytes of the bitmap from Offset; the first message carries the
+ * header */
+static void SendPart(unsigned char Y, unsigned char Flags, unsigned int Offset, unsigned int Length)
+{
+  unsigned char Data[MSG_PAYLOAD_LENGTH];
+  unsigned char Header = Flags & DRAW_MSG_BEGIN ? DRAW_INFO_SIZE : 0;
+
+  if (Header)
+  {
+    Draw_t *pInfo = (Draw_t *)Data;
+
+    memset(Data, 0, DRAW_INFO_SIZE);
+    pInfo->Id = DRAW_ID_TYPE_BMP;
+    pInfo->X = BMP_X;
+    pInfo->Y = Y;
+    pInfo->Opt = DRAW_OPT_SET;
+    pInfo->Width = BMP_WIDTH;
+    pInfo->Height = BMP_ROWS;
+  }
+
+  memcpy(Data + Header, Bitmap + Offset, Length);
+  HostSend(DrawMsg, Flags | APP_MODE << 6, Data, Header + Length);
+}
+
+/* the bitmap in fragments of the sizes in pSplit (used in turn), up to End */
+static void SendBitmap(unsigned char Y, unsigned char const *pSplit, unsigned int End)
+{
+  unsigned int Offset = 0;
+  unsigned char Flags = DRAW_MSG_BEGIN;
+  unsigned char i = 0;
+
+  do
+  {
+    unsigned int Length = pSplit[i++];
+    if (pSplit[i] == 0) i = 0;
+
+    /* the header leaves less room in the first message */
+    if (Flags & DRAW_MSG_BEGIN && Length > MAX_FRAGMENT - DRAW_INFO_SIZE)
+      Length = MAX_FRAGMENT - DRAW_INFO_SIZE;
+    if (Length > End - Offset) Length = End - Offset;
+    if (Offset + Length == End) Flags |= DRAW_MSG_END;
+
+    SendPart(Y, Flags, Offset, Length);
+    Offset += Length;
+    Flags = 0;
+  }
+  while (Offset < End);
+}
+
+static void FragmentOrder(void)
+{
+  /* rows are BMP_ROW_BYTES (5): these split them everywhere */
+  static unsigned char const Splits[][4] =
+  {
+    {MAX_FRAGMENT}, {1}, {3}, {7, 2}, {4, 11, 6}, {BMP_ROW_BYTES}
+  };
+  unsigned char i;
+
+  for (i = 0; i < sizeof(Splits) / sizeof(Splits[0]); ++i)
+  {
+    ClearApp();
+    MakeBitmap(i);
+    HostWaitIdle();
+
+    size_t Free = xPortGetFreeHeapSize();
+    SendBitmap(BMP_Y, Splits[i], BMP_BYTES);
+    HostWaitIdle();
+    HOST_CHECK(xPortGetFreeHeapSize() == Free);
+
+    Show();
+    HOST_CHECK(BitmapIs(BMP_Y, BMP_ROWS));
+  }
+}
+
+static void Truncated(void)
+{
+  static unsigned char const Split[] = {7, 0};
+  unsigned char Rows = 5;
+
+  ClearApp();
+  MakeBitmap(10);
+
+  /* half a row more than Rows: the half row is not drawn */
+  SendBitmap(BMP_Y, Split, Rows * BMP_ROW_BYTES + BMP_ROW_BYTES / 2);
+  Show();
+  HOST_CHECK(BitmapIs(BMP_Y, Rows));
+
+  /* the rest coming late has no transfer to go to */
+  SendPart(BMP_Y, 0, Rows * BMP_ROW_BYTES + BMP_ROW_BYTES / 2, BMP_ROW_BYTES * 3);
+  SendPart(BMP_Y, DRAW_MSG_END, Rows * BMP_ROW_BYTES, MAX_FRAGMENT);
+  Show();
+  HOST_CHECK(BitmapIs(BMP_Y, Rows));
+
+  /* and the next transfer is not disturbed */
+  ClearApp();
+  SendBitmap(BMP_Y, Split, BMP_BYTES);
+  Show();
+  HOST_CHECK(BitmapIs(BMP_Y, BMP_ROWS));
+}
+
+static void SendText(unsigned char Flags, char const *pText, unsigned char TextLen,
+                     unsigned char Length)
+{
+  unsigned char Data[MSG_PAYLOAD_LENGTH];
+  Draw_t *pInfo = (Draw_t *)Data;
+
+  memset(Data, 0, DRAW_INFO_SIZE);
+  pInfo->Id = DRAW_ID_TYPE_TEXT | MetaWatch16;
+  pInfo->X = 4;
+  pInfo->Y = OTHER_Y;
+  pInfo->Width = LCD_COL_NUM - 8;
+  pInfo->TextLen = TextLen;
+  memcpy(Data + DRAW_INFO_SIZE, pText, Length);
+
+  HostSend(DrawMsg, Flags | APP_MODE << 6, Data, DRAW_INFO_SIZE + Length);
+}
+
+static void Broken(void)
+{
+  static unsigned char const Split[] = {6, 0};
+  static char const Text[] = "broken";
+
+  ClearApp();
+  HostWaitIdle();
+  size_t Free = xPortGetFreeHeapSize();
+
+  /* a text is collected in a buffer from the heap: abandoned, it is freed */
+  SendText(DRAW_MSG_BEGIN, Text, 2 * (sizeof(Text) - 1), sizeof(Text) - 1);
+  HostWaitIdle();
+  HOST_CHECK(xPortGetFreeHeapSize() < Free);
+
+  /* a bitmap cut off by another one */
+  MakeBitmap(20);
+  SendBitmap(BMP_Y, Split, 3 * BMP_ROW_BYTES);
+  HostWaitIdle();
+  HOST_CHECK(xPortGetFreeHeapSize() == Free);
+
+  MakeBitmap(21);
+  SendBitmap(BMP_Y, Split, BMP_BYTES);
+  Show();
+  HOST_CHECK(BitmapIs(BMP_Y, BMP_ROWS));
+  HOST_CHECK(xPortGetFreeHeapSize() == Free);
+}
+
+static void Script(void)
+{
+  HostWaitIdle();
+
+  FragmentOrder();
+  Truncated();
+  Broken();
+}
+
+int main(void)
+{
+  return HostRun(Script);
+}
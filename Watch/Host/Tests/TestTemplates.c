@@ -0,0 +1,138 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestTemplates.c
+ *
+ * The images in Host/Templates are the uncompressed screens BitmapData.c
+ * had before the templates were run-length coded. Every coded template must
+ * decode to its image, and Tools/TemplateRle must code the image to the
+ * same bytes, so a template can be redrawn and converted again. With libpng
+ * an image also goes through a PNG file.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#if HOST_PNG
+#include <png.h>
+#endif
+#include "BitmapData.h"
+#include "HostBoard.h"
+#include "Template.h"
+
+typedef struct
+{
+  char const *pName;
+  tTemplate const *pTemplate;
+  unsigned int Width;
+  unsigned int Height;
+} tImage;
+
+static tImage const Images[] =
+{
+  {"TmplNotifEmpty", &pTemplate[TMPL_NOTIF_EMPTY], 96, 96},
+#if SUPPORT_HID
+  {"TmplMusicHid", &pTemplate[TMPL_MUSIC_MODE], 96, 96},
+#else
+  {"TmplMusic", &pTemplate[TMPL_MUSIC_MODE], 96, 96},
+#endif
+  {"TmplWgtLogo", &pTemplate[TMPL_WGT_LOGO], 96, 96},
+  {"TmplWgtFish", &pTemplate[TMPL_WGT_FISH], 96, 96},
+  {"TmplWgtHanzi", &pTemplate[TMPL_WGT_HANZI], 96, 96},
+  {"TmplNotif", &pTemplate[TMPL_NOTIF_MODE], 96, 96},
+  {"TmplWgtCity", &pTemplate[TMPL_WGT_CITY], 96, 96},
+  {"Tmpl2QEmpty", &pTemplate2Q[0], 96, 48},
+  {"WgtTmplEmpty", &pWidgetTemplate[TMPL_WGT_EMPTY], 48, 48},
+  {"WgtTmplLoading", &pWidgetTemplate[TMPL_WGT_LOADING], 48, 48}
+};
+
+#define IMAGE_NUM               (sizeof(Images) / sizeof(Images[0]))
+
+static unsigned int Load(char const *pFile, unsigned char *pBits, tImage const *pImage)
+{
+  unsigned int Width, Height;
+  unsigned int Bytes = TemplateLoad(pFile, pBits, &Width, &Height);
+
+  HOST_CHECK(Bytes && Width == pImage->Width && Height == pImage->Height);
+  return Bytes;
+}
+
+#if HOST_PNG
+/* back through an 8 bit grey PNG */
+static void CheckPng(unsigned char const *pBits, tImage const *pImage)
+{
+  static char const *pFile = "TestTemplates.png";
+  unsigned char Grey[TEMPLATE_MAX_BYTES * 8];
+  unsigned char Back[TEMPLATE_MAX_BYTES];
+  png_image Image;
+  unsigned int Bytes = pImage->Width * pImage->Height / 8;
+  unsigned int i;
+
+  for (i = 0; i < Bytes * 8; ++i) Grey[i] = pBits[i / 8] & (1 << (i % 8)) ? 0x00 : 0xFF;
+
+  memset(&Image, 0, sizeof(Image));
+  Image.version = PNG_IMAGE_VERSION;
+  Image.width = pImage->Width;
+  Image.height = pImage->Height;
+  Image.format = PNG_FORMAT_GRAY;
+  HOST_CHECK(png_image_write_to_file(&Image, pFile, 0, Grey, 0, NULL));
+
+  HOST_CHECK(Load(pFile, Back, pImage) == Bytes);
+  HOST_CHECK(memcmp(Back, pBits, Bytes) == 0);
+  remove(pFile);
+}
+#endif
+
+int main(void)
+{
+  unsigned char Bits[TEMPLATE_MAX_BYTES];
+  unsigned char Decoded[TEMPLATE_MAX_BYTES];
+  unsigned char Coded[TEMPLATE_MAX_CODED];
+  char File[256];
+  unsigned int Flash = 0;
+  unsigned int Plain = 0;
+  unsigned int i;
+
+  for (i = 0; i < IMAGE_NUM; ++i)
+  {
+    tImage const *pImage = &Images[i];
+    TemplateReader_t Reader;
+
+    snprintf(File, sizeof(File), "%s/%s.pbm", TEMPLATE_DIR, pImage->pName);
+    unsigned int Bytes = Load(File, Bits, pImage);
+
+    StartTemplate(&Reader, *pImage->pTemplate);
+    ReadTemplate(&Reader, Decoded, Bytes);
+    HOST_CHECK(memcmp(Decoded, Bits, Bytes) == 0);
+
+    /* and not a byte more in flash */
+    unsigned int Length = TemplateEncode(Bits, Bytes, Coded);
+    HOST_CHECK(memcmp(Coded, *pImage->pTemplate, Length) == 0);
+    HOST_CHECK(Reader.pSrc == *pImage->pTemplate + Length && Reader.Count == 0);
+
+#if HOST_PNG
+    CheckPng(Bits, pImage);
+#endif
+
+    printf("%-16s %4u -> %4u bytes\n", pImage->pName, Bytes, Length);
+    Plain += Bytes;
+    Flash += Length;
+  }
+
+  printf("%-16s %4u -> %4u bytes\n", "all", Plain, Flash);
+  return 0;
+}
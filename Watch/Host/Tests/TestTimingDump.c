@@ -0,0 +1,100 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestTimingDump.c
+ *
+ * Sends app screens the way the phone does, rows back to back so they wait
+ * in the display queue, and writes what the "timing" command prints to the
+ * file given on the command line, for Tools/TimingDecode.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Statistics.h"
+#include "HostBoard.h"
+
+#define SCREENS                 (4)
+#define SCREEN_GAP_MS           (100)
+
+static FILE *pDump;
+static unsigned int Lines;
+
+static void Dump(char Out)
+{
+  if (Out == '\r') return;
+
+  fputc(Out, pDump);
+  if (Out == '\n') Lines ++;
+}
+
+static void Script(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Screen;
+  unsigned char Row;
+  unsigned char i;
+
+  HostWaitIdle();
+
+  for (Screen = 0; Screen < SCREENS; ++Screen)
+  {
+    for (Row = 0; Row < LCD_ROW_NUM; ++Row)
+    {
+      Line[0] = Row;
+      for (i = 0; i < BYTES_PER_LINE; ++i) Line[1 + i] = Screen * 31 + Row * 13 + i * 7;
+      HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+    }
+
+    HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+    HostWait(SCREEN_GAP_MS);
+  }
+
+  HostWaitIdle();
+
+  pHostConsole = Dump;
+  ShowMessageTiming();
+  pHostConsole = NULL;
+
+  /* the header, WriteBufferMsg and UpdateDisplayMsg at least */
+  HOST_CHECK(Lines >= 3);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s dump\n", argv[0]);
+    return 2;
+  }
+
+  pDump = fopen(argv[1], "w");
+  if (!pDump)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  int Status = HostRun(Script);
+
+  fclose(pDump);
+  return Status;
+}
@@ -0,0 +1,109 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestTraceCapture.c
+ *
+ * Records a phone session with the message trace and writes the "tdump"
+ * the debug uart prints to the file given on the command line, for
+ * Tools/TraceReplay. The session redraws a band of an app screen a few
+ * times, a message every MSG_GAP_MS as the radio delivers them: the trace
+ * stages only TRACE_STAGE_SLOTS messages until the display task runs, and
+ * the whole session has to fit in the trace region.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "LcdDriver.h"
+#include "DrawHandler.h"
+#include "LcdBuffer.h"
+#include "Trace.h"
+#include "HostBoard.h"
+
+#define SCREENS                 (3)
+#define BAND_ROWS               (16)
+#define BAND_FIRST_ROW          (24)
+#define MSG_GAP_MS              (2)
+#define SCREEN_GAP_MS           (250)
+
+static FILE *pCapture;
+static unsigned int Lines;
+
+static void Capture(char Out)
+{
+  if (Out == '\r') return;
+
+  fputc(Out, pCapture);
+  if (Out == '\n') Lines ++;
+}
+
+static void Script(void)
+{
+  unsigned char Line[1 + BYTES_PER_LINE];
+  unsigned char Screen;
+  unsigned char Row;
+  unsigned char i;
+
+  HostWaitIdle();
+  ToggleTrace();
+
+  for (Screen = 0; Screen < SCREENS; ++Screen)
+  {
+    for (Row = BAND_FIRST_ROW; Row < BAND_FIRST_ROW + BAND_ROWS; ++Row)
+    {
+      Line[0] = Row;
+      for (i = 0; i < BYTES_PER_LINE; ++i) Line[1 + i] = Screen * 31 + Row * 13 + i * 7;
+      HostSend(WriteBufferMsg, APP_MODE, Line, sizeof(Line));
+      HostWait(MSG_GAP_MS);
+    }
+
+    HostSend(UpdateDisplayMsg, APP_MODE, NULL, 0);
+    HostWait(SCREEN_GAP_MS);
+  }
+
+  HostWaitIdle();
+  ToggleTrace();
+
+  pHostConsole = Capture;
+  DumpTrace();
+  pHostConsole = NULL;
+
+  /* the header and at least every message sent */
+  HOST_CHECK(Lines > SCREENS * (BAND_ROWS + 1));
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s capture\n", argv[0]);
+    return 2;
+  }
+
+  pCapture = fopen(argv[1], "w");
+  if (!pCapture)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  int Status = HostRun(Script);
+
+  fclose(pCapture);
+  return Status;
+}
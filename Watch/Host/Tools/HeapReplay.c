@@ -0,0 +1,356 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HeapReplay.c
+ *
+ * Replays the heap operations of a capture printed by "tdump" (Trace.c) on
+ * one of the bench heaps and prints how fragmented it gets over time:
+ *
+ *   HeapReplay [-h heap] [-t ticks] [-e] capture
+ *
+ * The heap (heap_4 by default, or heap_2, heap_tlsf) is first given the
+ * layout of the capture: the blocks are allocated in address order and the
+ * free ones freed again. Then every allocation and free is replayed in
+ * order, and the heap is printed every -t ticks of the recording (100 by
+ * default) that had operations: live blocks, free bytes, the largest free
+ * block and the fragmentation, the share of the free bytes outside the
+ * largest block.
+ *
+ * An allocation is placed as captured when it lands at the offset it had
+ * on the watch. On heap_4 with the layout of the host build every one is;
+ * -e fails the replay otherwise, or when the failed allocations differ.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "Trace.h"
+#include "TraceDump.h"
+#include "BenchHeap.h"
+
+#define DEFAULT_INTERVAL        (100)
+
+/* as in Trace.c; offsets and sizes are 16 bits */
+#define HEAP_OP_LEN             (6)
+#define OFFSET_NUM              (0x10000)
+#define LAYOUT_ALLOCATED        (0x0001)
+
+typedef struct
+{
+  unsigned int Offset;
+  unsigned int Size;
+  unsigned char Allocated;
+} tBlock;
+
+static tTraceSlot Slots[TRACE_DUMP_MAX_SLOTS];
+static unsigned int SlotNum;
+
+static tBlock Layout[TRACE_DUMP_MAX_SLOTS * TRACE_PAYLOAD_LEN / 2];
+static unsigned int LayoutNum;
+
+/* the replayed block of each captured offset; a block of the capture the
+ * replay could not allocate is known without one */
+static void *pLive[OFFSET_NUM];
+static unsigned char Known[OFFSET_NUM];
+static unsigned int LiveNum;
+
+static tBenchHeap const *pHeap = &Heap4;
+static unsigned char *pBase;
+
+/* blocks of the layout allocated again, and placed as captured */
+static unsigned int Rebuilt;
+static unsigned int RebuiltPlaced;
+
+static unsigned int Allocs;
+static unsigned int Placed;
+static unsigned int Frees;
+static unsigned int Failed;
+static unsigned int CapturedFailed;
+
+static unsigned int Fragmentation(size_t Free, size_t Largest)
+{
+  return Free ? 100 - Largest * 100 / Free : 0;
+}
+
+/* the 'L' slots the capture starts with; \return the slots they take */
+static unsigned int LoadLayout(void)
+{
+  unsigned int Offset = 0;
+  unsigned int i, j;
+
+  for (i = 0; i < SlotNum && Slots[i].Source == 'H' && Slots[i].Type == 'L'; ++i)
+  {
+    tTraceSlot const *pSlot = &Slots[i];
+
+    if (i == 0) Offset = pSlot->Options;
+
+    for (j = 0; j + 1 < pSlot->Length; j += 2)
+    {
+      unsigned int Value = pSlot->Payload[j] | pSlot->Payload[j + 1] << 8;
+      tBlock *pBlock = &Layout[LayoutNum++];
+
+      pBlock->Offset = Offset;
+      pBlock->Size = Value & ~LAYOUT_ALLOCATED;
+      pBlock->Allocated = (Value & LAYOUT_ALLOCATED) != 0;
+
+      /* the next block starts after this one and its own header */
+      Offset += pBlock->Size + Slots[0].Options;
+    }
+  }
+
+  return i;
+}
+
+/* allocates the blocks up to the last allocated one and frees the free
+ * ones; \return FALSE if the layout does not fit */
+static unsigned char Rebuild(void)
+{
+  static void *pGap[sizeof(Layout) / sizeof(Layout[0])];
+  unsigned int GapNum = 0;
+  unsigned int i;
+
+  for (i = 0; i < LayoutNum; ++i)
+  {
+    if (Layout[i].Allocated) Rebuilt = i + 1;
+  }
+
+  for (i = 0; i < Rebuilt; ++i)
+  {
+    tBlock const *pBlock = &Layout[i];
+    unsigned char *pBuffer = pHeap->pMalloc(pBlock->Size);
+
+    if (!pBuffer) return FALSE;
+    if (i == 0) pBase = pBuffer - pBlock->Offset;
+    if (pBuffer == pBase + pBlock->Offset) RebuiltPlaced ++;
+
+    if (pBlock->Allocated)
+    {
+      pLive[pBlock->Offset] = pBuffer;
+      Known[pBlock->Offset] = TRUE;
+      LiveNum ++;
+    }
+    else pGap[GapNum++] = pBuffer;
+  }
+
+  for (i = 0; i < GapNum; ++i) pHeap->pFree(pGap[i]);
+  return TRUE;
+}
+
+static void PrintRow(unsigned long Tick, unsigned int Ops, unsigned int Failed)
+{
+  size_t Free = pHeap->pFreeBytes();
+  size_t Largest = pHeap->pLargestFree();
+
+  printf("%7lu %5u %5u %6zu %7zu %4u%% %6u\n", Tick, Ops, LiveNum, Free, Largest,
+    Fragmentation(Free, Largest), Failed);
+}
+
+/* \return FALSE if the capture does not hold together */
+static unsigned char ReplayOp(unsigned char const *pOp, unsigned int Tick)
+{
+  unsigned int At = pOp[2] | pOp[3] << 8;
+  unsigned int Size = pOp[4] | pOp[5] << 8;
+  unsigned char *pBuffer;
+
+  switch (pOp[0])
+  {
+  case 'A':
+    if (Known[At])
+    {
+      fprintf(stderr, "tick %u: %04X allocated twice\n", Tick, At);
+      return FALSE;
+    }
+
+    pBuffer = pHeap->pMalloc(Size);
+
+    Allocs ++;
+    if (pBuffer == pBase + At) Placed ++;
+    if (!pBuffer) Failed ++;
+    else LiveNum ++;
+
+    pLive[At] = pBuffer;
+    Known[At] = TRUE;
+    break;
+
+  case 'F':
+    if (!Known[At])
+    {
+      fprintf(stderr, "tick %u: %04X freed but not allocated\n", Tick, At);
+      return FALSE;
+    }
+
+    if (pLive[At])
+    {
+      pHeap->pFree(pLive[At]);
+      LiveNum --;
+    }
+
+    pLive[At] = NULL;
+    Known[At] = FALSE;
+    Frees ++;
+    break;
+
+  case 'X':
+    /* the watch got nothing: what the replay gets goes back */
+    pBuffer = pHeap->pMalloc(Size);
+
+    CapturedFailed ++;
+    if (pBuffer) pHeap->pFree(pBuffer);
+    else Failed ++;
+    break;
+
+  default:
+    fprintf(stderr, "tick %u: unknown heap operation %02X\n", Tick, pOp[0]);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+  static tBenchHeap const *const pHeaps[] = {&Heap2, &Heap4, &HeapTlsf};
+  unsigned long Interval = DEFAULT_INTERVAL;
+  unsigned char Exact = FALSE;
+  int Arg;
+  unsigned int i, j;
+
+  for (Arg = 1; Arg < argc - 1; ++Arg)
+  {
+    if (!strcmp(argv[Arg], "-e")) Exact = TRUE;
+    else if (!strcmp(argv[Arg], "-t") && Arg + 2 < argc) Interval = strtoul(argv[++Arg], NULL, 0);
+    else if (!strcmp(argv[Arg], "-h") && Arg + 2 < argc)
+    {
+      char const *pName = argv[++Arg];
+
+      pHeap = NULL;
+      for (i = 0; i < sizeof(pHeaps) / sizeof(pHeaps[0]); ++i)
+      {
+        if (!strcmp(pHeaps[i]->pName, pName)) pHeap = pHeaps[i];
+      }
+      if (!pHeap) break;
+    }
+    else break;
+  }
+
+  if (Arg != argc - 1 || !Interval)
+  {
+    fprintf(stderr, "usage: %s [-h heap_2|heap_4|heap_tlsf] [-t ticks] [-e] capture\n", argv[0]);
+    return 2;
+  }
+
+  int Loaded = TraceDumpLoad(argv[Arg], Slots);
+  if (Loaded < 0) return 1;
+  SlotNum = Loaded;
+
+  unsigned int First = LoadLayout();
+  if (!LayoutNum)
+  {
+    fprintf(stderr, "%s: no heap layout at the start (the ring wrapped?)\n", argv[Arg]);
+    return 1;
+  }
+
+  if (!Rebuild())
+  {
+    fprintf(stderr, "%s: the layout of %u blocks does not fit %s\n", argv[Arg], LayoutNum, pHeap->pName);
+    return 1;
+  }
+
+  size_t MinFree = pHeap->pFreeBytes();
+  size_t MinLargest = pHeap->pLargestFree();
+  unsigned int WorstFrag = Fragmentation(MinFree, MinLargest);
+  unsigned long WorstTick = 0;
+
+  unsigned long Elapsed = 0;
+  unsigned long Row = 0;
+  unsigned int RowOps = 0;
+
+  printf("%s: layout of %u blocks (%u allocated), %u of %u placed as captured\n",
+    pHeap->pName, LayoutNum, LiveNum, RebuiltPlaced, Rebuilt);
+  printf("   tick   ops  live   free largest  frag failed\n");
+  PrintRow(0, 0, 0);
+
+  for (i = First; i < SlotNum; ++i)
+  {
+    tTraceSlot const *pSlot = &Slots[i];
+
+    /* the tick is 16 bits in a slot */
+    Elapsed += (unsigned short)(pSlot->Tick - Slots[i - 1].Tick);
+    if (pSlot->Source != 'H' || pSlot->Type != 'O') continue;
+
+    if (Elapsed / Interval != Row)
+    {
+      if (RowOps) PrintRow(Row * Interval, RowOps, Failed);
+      Row = Elapsed / Interval;
+      RowOps = 0;
+    }
+
+    for (j = 0; j < pSlot->Options; ++j)
+    {
+      if (!ReplayOp(pSlot->Payload + j * HEAP_OP_LEN, pSlot->Tick)) return 1;
+
+      RowOps ++;
+
+      size_t Free = pHeap->pFreeBytes();
+      size_t Largest = pHeap->pLargestFree();
+
+      if (Free < MinFree) MinFree = Free;
+      if (Largest < MinLargest) MinLargest = Largest;
+      if (Fragmentation(Free, Largest) > WorstFrag)
+      {
+        WorstFrag = Fragmentation(Free, Largest);
+        WorstTick = Elapsed;
+      }
+    }
+  }
+
+  if (RowOps) PrintRow(Row * Interval, RowOps, Failed);
+
+  printf("%u allocations (%u placed as captured), %u frees, %u failed (%u on the watch)\n",
+    Allocs, Placed, Frees, Failed, CapturedFailed);
+  printf("least free %zu, smallest largest block %zu, worst fragmentation %u%% at tick %lu\n",
+    MinFree, MinLargest, WorstFrag, WorstTick);
+
+  if (Exact && (RebuiltPlaced != Rebuilt || Placed != Allocs ||
+                Failed != CapturedFailed)) return 1;
+
+  return 0;
+}
+
+/******************************************************************************/
+
+void BenchHeapSuspend(void)
+{
+}
+
+signed portBASE_TYPE BenchHeapResume(void)
+{
+  return pdFALSE;
+}
+
+void BenchHeapMallocFailed(void)
+{
+}
+
+void BenchHeapFreeFailed(unsigned char *pBuffer)
+{
+  fprintf(stderr, "free of a block not from the heap\n");
+  exit(1);
+}
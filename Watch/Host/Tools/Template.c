@@ -0,0 +1,223 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Template.c
+ *
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if HOST_PNG
+#include <png.h>
+#endif
+#include "BitmapData.h"
+#include "Template.h"
+
+/* longest literal and run one control byte covers */
+#define LITERAL_MAX             (TMPL_RUN)
+#define RUN_MAX                 (0xFF - TMPL_RUN + TMPL_RUN_MIN)
+
+/* reading a PBM header: skips white space and comments */
+static int ReadNumber(FILE *pFile, unsigned int *pValue)
+{
+  int Char;
+
+  for (;;)
+  {
+    Char = fgetc(pFile);
+    if (Char == '#') while (Char != '\n' && Char != EOF) Char = fgetc(pFile);
+    if (Char == EOF) return 0;
+    if (Char >= '0' && Char <= '9') break;
+    if (Char != ' ' && Char != '\t' && Char != '\r' && Char != '\n') return 0;
+  }
+
+  *pValue = 0;
+  while (Char >= '0' && Char <= '9')
+  {
+    *pValue = *pValue * 10 + Char - '0';
+    Char = fgetc(pFile);
+  }
+
+  /* one white space ends the header of a P4 */
+  return Char != EOF;
+}
+
+static unsigned int LoadPbm(FILE *pFile, char const *pName, unsigned char *pBits,
+                            unsigned int Width, unsigned int Height, unsigned char Raw)
+{
+  unsigned int Bytes = Width * Height / 8;
+  unsigned int i;
+  unsigned char k;
+
+  memset(pBits, 0, Bytes);
+
+  for (i = 0; i < Bytes; ++i)
+  {
+    if (Raw)
+    {
+      int In = fgetc(pFile);
+      if (In == EOF) break;
+
+      /* PBM has the leftmost pixel in the top bit */
+      for (k = 0; k < 8; ++k) if (In & (0x80 >> k)) pBits[i] |= 1 << k;
+    }
+    else for (k = 0; k < 8; ++k)
+    {
+      int In;
+      do In = fgetc(pFile); while (In == ' ' || In == '\t' || In == '\r' || In == '\n');
+
+      if (In != '0' && In != '1') break;
+      if (In == '1') pBits[i] |= 1 << k;
+    }
+
+    if (k < 8) break;
+  }
+
+  if (i < Bytes)
+  {
+    fprintf(stderr, "%s: short image\n", pName);
+    return 0;
+  }
+
+  return Bytes;
+}
+
+#if HOST_PNG
+static unsigned int LoadPng(char const *pName, unsigned char *pBits,
+                            unsigned int *pWidth, unsigned int *pHeight)
+{
+  png_image Image;
+  unsigned char *pGrey;
+  unsigned int Bytes;
+  unsigned int i;
+
+  memset(&Image, 0, sizeof(Image));
+  Image.version = PNG_IMAGE_VERSION;
+
+  if (!png_image_begin_read_from_file(&Image, pName))
+  {
+    fprintf(stderr, "%s: %s\n", pName, Image.message);
+    return 0;
+  }
+
+  *pWidth = Image.width;
+  *pHeight = Image.height;
+  if (Image.width % 8 || Image.width * Image.height / 8 > TEMPLATE_MAX_BYTES)
+  {
+    fprintf(stderr, "%s: %ux%u does not fit a template\n", pName, Image.width, Image.height);
+    png_image_free(&Image);
+    return 0;
+  }
+
+  /* transparent is white */
+  Image.format = PNG_FORMAT_GRAY;
+  pGrey = malloc(PNG_IMAGE_SIZE(Image));
+  png_color Background = {0xFF, 0xFF, 0xFF};
+
+  if (!pGrey || !png_image_finish_read(&Image, &Background, pGrey, 0, NULL))
+  {
+    fprintf(stderr, "%s: %s\n", pName, Image.message);
+    free(pGrey);
+    return 0;
+  }
+
+  Bytes = Image.width * Image.height / 8;
+  memset(pBits, 0, Bytes);
+  for (i = 0; i < Image.width * Image.height; ++i)
+  {
+    if (pGrey[i] < 0x80) pBits[i / 8] |= 1 << (i % 8);
+  }
+
+  free(pGrey);
+  return Bytes;
+}
+#endif
+
+unsigned int TemplateLoad(char const *pName, unsigned char *pBits,
+                          unsigned int *pWidth, unsigned int *pHeight)
+{
+  FILE *pFile = fopen(pName, "rb");
+  unsigned char Magic[2];
+  unsigned int Bytes = 0;
+
+  if (!pFile)
+  {
+    perror(pName);
+    return 0;
+  }
+
+  if (fread(Magic, 1, sizeof(Magic), pFile) != sizeof(Magic)) Magic[0] = 0;
+
+  if (Magic[0] == 'P' && (Magic[1] == '1' || Magic[1] == '4'))
+  {
+    if (!ReadNumber(pFile, pWidth) || !ReadNumber(pFile, pHeight))
+      fprintf(stderr, "%s: bad PBM header\n", pName);
+    else if (*pWidth % 8 || *pWidth * *pHeight / 8 > TEMPLATE_MAX_BYTES)
+      fprintf(stderr, "%s: %ux%u does not fit a template\n", pName, *pWidth, *pHeight);
+    else Bytes = LoadPbm(pFile, pName, pBits, *pWidth, *pHeight, Magic[1] == '4');
+
+    fclose(pFile);
+    return Bytes;
+  }
+
+  fclose(pFile);
+
+#if HOST_PNG
+  if (Magic[0] == 0x89 && Magic[1] == 'P') return LoadPng(pName, pBits, pWidth, pHeight);
+  fprintf(stderr, "%s: not a PBM or PNG\n", pName);
+#else
+  fprintf(stderr, "%s: not a PBM (built without libpng)\n", pName);
+#endif
+  return 0;
+}
+
+unsigned int TemplateEncode(unsigned char const *pBits, unsigned int Length,
+                            unsigned char *pOut)
+{
+  unsigned char *pStart = pOut;
+  unsigned char *pLiteral = NULL; // control byte of the open literal
+  unsigned int i = 0;
+
+  while (i < Length)
+  {
+    unsigned int Run = 1;
+
+    while (i + Run < Length && pBits[i + Run] == pBits[i] && Run < RUN_MAX) Run ++;
+
+    /* a run of two costs as much as two literals but would end the open one */
+    if (Run > TMPL_RUN_MIN || (Run == TMPL_RUN_MIN && !pLiteral))
+    {
+      *pOut++ = TMPL_RUN + Run - TMPL_RUN_MIN;
+      *pOut++ = pBits[i];
+      pLiteral = NULL;
+      i += Run;
+      continue;
+    }
+
+    if (pLiteral && *pLiteral < LITERAL_MAX - 1) (*pLiteral) ++;
+    else
+    {
+      pLiteral = pOut++;
+      *pLiteral = 0;
+    }
+    *pOut++ = pBits[i++];
+  }
+
+  return pOut - pStart;
+}
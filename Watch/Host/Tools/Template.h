@@ -0,0 +1,51 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Template.h
+ *
+ * Images to the run-length coded templates of BitmapData.c. An image is
+ * read into firmware bytes: 8 pixels a byte, the leftmost in bit 0, a one
+ * bit dark. PBM (P1 or P4) is always read; PNG (any depth, dark below half
+ * grey) when the host build found libpng (HOST_PNG).
+ */
+/******************************************************************************/
+
+#ifndef TEMPLATE_H
+#define TEMPLATE_H
+
+/* a screen is the largest template */
+#define TEMPLATE_MAX_BYTES      (96 * 96 / 8)
+
+/* worst case of the coding: a control byte every 128 literals */
+#define TEMPLATE_MAX_CODED      (TEMPLATE_MAX_BYTES + TEMPLATE_MAX_BYTES / 128 + 1)
+
+/*! Read an image of up to TEMPLATE_MAX_BYTES whose width is a multiple of 8
+ *
+ * \return the number of bytes, 0 on error (printed to stderr)
+ */
+unsigned int TemplateLoad(char const *pName, unsigned char *pBits,
+                          unsigned int *pWidth, unsigned int *pHeight);
+
+/*! Run-length code Length bytes as BitmapData.h describes: runs of 3 or more
+ * bytes and runs of 2 that do not break a literal are coded as runs
+ *
+ * \return the number of bytes at pOut
+ */
+unsigned int TemplateEncode(unsigned char const *pBits, unsigned int Length,
+                            unsigned char *pOut);
+
+#endif /* TEMPLATE_H */
@@ -0,0 +1,79 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TemplateRle.c
+ *
+ * Converts an image to a template array for BitmapData.c:
+ *
+ *   TemplateRle image Name
+ *
+ * The image is a screen (96x96), a half screen (96x48) or a widget quad
+ * (48x48), dark pixels set. The array is printed in the layout of
+ * BitmapData.c; the coded size goes to stderr. The sources of the templates
+ * in the firmware are in Host/Templates.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include "Template.h"
+
+#define BYTES_PER_ROW_OUT       (12)
+
+static unsigned char IsTemplate(unsigned int Width, unsigned int Height)
+{
+  return (Width == 96 && (Height == 96 || Height == 48)) ||
+         (Width == 48 && Height == 48);
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned char Bits[TEMPLATE_MAX_BYTES];
+  unsigned char Coded[TEMPLATE_MAX_CODED];
+  unsigned int Width, Height;
+  unsigned int Bytes, Length;
+  unsigned int i;
+
+  if (argc != 3)
+  {
+    fprintf(stderr, "usage: %s image Name\n", argv[0]);
+    return 2;
+  }
+
+  Bytes = TemplateLoad(argv[1], Bits, &Width, &Height);
+  if (!Bytes) return 1;
+
+  if (!IsTemplate(Width, Height))
+  {
+    fprintf(stderr, "%s: %ux%u is not a screen, half screen or quad\n",
+      argv[1], Width, Height);
+    return 1;
+  }
+
+  Length = TemplateEncode(Bits, Bytes, Coded);
+
+  printf("static unsigned char const TEMPLATE_MEM %s[] =\n{ // %s\n", argv[2], argv[1]);
+  for (i = 0; i < Length; ++i)
+  {
+    if (i % BYTES_PER_ROW_OUT == 0) printf("  ");
+    printf("0x%02X%s", Coded[i], i + 1 == Length ? "\n" :
+      i % BYTES_PER_ROW_OUT == BYTES_PER_ROW_OUT - 1 ? ",\n" : ",");
+  }
+  printf("};\n");
+
+  fprintf(stderr, "%s: %ux%u, %u bytes coded in %u\n", argv[2], Width, Height, Bytes, Length);
+  return 0;
+}
@@ -0,0 +1,223 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TimingDecode.c
+ *
+ * Prints p50/p99 queue wait and service time of each message type from the
+ * histograms the "timing" terminal command dumps (Statistics.c):
+ *
+ *   TimingDecode log
+ *
+ * Bucket 0 holds 0 ticks, bucket n 2^(n-1)..2^n-1 ticks and the last one
+ * everything longer; a percentile is given as the upper bound of its
+ * bucket, in ticks and ms, with ">" for the last bucket. The last dump in
+ * the log counts; other lines are skipped.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "Statistics.h"
+
+#define LINE_LEN                (256)
+
+typedef struct
+{
+  unsigned char Type;
+  unsigned int Uses;
+  unsigned char Wait[TIMING_BUCKET_NUM];
+  unsigned char Service[TIMING_BUCKET_NUM];
+} tTiming;
+
+static tTiming Timing[TIMING_TYPE_NUM];
+static unsigned char TypeNum;
+static unsigned int TickHz;
+
+/* the TIMING_BUCKET_NUM hex bytes after Tag */
+static char const *ParseHex(char const *pLine, char const *pTag, unsigned char *pOut)
+{
+  unsigned int Byte;
+  int Used;
+  unsigned char i;
+
+  pLine = strstr(pLine, pTag);
+  if (!pLine) return NULL;
+  pLine += strlen(pTag);
+
+  for (i = 0; i < TIMING_BUCKET_NUM; ++i)
+  {
+    if (sscanf(pLine, "%2x%n", &Byte, &Used) != 1) return NULL;
+    pOut[i] = Byte;
+    pLine += Used;
+  }
+
+  return pLine;
+}
+
+/* "type uses W:.. S:.." after an optional time stamp ("hh:mm:ss ") */
+static int ParseType(char const *pLine, tTiming *pTiming)
+{
+  unsigned int Type;
+
+  if (strlen(pLine) > 9 && pLine[2] == ':' && pLine[5] == ':') pLine += 9;
+
+  if (sscanf(pLine, "%2x %u W:", &Type, &pTiming->Uses) != 2) return 0;
+  pTiming->Type = Type;
+
+  pLine = ParseHex(pLine, "W:", pTiming->Wait);
+  if (pLine) pLine = ParseHex(pLine, "S:", pTiming->Service);
+
+  return pLine ? 1 : -1;
+}
+
+static int Load(char const *pName)
+{
+  FILE *pFile = fopen(pName, "r");
+  char Line[LINE_LEN];
+  unsigned char Header = FALSE;
+  unsigned int Number = 0;
+
+  if (!pFile)
+  {
+    perror(pName);
+    return 0;
+  }
+
+  while (fgets(Line, sizeof(Line), pFile))
+  {
+    char const *pHeader = strstr(Line, "- Timing:");
+    unsigned int Buckets;
+
+    Number ++;
+
+    if (pHeader && sscanf(pHeader, "- Timing:%u Tick:%u", &Buckets, &TickHz) == 2)
+    {
+      if (Buckets != TIMING_BUCKET_NUM || TickHz == 0)
+      {
+        fprintf(stderr, "%s:%u: %u buckets of 1/%u s\n", pName, Number, Buckets, TickHz);
+        fclose(pFile);
+        return 0;
+      }
+
+      Header = TRUE;
+      TypeNum = 0;
+      continue;
+    }
+
+    if (!Header || TypeNum == TIMING_TYPE_NUM) continue;
+
+    int Parsed = ParseType(Line, &Timing[TypeNum]);
+    if (Parsed < 0)
+    {
+      fprintf(stderr, "%s:%u: bad histogram\n", pName, Number);
+      fclose(pFile);
+      return 0;
+    }
+    TypeNum += Parsed;
+  }
+
+  fclose(pFile);
+
+  if (!Header)
+  {
+    fprintf(stderr, "%s: no timing dump\n", pName);
+    return 0;
+  }
+
+  return 1;
+}
+
+static unsigned int Samples(unsigned char const *pHist)
+{
+  unsigned int Total = 0;
+  unsigned char i;
+
+  for (i = 0; i < TIMING_BUCKET_NUM; ++i) Total += pHist[i];
+  return Total;
+}
+
+/* bucket holding the percentile */
+static unsigned char Percentile(unsigned char const *pHist, unsigned char Percent)
+{
+  unsigned int Total = Samples(pHist);
+  unsigned int Count = 0;
+  unsigned char i;
+
+  for (i = 0; i < TIMING_BUCKET_NUM - 1; ++i)
+  {
+    Count += pHist[i];
+    if (Count * 100 >= Total * Percent) break;
+  }
+
+  return i;
+}
+
+/* ticks/ms of p50 and p99 */
+static void PrintHist(unsigned char const *pHist)
+{
+  unsigned char Percent[] = {50, 99};
+  unsigned char i;
+
+  printf(" %6u", Samples(pHist));
+
+  for (i = 0; i < sizeof(Percent); ++i)
+  {
+    unsigned char Bucket = Percentile(pHist, Percent[i]);
+    unsigned int Ticks = Bucket ? (1U << Bucket) - 1 : 0;
+    char Above = ' ';
+
+    /* the last bucket has no upper bound */
+    if (Bucket == TIMING_BUCKET_NUM - 1)
+    {
+      Ticks = 1U << (Bucket - 1);
+      Above = '>';
+    }
+
+    if (Samples(pHist)) printf(" %c%5u/%-7.1f", Above, Ticks, Ticks * 1000.0 / TickHz);
+    else printf(" %14s", "-");
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned char i;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s log\n", argv[0]);
+    return 2;
+  }
+
+  if (!Load(argv[1])) return 1;
+
+  printf("%-20s %6s %6s  %-14s %-14s %6s  %-14s %s\n", "type", "uses",
+    "waits", "p50 ticks/ms", "p99", "svcs", "p50", "p99");
+
+  for (i = 0; i < TypeNum; ++i)
+  {
+    tTiming const *pTiming = &Timing[i];
+
+    printf("%-20s %6u", MsgInfo[pTiming->Type].MsgStr, pTiming->Uses);
+    PrintHist(pTiming->Wait);
+    PrintHist(pTiming->Service);
+    printf("\n");
+  }
+
+  return TypeNum ? 0 : 1;
+}
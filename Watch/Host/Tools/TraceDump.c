@@ -0,0 +1,126 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceDump.c
+ *
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "Messages.h"
+#include "Trace.h"
+#include "TraceDump.h"
+
+#define LINE_LEN                (256)
+
+/* one "tick source type options length: payload" line; a time stamp
+ * ("hh:mm:ss ") may come first */
+static int ParseSlot(char const *pLine, tTraceSlot *pSlot)
+{
+  unsigned int Type, Options, Length, Byte;
+  int Used;
+  unsigned char i;
+
+  if (sscanf(pLine, "%u %c %2x %2x %u:%n",
+        &pSlot->Tick, &pSlot->Source, &Type, &Options, &Length, &Used) != 5)
+  {
+    char const *pNext = strchr(pLine, ' ');
+    if (!pNext || pNext - pLine != 8 || pLine[2] != ':') return 0;
+    return ParseSlot(pNext + 1, pSlot);
+  }
+
+  pSlot->Type = Type;
+  pSlot->Options = Options;
+  pSlot->Length = Length;
+
+  pLine += Used;
+  for (i = 0; i < pSlot->Length && i < TRACE_PAYLOAD_LEN; ++i)
+  {
+    if (sscanf(pLine, "%2x%n", &Byte, &Used) != 1) return -1;
+    pSlot->Payload[i] = Byte;
+    pLine += Used;
+  }
+
+  return 1;
+}
+
+int TraceDumpLoad(char const *pName, tTraceSlot *pSlots)
+{
+  FILE *pFile = fopen(pName, "r");
+  char Line[LINE_LEN];
+  unsigned int Recorded = 0;
+  unsigned int Dropped = 0;
+  unsigned char Header = FALSE;
+  unsigned int Number = 0;
+  unsigned int SlotNum = 0;
+
+  if (!pFile)
+  {
+    perror(pName);
+    return -1;
+  }
+
+  while (fgets(Line, sizeof(Line), pFile))
+  {
+    char const *pHeader = strstr(Line, "- Trace:");
+
+    Number ++;
+
+    if (pHeader && sscanf(pHeader, "- Trace:%u Drop:%u", &Recorded, &Dropped) == 2)
+    {
+      Header = TRUE;
+      SlotNum = 0;
+      continue;
+    }
+
+    if (!Header) continue;
+
+    if (SlotNum == TRACE_DUMP_MAX_SLOTS)
+    {
+      fprintf(stderr, "%s: more than %u slots\n", pName, TRACE_DUMP_MAX_SLOTS);
+      fclose(pFile);
+      return -1;
+    }
+
+    int Parsed = ParseSlot(Line, &pSlots[SlotNum]);
+    if (Parsed < 0)
+    {
+      fprintf(stderr, "%s:%u: bad payload\n", pName, Number);
+      fclose(pFile);
+      return -1;
+    }
+    SlotNum += Parsed;
+  }
+
+  fclose(pFile);
+
+  if (!Header)
+  {
+    fprintf(stderr, "%s: no tdump\n", pName);
+    return -1;
+  }
+
+  if (Dropped || SlotNum != Recorded)
+  {
+    fprintf(stderr, "%s: %u of %u slots, %u dropped\n", pName, SlotNum, Recorded, Dropped);
+    return -1;
+  }
+
+  return SlotNum;
+}
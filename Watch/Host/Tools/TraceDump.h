@@ -0,0 +1,48 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceDump.h
+ *
+ * Reads a capture printed by "tdump" (Trace.c) for the host tools. Lines of
+ * the uart log that are not slots are skipped, so a whole log can be given;
+ * the last dump in it counts. A capture with dropped or missing slots is
+ * refused.
+ */
+/******************************************************************************/
+
+#ifndef TRACE_DUMP_H
+#define TRACE_DUMP_H
+
+#define TRACE_DUMP_MAX_SLOTS    (4096)
+
+typedef struct
+{
+  unsigned int Tick;
+  char Source;
+  unsigned char Type;
+  unsigned char Options;
+  unsigned char Length;
+  unsigned char Payload[TRACE_PAYLOAD_LEN];
+} tTraceSlot;
+
+/*! Read the slots of the dump, oldest first
+ *
+ * \return the number of slots, -1 on error (printed to stderr)
+ */
+int TraceDumpLoad(char const *pName, tTraceSlot *pSlots);
+
+#endif /* TRACE_DUMP_H */
@@ -0,0 +1,136 @@
+//==============================================================================
+//  Copyright 2013 Meta Watch Ltd. - http://www.MetaWatch.org/
+//
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceReplay.c
+ *
+ * Feeds a capture printed by "tdump" (Trace.c) through the display task of
+ * the host build and reports what it cost:
+ *
+ *   TraceReplay [-m] capture
+ *
+ * The same slots are replayed as "treplay" replays on the watch: messages
+ * from the wrapper (the phone) for the display task that were not
+ * truncated. By default they are routed at the recorded ticks; -m routes
+ * them as fast as the display task takes them, keeping at most
+ * REPLAY_DEPTH waiting in its queue like "treplay".
+ *
+ * A capture with dropped or missing slots is refused (TraceDump.h): the
+ * screens it draws would not be the phone's.
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "Messages.h"
+#include "Trace.h"
+#include "TraceDump.h"
+#include "HostBoard.h"
+#include "HostCpu.h"
+#include "SharpLcd.h"
+#include "Sram23k.h"
+
+/* as TRACE_REPLAY_DEPTH in Trace.c */
+#define REPLAY_DEPTH            (4)
+
+extern xQueueHandle QueueHandles[];
+
+static tTraceSlot Slots[TRACE_DUMP_MAX_SLOTS];
+static unsigned int SlotNum;
+static unsigned char MaxSpeed;
+
+static unsigned char Replayable(tTraceSlot const *pSlot)
+{
+  return pSlot->Source == 'W' &&
+         MsgInfo[pSlot->Type].MsgQueue == DISPLAY_QINDEX &&
+         pSlot->Length <= TRACE_PAYLOAD_LEN;
+}
+
+static void Script(void)
+{
+  unsigned int Replayed = 0;
+  unsigned long Recorded = 0;
+  unsigned int i;
+
+  HostWaitIdle();
+
+  unsigned long long Cycles = HostCycles;
+  unsigned long long Idle = HostIdleCycles;
+  unsigned long long DisplayNs = HostDisplayNs;
+  tSharpLcdStats Lcd = SharpLcdStats;
+  tSram23kStats Sram = Sram23kStats;
+  portTickType Start = xTaskGetTickCount();
+
+  for (i = 0; i < SlotNum; ++i)
+  {
+    tTraceSlot const *pSlot = &Slots[i];
+
+    /* the tick is 16 bits in a slot */
+    if (i) Recorded += (unsigned short)(pSlot->Tick - Slots[i - 1].Tick);
+
+    if (!Replayable(pSlot)) continue;
+
+    if (MaxSpeed)
+    {
+      if (uxQueueMessagesWaiting(QueueHandles[DISPLAY_QINDEX]) >= REPLAY_DEPTH) HostWaitIdle();
+    }
+    else
+    {
+      /* a tick is a millisecond to HostWait */
+      unsigned long Now = xTaskGetTickCount() - Start;
+      if (Recorded > Now) HostWait(Recorded - Now);
+    }
+
+    HostSend(pSlot->Type, pSlot->Options, pSlot->Payload, pSlot->Length);
+    Replayed ++;
+  }
+
+  HostWaitIdle();
+
+  unsigned long long Us = HOST_CYCLES_TO_US(HostCycles - Cycles);
+  unsigned long long IdleUs = HOST_CYCLES_TO_US(HostIdleCycles - Idle);
+
+  printf("%s: %u slots, %u replayed\n", MaxSpeed ? "max speed" : "recorded pace",
+    SlotNum, Replayed);
+  printf("  simulated %llu us (recorded %lu ticks), cpu busy %llu us (%llu%%)\n",
+    Us, Recorded, Us - IdleUs, Us ? (Us - IdleUs) * 100 / Us : 0);
+  printf("  display task %llu us on the host\n", (HostDisplayNs - DisplayNs) / 1000);
+  printf("  lcd %lu frames %lu lines, serial ram %lu bytes read %lu written\n",
+    SharpLcdStats.Frames - Lcd.Frames, SharpLcdStats.Lines - Lcd.Lines,
+    Sram23kStats.ReadBytes - Sram.ReadBytes, Sram23kStats.WriteBytes - Sram.WriteBytes);
+
+  HOST_CHECK(Replayed);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc == 3 && !strcmp(argv[1], "-m")) MaxSpeed = TRUE;
+  else if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s [-m] capture\n", argv[0]);
+    return 2;
+  }
+
+  int Loaded = TraceDumpLoad(argv[argc - 1], Slots);
+  if (Loaded < 0) return 1;
+  SlotNum = Loaded;
+
+  return HostRun(Script);
+}